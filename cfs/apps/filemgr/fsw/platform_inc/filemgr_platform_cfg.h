@@ -48,5 +48,6 @@
 #define FILEMGR_DIR_LIST_PKT_ENTRIES     20
 #define FILEMGR_FILESYS_TBL_VOL_CNT       8
 #define FILEMGR_TASK_FILE_BLOCK_SIZE   2048  /* Chunk of file to work with for one iteration of a task like computing a CRC */
+#define FILEMGR_CKSUM_BLOCK_SIZE      16384  /* Size of each of the two checksum read-ahead buffers */
 
 #endif /* _filemgr_platform_cfg_ */
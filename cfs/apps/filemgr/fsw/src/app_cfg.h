@@ -37,10 +37,11 @@
 **
 ** 1.0 - Initial refactoring of open source FM
 ** 1.1 - Moved childmgr utility into osk_c_fw, Moved perf & msg ids to ini file
+** 1.2 - Added file checksum service
 */
 
 #define  FILEMGR_MAJOR_VER      1
-#define  FILEMGR_MINOR_VER      1
+#define  FILEMGR_MINOR_VER      2
 
 
 /******************************************************************************
@@ -75,6 +76,7 @@
 #define CFG_DIR_LIST_TLM_MID       DIR_LIST_TLM_MID
 #define CFG_OPEN_FILES_TLM_MID     OPEN_FILES_TLM_MID
 #define CFG_FILESYS_TLM_MID        FILESYS_TLM_MID
+#define CFG_CKSUM_TLM_MID          CKSUM_TLM_MID
       
 #define CFG_CMD_PIPE_DEPTH         CMD_PIPE_DEPTH
 #define CFG_CMD_PIPE_NAME          CMD_PIPE_NAME
@@ -96,6 +98,13 @@
 #define CFG_TASK_FILE_STAT_CNT     TASK_FILE_STAT_CNT
 #define CFG_TASK_FILE_STAT_DELAY   TASK_FILE_STAT_DELAY
 
+#define CFG_CKSUM_TASK_NAME        CKSUM_TASK_NAME
+#define CFG_CKSUM_TASK_STACK_SIZE  CKSUM_TASK_STACK_SIZE
+#define CFG_CKSUM_TASK_PRIORITY    CKSUM_TASK_PRIORITY
+#define CFG_CKSUM_PROGRESS_BLOCKS  CKSUM_PROGRESS_BLOCKS
+#define CFG_CKSUM_MANIFEST_DEFNAME CKSUM_MANIFEST_DEFNAME
+#define CFG_CKSUM_MANIFEST_SUBTYPE CKSUM_MANIFEST_SUBTYPE
+
 
 #define APP_CONFIG(XX) \
    XX(APP_CFE_NAME,char*) \
@@ -108,6 +117,7 @@
    XX(DIR_LIST_TLM_MID,uint32) \
    XX(OPEN_FILES_TLM_MID,uint32) \
    XX(FILESYS_TLM_MID,uint32) \
+   XX(CKSUM_TLM_MID,uint32) \
    XX(CMD_PIPE_DEPTH,uint32) \
    XX(CMD_PIPE_NAME,char*) \
    XX(TBL_CFE_NAME,char*) \
@@ -123,6 +133,12 @@
    XX(TASK_FILE_BLOCK_DELAY,uint32) \
    XX(TASK_FILE_STAT_CNT,uint32) \
    XX(TASK_FILE_STAT_DELAY,uint32) \
+   XX(CKSUM_TASK_NAME,char*) \
+   XX(CKSUM_TASK_STACK_SIZE,uint32) \
+   XX(CKSUM_TASK_PRIORITY,uint32) \
+   XX(CKSUM_PROGRESS_BLOCKS,uint32) \
+   XX(CKSUM_MANIFEST_DEFNAME,char*) \
+   XX(CKSUM_MANIFEST_SUBTYPE,uint32) \
 
 DECLARE_ENUM(Config,APP_CONFIG)
 
@@ -156,6 +172,9 @@ DECLARE_ENUM(Config,APP_CONFIG)
 #define FILESYS_SEND_TBL_PKT_CMD_FC        (CMDMGR_APP_START_FC + 17)
 #define FILESYS_SET_TBL_STATE_CMD_FC       (CMDMGR_APP_START_FC + 18)
 
+#define CKSUM_FILE_CMD_FC                  (CMDMGR_APP_START_FC + 19) /* Child */
+#define CKSUM_DIR_CMD_FC                   (CMDMGR_APP_START_FC + 20) /* Child */
+
 /******************************************************************************
 ** Event Macros
 **
@@ -168,6 +187,7 @@ DECLARE_ENUM(Config,APP_CONFIG)
 #define DIR_BASE_EID      (OSK_C_FW_APP_BASE_EID + 20)
 #define FILE_BASE_EID     (OSK_C_FW_APP_BASE_EID + 40)
 #define FILESYS_BASE_EID  (OSK_C_FW_APP_BASE_EID + 60)
+#define CKSUM_BASE_EID    (OSK_C_FW_APP_BASE_EID + 80)
 
 
 #endif /* _app_cfg_ */
@@ -0,0 +1,1047 @@
+/*
+** Purpose: Implement the CKSUM_Class methods
+**
+** Notes:
+**   1. The read-ahead task and the child task hand the two buffers back and
+**      forth with two counting semaphores. Buffers are always consumed in
+**      the order they were filled so a buffer index is all each task needs.
+**   2. Each buffer that is hashed counts as CKSUM_TASK_BLOCKS_PER_BUF task
+**      blocks for CHILDMGR_PauseTask() so the checksum is paced by the same
+**      FILEMGR_TASK_FILE_BLOCK_SIZE blocks as the other file tasks. The reader
+**      keeps filling the other buffer while the child task is paused.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+**   3. FIPS PUB 180-4, Secure Hash Standard.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+
+#include "app_cfg.h"
+#include "initbl.h"
+#include "childmgr.h"
+#include "cksum.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define READ_AHEAD_TIMEOUT_MS  10000   /* Reader is presumed lost if a block takes longer */
+
+#define CKSUM_TASK_BLOCKS_PER_BUF  (FILEMGR_CKSUM_BLOCK_SIZE / FILEMGR_TASK_FILE_BLOCK_SIZE)
+
+#if FILEMGR_CKSUM_BLOCK_SIZE < FILEMGR_TASK_FILE_BLOCK_SIZE
+   #error FILEMGR_CKSUM_BLOCK_SIZE must be at least FILEMGR_TASK_FILE_BLOCK_SIZE
+#endif
+
+#define SHA256_ROTR(x,n)  (((x) >> (n)) | ((x) << (32 - (n))))
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static CKSUM_Class*  Cksum = NULL;
+
+static const uint32 Sha256K[64] = {
+
+   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+   0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+   0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+   0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+   0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+   0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+   0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+   0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+
+};
+
+
+/*
+** Local Function Prototypes
+*/
+
+static void  ReadAheadTask(void);
+static void  ParkReadAhead(void);
+static bool  ComputeFile(const char* CmdName, const char* Filename, uint8 Algorithm,
+                         uint32 FileIndex, CKSUM_Result* Result);
+static void  StartDigest(CKSUM_Result* Result);
+static void  UpdateDigest(CKSUM_Result* Result, const uint8* BufPtr, uint32 BufLen);
+static void  FinishDigest(CKSUM_Result* Result);
+static bool  ValidAlgorithm(uint8 Algorithm);
+static const char* AlgorithmStr(uint8 Algorithm);
+static void  SendStatusPkt(uint8 State, const CKSUM_Result* Result);
+static bool  WriteManifestToFile(const char* DirNameWithSep, osal_id_t DirId, osal_id_t FileHandle,
+                                 const char* ManifestFilename, uint8 Algorithm);
+static void  Sha256Init(CKSUM_Sha256* Sha256);
+static void  Sha256Update(CKSUM_Sha256* Sha256, const uint8* BufPtr, uint32 BufLen);
+static void  Sha256Final(CKSUM_Sha256* Sha256, uint8* Digest);
+static void  Sha256Transform(uint32* State, const uint8* Block);
+
+
+/******************************************************************************
+** Function: CKSUM_Constructor
+**
+** Notes:
+**   1. Failing to create the read-ahead task isn't fatal. Checksums are still
+**      computed with synchronous reads.
+**
+*/
+void CKSUM_Constructor(CKSUM_Class*  CksumPtr, INITBL_Class* IniTbl)
+{
+
+   CKSUM_ReadAhead* ReadAhead;
+   int32 Status;
+   char  FailedFuncStr[32] = "\0";
+
+   Cksum = CksumPtr;
+
+   CFE_PSP_MemSet((void*)Cksum, 0, sizeof(CKSUM_Class));
+
+   Cksum->IniTbl = IniTbl;
+   Cksum->ProgressBlocks = INITBL_GetIntConfig(Cksum->IniTbl, CFG_CKSUM_PROGRESS_BLOCKS);
+
+   CFE_MSG_Init(&Cksum->StatusPkt.TlmHeader.Msg, (CFE_SB_MsgId_t)INITBL_GetIntConfig(Cksum->IniTbl, CFG_CKSUM_TLM_MID),
+                sizeof(CKSUM_StatusPkt));
+
+   ReadAhead = &Cksum->ReadAhead;
+
+   Status = OS_CountSemCreate(&ReadAhead->TaskSem, "FILEMGR_CKSUM_TASK", 0, 0);
+   if (Status == OS_SUCCESS) {
+
+      Status = OS_CountSemCreate(&ReadAhead->FreeSem, "FILEMGR_CKSUM_FREE", 2, 0);
+      if (Status == OS_SUCCESS) {
+
+         Status = OS_CountSemCreate(&ReadAhead->FullSem, "FILEMGR_CKSUM_FULL", 0, 0);
+         if (Status == OS_SUCCESS) {
+
+            Status = CFE_ES_CreateChildTask(&ReadAhead->TaskId,
+                                            INITBL_GetStrConfig(Cksum->IniTbl, CFG_CKSUM_TASK_NAME),
+                                            ReadAheadTask, 0,
+                                            INITBL_GetIntConfig(Cksum->IniTbl, CFG_CKSUM_TASK_STACK_SIZE),
+                                            INITBL_GetIntConfig(Cksum->IniTbl, CFG_CKSUM_TASK_PRIORITY), 0);
+
+            if (Status == CFE_SUCCESS) {
+               ReadAhead->Created = true;
+            }
+            else {
+               strcpy(FailedFuncStr, "CFE_ES_CreateChildTask()");
+            }
+         }
+         else {
+            strcpy(FailedFuncStr, "OS_CountSemCreate(Full)");
+         }
+      }
+      else {
+         strcpy(FailedFuncStr, "OS_CountSemCreate(Free)");
+      }
+   }
+   else {
+      strcpy(FailedFuncStr, "OS_CountSemCreate(Task)");
+   }
+
+   if (!ReadAhead->Created) {
+
+      CFE_EVS_SendEvent(CKSUM_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Checksum read-ahead disabled: %s failed, Status=0x%8X",
+                        FailedFuncStr, (unsigned int)Status);
+   }
+
+} /* End CKSUM_Constructor */
+
+
+/******************************************************************************
+** Function:  CKSUM_ResetStatus
+**
+*/
+void CKSUM_ResetStatus()
+{
+
+   Cksum->CmdWarningCnt = 0;
+
+} /* End CKSUM_ResetStatus() */
+
+
+/******************************************************************************
+** Function: CKSUM_ComputeFile
+**
+*/
+bool CKSUM_ComputeFile(const char* CmdName, const char* Filename, uint8 Algorithm, CKSUM_Result* Result)
+{
+
+   return ComputeFile(CmdName, Filename, Algorithm, 1, Result);
+
+} /* End CKSUM_ComputeFile() */
+
+
+/******************************************************************************
+** Function: CKSUM_FileCmd
+**
+** Notes:
+**   1. FileUtil_GetFileInfo() verifies filename prior to checking state.
+**   2. The digest is reported in the final status packet.
+**
+*/
+bool CKSUM_FileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   const CKSUM_FileCmdMsg* FileCmd = (const CKSUM_FileCmdMsg *) SbBufPtr;
+   FileUtil_FileInfo FileInfo;
+   CKSUM_Result Result;
+   bool  RetStatus = false;
+
+
+   FileInfo = FileUtil_GetFileInfo(FileCmd->Filename, OS_MAX_PATH_LEN, false);
+
+   if (FILEUTIL_FILE_EXISTS(FileInfo.State)) {
+
+      if (ComputeFile("Checksum file", FileCmd->Filename, FileCmd->Algorithm, 1, &Result)) {
+
+         CFE_EVS_SendEvent(CKSUM_FILE_EID, CFE_EVS_EventType_INFORMATION,
+                           "Computed %s of %s, %llu bytes",
+                           AlgorithmStr(Result.Algorithm), FileCmd->Filename, (unsigned long long)Result.FileSize);
+
+         RetStatus = true;
+
+      }
+   } /* End if file exists */
+   else {
+
+      CFE_EVS_SendEvent(CKSUM_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Checksum file cmd failed: %s doesn't exist. It's state is %s",
+                        FileCmd->Filename, FileUtil_FileStateStr(FileInfo.State));
+
+   } /* End if file doesn't exist */
+
+   return RetStatus;
+
+} /* End CKSUM_FileCmd() */
+
+
+/******************************************************************************
+** Function: CKSUM_DirCmd
+**
+** Notes:
+**   1. Target file will be overwritten if it exists and is closed.
+**   2. The manifest file is skipped if it is written to the directory being
+**      checksummed.
+**
+*/
+bool CKSUM_DirCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   const CKSUM_DirCmdMsg* DirCmd = (const CKSUM_DirCmdMsg *) SbBufPtr;
+   bool RetStatus = false;
+
+   osal_id_t  FileHandle;
+   osal_id_t  DirId;
+   int32      SysStatus;
+   char DirNameWithSep[OS_MAX_PATH_LEN] = "\0";
+   char Filename[OS_MAX_PATH_LEN] = "\0";
+   FileUtil_FileInfo FileInfo;
+
+
+   if (!ValidAlgorithm(DirCmd->Algorithm)) {
+
+      CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Checksum directory cmd failed: Invalid algorithm %d",
+                        DirCmd->Algorithm);
+
+      return RetStatus;
+   }
+
+   FileInfo = FileUtil_GetFileInfo(DirCmd->DirName, OS_MAX_PATH_LEN, false);
+
+   if (FileInfo.State == FILEUTIL_FILE_IS_DIR) {
+
+      if (DirCmd->Filename[0] == '\0') {
+         strncpy(Filename, INITBL_GetStrConfig(Cksum->IniTbl, CFG_CKSUM_MANIFEST_DEFNAME), OS_MAX_PATH_LEN - 1);
+         Filename[OS_MAX_PATH_LEN - 1] = '\0';
+      }
+      else {
+         CFE_PSP_MemCpy(Filename, DirCmd->Filename, OS_MAX_PATH_LEN);
+         Filename[OS_MAX_PATH_LEN - 1] = '\0';
+      }
+
+      FileInfo = FileUtil_GetFileInfo(Filename, OS_MAX_PATH_LEN, false);
+
+      if ((FileInfo.State == FILEUTIL_FILE_CLOSED) ||
+          (FileInfo.State == FILEUTIL_FILE_NONEXISTENT)) {
+
+         strncpy(DirNameWithSep, DirCmd->DirName, OS_MAX_PATH_LEN - 1);
+         DirNameWithSep[OS_MAX_PATH_LEN - 1] = '\0';
+         if (FileUtil_AppendPathSep(DirNameWithSep, OS_MAX_PATH_LEN)) {
+
+            SysStatus = OS_DirectoryOpen(&DirId, DirCmd->DirName);
+
+            if (SysStatus == OS_SUCCESS) {
+
+               SysStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+               if (SysStatus == OS_SUCCESS) {
+
+                  RetStatus = WriteManifestToFile(DirNameWithSep, DirId, FileHandle, Filename, DirCmd->Algorithm);
+
+                  OS_close(FileHandle);
+
+                  if (RetStatus) {
+
+                     CFE_EVS_SendEvent(CKSUM_DIR_EID, CFE_EVS_EventType_INFORMATION,
+                                       "%s manifest for %s written to %s: %u files, %u failed",
+                                       AlgorithmStr(DirCmd->Algorithm), DirCmd->DirName, Filename,
+                                       (unsigned int)Cksum->ManifestStats.FilesWrittenCnt,
+                                       (unsigned int)Cksum->ManifestStats.FilesFailedCnt);
+                  }
+
+               }
+               else {
+
+                  CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                                    "Checksum directory cmd failed: Error creating file %s, Status=%d",
+                                    Filename, (int)SysStatus);
+
+               } /* End if error opening output file */
+
+               OS_DirectoryClose(DirId);
+
+            } /* Open dir */
+            else {
+
+               CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                                 "Checksum directory cmd failed: OS_DirectoryOpen failed for %s",
+                                 DirCmd->DirName);
+
+            }
+
+         } /* DirWithSep length okay */
+         else {
+
+            CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Checksum directory cmd failed: %s with path separator is too long",
+                              DirCmd->DirName);
+
+         } /* DirWithSep length too long */
+
+      } /* Target file okay to write */
+      else {
+
+         CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Checksum directory cmd failed: %s must be closed or nonexistent. File state is %s",
+                           Filename, FileUtil_FileStateStr(FileInfo.State));
+
+      } /* Target file not okay to write */
+
+   } /* End if file is a directory */
+   else {
+
+      CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Checksum directory cmd failed: %s is not a directory. It's state is %s",
+                        DirCmd->DirName, FileUtil_FileStateStr(FileInfo.State));
+
+   } /* End if file is not a directory */
+
+   return RetStatus;
+
+} /* End CKSUM_DirCmd() */
+
+
+/******************************************************************************
+** Function: ReadAheadTask
+**
+** Notes:
+**   1. Pends until the child task hands it an open file, then fills buffers
+**      as they're freed until it reads the end of the file or an error. The
+**      buffer holding the final read is always given to the child task so it
+**      sees the end of the file.
+**
+*/
+static void ReadAheadTask(void)
+{
+
+   CKSUM_ReadAhead* ReadAhead = &Cksum->ReadAhead;
+   int32  Status  = OS_SUCCESS;
+   uint8  BufIdx;
+   bool   Reading;
+
+
+   while (Status == OS_SUCCESS) {
+
+      Status = OS_CountSemTake(ReadAhead->TaskSem);
+
+      BufIdx  = 0;
+      Reading = (Status == OS_SUCCESS);
+
+      while (Reading) {
+
+         Status = OS_CountSemTake(ReadAhead->FreeSem);
+
+         if (Status == OS_SUCCESS) {
+
+            ReadAhead->BufLen[BufIdx] = OS_read(ReadAhead->FileHandle, ReadAhead->Buf[BufIdx],
+                                                FILEMGR_CKSUM_BLOCK_SIZE);
+
+            Reading = (ReadAhead->BufLen[BufIdx] > 0);
+            BufIdx ^= 1;
+
+            OS_CountSemGive(ReadAhead->FullSem);
+
+         }
+         else {
+            Reading = false;
+         }
+
+      } /* End while reading file */
+   } /* End while semaphores valid */
+
+   CFE_ES_ExitChildTask();
+
+} /* End ReadAheadTask() */
+
+
+/******************************************************************************
+** Function: ParkReadAhead
+**
+** Notes:
+**   1. Takes both buffers away from the reader so it's left pending on FreeSem
+**      or TaskSem and no longer touches a buffer or the file. A read in
+**      progress is waited for since the file can't be closed under it.
+**   2. The buffers are never given back so read-ahead is disabled.
+**
+*/
+static void ParkReadAhead(void)
+{
+
+   CKSUM_ReadAhead* ReadAhead = &Cksum->ReadAhead;
+   uint8  BufsHeld = 0;
+
+
+   while (BufsHeld < 2) {
+
+      if (OS_CountSemTimedWait(ReadAhead->FreeSem, 0) == OS_SUCCESS) {
+         BufsHeld++;
+      }
+      else if (OS_CountSemTake(ReadAhead->FullSem) == OS_SUCCESS) {
+         BufsHeld++;
+      }
+      else {
+         break;  /* Semaphore error, the reader can't be running either */
+      }
+
+   } /* End while reader holds a buffer */
+
+   ReadAhead->Created = false;
+
+} /* End ParkReadAhead() */
+
+
+/******************************************************************************
+** Function: ComputeFile
+**
+** Notes:
+**   1. If a read-ahead buffer doesn't arrive in time the file fails and the
+**      reader is parked before the file is closed. Future files are read
+**      synchronously into the first buffer which the parked reader no longer
+**      uses.
+**
+*/
+static bool ComputeFile(const char* CmdName, const char* Filename, uint8 Algorithm,
+                        uint32 FileIndex, CKSUM_Result* Result)
+{
+
+   CKSUM_ReadAhead* ReadAhead = &Cksum->ReadAhead;
+   osal_id_t  FileHandle;
+   os_fstat_t FileStatus;
+   int32   SysStatus;
+   int32   BufLen;
+   uint8*  BufPtr;
+   uint8   BufIdx = 0;
+
+   uint16  TaskBlockCnt = 0;   /* See CHILDMGR_PauseTask() */
+   uint32  ProgressCnt  = 0;
+   bool    UseReadAhead = ReadAhead->Created;
+   bool    Computing    = true;
+   bool    Computed     = false;
+
+
+   CFE_PSP_MemSet(Result, 0, sizeof(CKSUM_Result));
+   Result->Algorithm = Algorithm;
+
+   if (!ValidAlgorithm(Algorithm)) {
+
+      CFE_EVS_SendEvent(CKSUM_COMPUTE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "%s failed: Invalid algorithm %d", CmdName, Algorithm);
+
+      return Computed;
+   }
+
+   SysStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+   if (SysStatus == OS_SUCCESS) {
+
+      strncpy(Cksum->StatusPkt.Filename, Filename, OS_MAX_PATH_LEN - 1);
+      Cksum->StatusPkt.Filename[OS_MAX_PATH_LEN - 1] = '\0';
+      Cksum->StatusPkt.FileIndex = FileIndex;
+      Cksum->StatusPkt.FileSize  = 0;
+      if (OS_stat(Filename, &FileStatus) == OS_SUCCESS) {
+         Cksum->StatusPkt.FileSize = OS_FILESTAT_SIZE(FileStatus);
+      }
+
+      StartDigest(Result);
+
+      if (UseReadAhead) {
+         ReadAhead->FileHandle = FileHandle;
+         OS_CountSemGive(ReadAhead->TaskSem);
+      }
+
+      while (Computing) {
+
+         if (UseReadAhead) {
+
+            SysStatus = OS_CountSemTimedWait(ReadAhead->FullSem, READ_AHEAD_TIMEOUT_MS);
+
+            if (SysStatus == OS_SUCCESS) {
+               BufPtr = ReadAhead->Buf[BufIdx];
+               BufLen = ReadAhead->BufLen[BufIdx];
+            }
+            else {
+               UseReadAhead = false;
+               ParkReadAhead();
+               BufPtr = NULL;
+               BufLen = SysStatus;
+            }
+
+         }
+         else {
+
+            BufPtr = ReadAhead->Buf[0];
+            BufLen = OS_read(FileHandle, BufPtr, FILEMGR_CKSUM_BLOCK_SIZE);
+
+         }
+
+         if (BufLen > 0) {
+
+            UpdateDigest(Result, BufPtr, BufLen);
+            Result->FileSize += BufLen;
+
+            if ((Cksum->ProgressBlocks > 0) && (++ProgressCnt >= Cksum->ProgressBlocks)) {
+               ProgressCnt = 0;
+               SendStatusPkt(CKSUM_STATE_ACTIVE, Result);
+            }
+
+         }
+         else if (BufLen == 0) {  /* Successfully finished reading file */
+
+            Computing = false;
+            Computed  = true;
+
+         }
+         else {
+
+            Computing = false;
+
+            CFE_EVS_SendEvent(CKSUM_COMPUTE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s failed: Error reading %s, status = %d", CmdName, Filename, (int)BufLen);
+
+         }
+
+         if (UseReadAhead) {
+            OS_CountSemGive(ReadAhead->FreeSem);
+            BufIdx ^= 1;
+         }
+
+         if (Computing) {
+            TaskBlockCnt += (CKSUM_TASK_BLOCKS_PER_BUF - 1);  /* PauseTask() counts the last block */
+            CHILDMGR_PauseTask(&TaskBlockCnt, INITBL_GetIntConfig(Cksum->IniTbl, CFG_TASK_FILE_BLOCK_CNT),
+                               INITBL_GetIntConfig(Cksum->IniTbl, CFG_TASK_FILE_BLOCK_DELAY),
+                               INITBL_GetIntConfig(Cksum->IniTbl, CFG_CHILD_TASK_PERF_ID));
+         }
+
+      } /* End while computing */
+
+      OS_close(FileHandle);
+
+      if (Computed) {
+         FinishDigest(Result);
+         SendStatusPkt(CKSUM_STATE_COMPLETE, Result);
+      }
+      else {
+         SendStatusPkt(CKSUM_STATE_ERROR, Result);
+      }
+
+   }
+   else {
+
+      CFE_EVS_SendEvent(CKSUM_COMPUTE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "%s failed: Error opening file %s, OS_OpenCreate status %d", CmdName, Filename, (int)SysStatus);
+
+   } /* End if file open */
+
+   return Computed;
+
+} /* End ComputeFile() */
+
+
+/******************************************************************************
+** Function: StartDigest
+**
+*/
+static void StartDigest(CKSUM_Result* Result)
+{
+
+   Result->Crc = 0;
+
+   if (Result->Algorithm == CKSUM_ALG_SHA_256) {
+      Sha256Init(&Cksum->Sha256);
+   }
+
+} /* End StartDigest() */
+
+
+/******************************************************************************
+** Function: UpdateDigest
+**
+*/
+static void UpdateDigest(CKSUM_Result* Result, const uint8* BufPtr, uint32 BufLen)
+{
+
+   if (Result->Algorithm == CKSUM_ALG_SHA_256) {
+      Sha256Update(&Cksum->Sha256, BufPtr, BufLen);
+   }
+   else {
+      Result->Crc = CFE_ES_CalculateCRC(BufPtr, BufLen, Result->Crc, Result->Algorithm);
+   }
+
+} /* End UpdateDigest() */
+
+
+/******************************************************************************
+** Function: FinishDigest
+**
+** Notes:
+**   1. CRC digests are the CRC's width, most significant byte first.
+**
+*/
+static void FinishDigest(CKSUM_Result* Result)
+{
+
+   if (Result->Algorithm == CKSUM_ALG_SHA_256) {
+
+      Sha256Final(&Cksum->Sha256, Result->Digest);
+      Result->DigestLen = 32;
+
+   }
+   else if (Result->Algorithm == CKSUM_ALG_CRC_16) {
+
+      Result->Digest[0] = (uint8)(Result->Crc >> 8);
+      Result->Digest[1] = (uint8)(Result->Crc);
+      Result->DigestLen = 2;
+
+   }
+   else {
+
+      Result->Digest[0] = (uint8)(Result->Crc >> 24);
+      Result->Digest[1] = (uint8)(Result->Crc >> 16);
+      Result->Digest[2] = (uint8)(Result->Crc >> 8);
+      Result->Digest[3] = (uint8)(Result->Crc);
+      Result->DigestLen = 4;
+
+   }
+
+} /* End FinishDigest() */
+
+
+/******************************************************************************
+** Function: ValidAlgorithm
+**
+*/
+static bool ValidAlgorithm(uint8 Algorithm)
+{
+
+   return ((Algorithm == CKSUM_ALG_CRC_16)  ||
+           (Algorithm == CKSUM_ALG_CRC_32)  ||
+           (Algorithm == CKSUM_ALG_CRC_32C) ||
+           (Algorithm == CKSUM_ALG_SHA_256));
+
+} /* End ValidAlgorithm() */
+
+
+/******************************************************************************
+** Function: AlgorithmStr
+**
+*/
+static const char* AlgorithmStr(uint8 Algorithm)
+{
+
+   const char* Str = "Unknown";
+
+   switch (Algorithm) {
+      case CKSUM_ALG_CRC_16:  Str = "CRC-16";  break;
+      case CKSUM_ALG_CRC_32:  Str = "CRC-32";  break;
+      case CKSUM_ALG_CRC_32C: Str = "CRC-32C"; break;
+      case CKSUM_ALG_SHA_256: Str = "SHA-256"; break;
+      default: break;
+   }
+
+   return Str;
+
+} /* End AlgorithmStr() */
+
+
+/******************************************************************************
+** Function: SendStatusPkt
+**
+** Notes:
+**   1. Filename, FileIndex and FileSize are loaded when the file is opened.
+**
+*/
+static void SendStatusPkt(uint8 State, const CKSUM_Result* Result)
+{
+
+   Cksum->StatusPkt.State     = State;
+   Cksum->StatusPkt.Algorithm = Result->Algorithm;
+   Cksum->StatusPkt.BytesProcessed = Result->FileSize;
+
+   if (State == CKSUM_STATE_COMPLETE) {
+      Cksum->StatusPkt.DigestLen = Result->DigestLen;
+      CFE_PSP_MemCpy(Cksum->StatusPkt.Digest, Result->Digest, CKSUM_DIGEST_MAX_LEN);
+   }
+   else {
+      Cksum->StatusPkt.DigestLen = 0;
+      CFE_PSP_MemSet(Cksum->StatusPkt.Digest, 0, CKSUM_DIGEST_MAX_LEN);
+   }
+
+   CFE_SB_TimeStampMsg(&(Cksum->StatusPkt.TlmHeader.Msg));
+   CFE_SB_TransmitMsg(&(Cksum->StatusPkt.TlmHeader.Msg), true);
+
+} /* End SendStatusPkt() */
+
+
+/******************************************************************************
+** Function: WriteManifestToFile
+**
+** Notes:
+**   1. The command handler took care of validating inputs and opening the
+**      input directory and output file. This function is responsible for
+**      writing all of the content to the output file including the header.
+**   2. Files that can't be checksummed get an entry with Valid cleared and
+**      count as command warnings.
+**
+*/
+static bool WriteManifestToFile(const char* DirNameWithSep, osal_id_t DirId, osal_id_t FileHandle,
+                                const char* ManifestFilename, uint8 Algorithm)
+{
+
+   CKSUM_ManifestStats* Stats = &Cksum->ManifestStats;
+   CKSUM_ManifestEntry* Entry = &Cksum->ManifestEntry;
+
+   bool ReadingDir   = true;
+   bool FileWriteErr = false;
+   bool CreatedFile  = false;
+
+   uint16 DirWithSepLen = strlen(DirNameWithSep);
+   uint16 DirEntryLen   = 0;
+   int32  BytesWritten;
+   char   PathFilename[OS_MAX_PATH_LEN] = "\0";
+
+   int32            SysStatus;
+   CFE_FS_Header_t  FileHeader;
+   os_dirent_t      DirEntry;
+   os_fstat_t       FileStatus;
+   CKSUM_Result     Result;
+
+
+   CFE_PSP_MemSet(&FileHeader, 0, sizeof(CFE_FS_Header_t));
+   FileHeader.SubType = INITBL_GetIntConfig(Cksum->IniTbl, CFG_CKSUM_MANIFEST_SUBTYPE);
+   strncpy(FileHeader.Description, "Checksum Manifest", sizeof(FileHeader.Description) - 1);
+   FileHeader.Description[sizeof(FileHeader.Description) - 1] = '\0';
+
+   BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+   if (BytesWritten != sizeof(CFE_FS_Header_t)) {
+
+      CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Checksum directory cmd failed: OS_write cFE header failed: result = %d, expected = %d",
+                        (int)BytesWritten, (int)sizeof(CFE_FS_Header_t));
+
+      return CreatedFile;
+   }
+
+   /*
+   ** Write initial stats. They're rewritten after the directory is processed.
+   */
+
+   CFE_PSP_MemSet(Stats, 0, sizeof(CKSUM_ManifestStats));
+   strncpy(Stats->DirName, DirNameWithSep, OS_MAX_PATH_LEN - 1);
+   Stats->DirName[OS_MAX_PATH_LEN - 1] = '\0';
+   Stats->Algorithm = Algorithm;
+
+   BytesWritten = OS_write(FileHandle, Stats, sizeof(CKSUM_ManifestStats));
+   if (BytesWritten != sizeof(CKSUM_ManifestStats)) {
+
+      CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Checksum directory cmd failed: OS_write stats failed: result = %d, expected = %d",
+                        (int)BytesWritten, (int)sizeof(CKSUM_ManifestStats));
+
+      return CreatedFile;
+   }
+
+   while (ReadingDir && !FileWriteErr) {
+
+      SysStatus = OS_DirectoryRead(DirId, &DirEntry);
+
+      if (SysStatus != OS_SUCCESS) {
+
+         ReadingDir = false;  /* Normal loop end - no more directory entries */
+
+      }
+      else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FILEUTIL_CURRENT_DIR) != 0) &&
+               (strcmp(OS_DIRENTRY_NAME(DirEntry), FILEUTIL_PARENT_DIR) != 0)) {
+
+         ++Stats->DirFileCnt;
+
+         DirEntryLen = strlen(OS_DIRENTRY_NAME(DirEntry));
+
+         if ((DirEntryLen < sizeof(Entry->Name)) &&
+             ((DirWithSepLen + DirEntryLen) < OS_MAX_PATH_LEN)) {
+
+            strncpy(PathFilename, DirNameWithSep, DirWithSepLen);
+            PathFilename[DirWithSepLen] = '\0';
+            strncat(PathFilename, OS_DIRENTRY_NAME(DirEntry), (OS_MAX_PATH_LEN - DirWithSepLen - 1));
+
+            CFE_PSP_MemSet(&FileStatus, 0, sizeof(os_fstat_t));
+            SysStatus = OS_stat(PathFilename, &FileStatus);
+
+            if ((SysStatus == OS_SUCCESS) && !OS_FILESTAT_ISDIR(FileStatus) &&
+                (strcmp(PathFilename, ManifestFilename) != 0)) {
+
+               CFE_PSP_MemSet(Entry, 0, sizeof(CKSUM_ManifestEntry));
+               strncpy(Entry->Name, OS_DIRENTRY_NAME(DirEntry), sizeof(Entry->Name) - 1);
+               Entry->Time = (uint32)OS_TimeGetTotalSeconds(FileStatus.FileTime);
+
+               if (ComputeFile("Checksum directory", PathFilename, Algorithm,
+                               Stats->FilesWrittenCnt + 1, &Result)) {
+
+                  Entry->Valid     = true;
+                  Entry->Size      = Result.FileSize;
+                  Entry->DigestLen = Result.DigestLen;
+                  CFE_PSP_MemCpy(Entry->Digest, Result.Digest, CKSUM_DIGEST_MAX_LEN);
+
+               }
+               else {
+
+                  Entry->Size = OS_FILESTAT_SIZE(FileStatus);
+                  ++Stats->FilesFailedCnt;
+                  ++Cksum->CmdWarningCnt;
+
+               }
+
+               BytesWritten = OS_write(FileHandle, Entry, sizeof(CKSUM_ManifestEntry));
+               if (BytesWritten == sizeof(CKSUM_ManifestEntry)) {
+
+                  ++Stats->FilesWrittenCnt;
+
+               }
+               else {
+
+                  FileWriteErr = true;
+
+                  CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                                    "Checksum directory cmd failed: OS_write entry failed: result = %d, expected = %d",
+                                    (int)BytesWritten, (int)sizeof(CKSUM_ManifestEntry));
+
+               }
+
+            } /* End if regular file */
+
+         } /* End if file name lengths valid */
+         else {
+
+            ++Cksum->CmdWarningCnt;
+
+            CFE_EVS_SendEvent(CKSUM_DIR_WARN_EID, CFE_EVS_EventType_ERROR,
+                              "Checksum directory cmd warning: Combined dir/entry name too long: dir = %s, entry = %s",
+                              DirNameWithSep, OS_DIRENTRY_NAME(DirEntry));
+
+         }
+
+      } /* End if not current/parent directory */
+   } /* End Reading Dir & Writing file loop */
+
+   if (!FileWriteErr) {
+
+      OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+      BytesWritten = OS_write(FileHandle, Stats, sizeof(CKSUM_ManifestStats));
+
+      if (BytesWritten == sizeof(CKSUM_ManifestStats)) {
+
+         CreatedFile = true;
+
+      }
+      else {
+
+         CFE_EVS_SendEvent(CKSUM_DIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Checksum directory cmd failed: OS_write stats failed: result = %d, expected = %d",
+                           (int)BytesWritten, (int)sizeof(CKSUM_ManifestStats));
+
+      }
+   }
+
+   return CreatedFile;
+
+} /* End WriteManifestToFile() */
+
+
+/******************************************************************************
+** Function: Sha256Init
+**
+*/
+static void Sha256Init(CKSUM_Sha256* Sha256)
+{
+
+   Sha256->State[0] = 0x6a09e667;
+   Sha256->State[1] = 0xbb67ae85;
+   Sha256->State[2] = 0x3c6ef372;
+   Sha256->State[3] = 0xa54ff53a;
+   Sha256->State[4] = 0x510e527f;
+   Sha256->State[5] = 0x9b05688c;
+   Sha256->State[6] = 0x1f83d9ab;
+   Sha256->State[7] = 0x5be0cd19;
+
+   Sha256->BitLen   = 0;
+   Sha256->BlockLen = 0;
+
+} /* End Sha256Init() */
+
+
+/******************************************************************************
+** Function: Sha256Update
+**
+** Notes:
+**   1. Whole blocks are hashed directly from the caller's buffer so only a
+**      partial block at either end is copied.
+**
+*/
+static void Sha256Update(CKSUM_Sha256* Sha256, const uint8* BufPtr, uint32 BufLen)
+{
+
+   uint32 CopyLen;
+
+   Sha256->BitLen += (uint64)BufLen * 8;
+
+   if (Sha256->BlockLen > 0) {
+
+      CopyLen = 64 - Sha256->BlockLen;
+      if (CopyLen > BufLen) {
+         CopyLen = BufLen;
+      }
+
+      memcpy(&Sha256->Block[Sha256->BlockLen], BufPtr, CopyLen);
+      Sha256->BlockLen += CopyLen;
+      BufPtr += CopyLen;
+      BufLen -= CopyLen;
+
+      if (Sha256->BlockLen == 64) {
+         Sha256Transform(Sha256->State, Sha256->Block);
+         Sha256->BlockLen = 0;
+      }
+   }
+
+   while (BufLen >= 64) {
+      Sha256Transform(Sha256->State, BufPtr);
+      BufPtr += 64;
+      BufLen -= 64;
+   }
+
+   if (BufLen > 0) {
+      memcpy(Sha256->Block, BufPtr, BufLen);
+      Sha256->BlockLen = BufLen;
+   }
+
+} /* End Sha256Update() */
+
+
+/******************************************************************************
+** Function: Sha256Final
+**
+*/
+static void Sha256Final(CKSUM_Sha256* Sha256, uint8* Digest)
+{
+
+   uint64 BitLen = Sha256->BitLen;
+   uint8  i;
+
+   Sha256->Block[Sha256->BlockLen++] = 0x80;
+
+   if (Sha256->BlockLen > 56) {
+      memset(&Sha256->Block[Sha256->BlockLen], 0, 64 - Sha256->BlockLen);
+      Sha256Transform(Sha256->State, Sha256->Block);
+      Sha256->BlockLen = 0;
+   }
+
+   memset(&Sha256->Block[Sha256->BlockLen], 0, 56 - Sha256->BlockLen);
+
+   for (i = 0; i < 8; i++) {
+      Sha256->Block[63 - i] = (uint8)(BitLen >> (8 * i));
+   }
+
+   Sha256Transform(Sha256->State, Sha256->Block);
+
+   for (i = 0; i < 8; i++) {
+      Digest[4*i]     = (uint8)(Sha256->State[i] >> 24);
+      Digest[4*i + 1] = (uint8)(Sha256->State[i] >> 16);
+      Digest[4*i + 2] = (uint8)(Sha256->State[i] >> 8);
+      Digest[4*i + 3] = (uint8)(Sha256->State[i]);
+   }
+
+} /* End Sha256Final() */
+
+
+/******************************************************************************
+** Function: Sha256Transform
+**
+*/
+static void Sha256Transform(uint32* State, const uint8* Block)
+{
+
+   uint32 W[64];
+   uint32 a, b, c, d, e, f, g, h;
+   uint32 S0, S1, T1, T2;
+   uint8  i;
+
+   for (i = 0; i < 16; i++) {
+      W[i] = ((uint32)Block[4*i] << 24) | ((uint32)Block[4*i + 1] << 16) |
+             ((uint32)Block[4*i + 2] << 8) | (uint32)Block[4*i + 3];
+   }
+
+   for (i = 16; i < 64; i++) {
+      S0 = SHA256_ROTR(W[i-15], 7) ^ SHA256_ROTR(W[i-15], 18) ^ (W[i-15] >> 3);
+      S1 = SHA256_ROTR(W[i-2], 17) ^ SHA256_ROTR(W[i-2], 19) ^ (W[i-2] >> 10);
+      W[i] = W[i-16] + S0 + W[i-7] + S1;
+   }
+
+   a = State[0]; b = State[1]; c = State[2]; d = State[3];
+   e = State[4]; f = State[5]; g = State[6]; h = State[7];
+
+   for (i = 0; i < 64; i++) {
+      S1 = SHA256_ROTR(e, 6) ^ SHA256_ROTR(e, 11) ^ SHA256_ROTR(e, 25);
+      T1 = h + S1 + ((e & f) ^ (~e & g)) + Sha256K[i] + W[i];
+      S0 = SHA256_ROTR(a, 2) ^ SHA256_ROTR(a, 13) ^ SHA256_ROTR(a, 22);
+      T2 = S0 + ((a & b) ^ (a & c) ^ (b & c));
+      h = g; g = f; f = e; e = d + T1;
+      d = c; c = b; b = a; a = T1 + T2;
+   }
+
+   State[0] += a; State[1] += b; State[2] += c; State[3] += d;
+   State[4] += e; State[5] += f; State[6] += g; State[7] += h;
+
+} /* End Sha256Transform() */
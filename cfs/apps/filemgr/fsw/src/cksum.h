@@ -0,0 +1,310 @@
+/*
+** Purpose: Define the file checksum (integrity) service
+**
+** Notes:
+**   1. Files are streamed through a pair of buffers. A reader task created
+**      during app initialization reads block N+1 while the child task that
+**      executes the command computes the checksum of block N. cFE child
+**      tasks can't create their own child tasks so the reader must be
+**      created by the main app task.
+**   2. The checksum algorithms are the cFE ES CRC types plus SHA-256. The
+**      CRCs are computed by CFE_ES_CalculateCRC() so values match those
+**      reported by other cFS apps.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _cksum_
+#define _cksum_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/*
+** Algorithm identifiers. The CRC values are the cFE ES CRC types so they
+** can be passed directly to CFE_ES_CalculateCRC().
+*/
+
+#define CKSUM_ALG_CRC_16   CFE_MISSION_ES_CRC_16
+#define CKSUM_ALG_CRC_32   CFE_MISSION_ES_CRC_32
+#define CKSUM_ALG_CRC_32C  CFE_MISSION_ES_CRC_32C
+#define CKSUM_ALG_SHA_256  16
+
+#define CKSUM_DIGEST_MAX_LEN  32   /* SHA-256 is the longest digest */
+
+/*
+** Status packet states
+*/
+
+#define CKSUM_STATE_IDLE      0
+#define CKSUM_STATE_ACTIVE    1
+#define CKSUM_STATE_COMPLETE  2
+#define CKSUM_STATE_ERROR     3
+
+/*
+** Event Message IDs
+*/
+
+#define CKSUM_INIT_ERR_EID          (CKSUM_BASE_EID + 0)
+#define CKSUM_FILE_EID              (CKSUM_BASE_EID + 1)
+#define CKSUM_FILE_ERR_EID          (CKSUM_BASE_EID + 2)
+#define CKSUM_DIR_EID               (CKSUM_BASE_EID + 3)
+#define CKSUM_DIR_ERR_EID           (CKSUM_BASE_EID + 4)
+#define CKSUM_DIR_WARN_EID          (CKSUM_BASE_EID + 5)
+#define CKSUM_COMPUTE_ERR_EID       (CKSUM_BASE_EID + 6)
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Command Packets
+*/
+
+typedef struct {
+
+   CFE_MSG_CommandHeader_t CmdHeader;
+
+   char   Filename[OS_MAX_PATH_LEN];
+   uint8  Algorithm;                      /* See CKSUM_ALG_xxx definitions */
+   uint8  Spare;
+
+} CKSUM_FileCmdMsg;
+#define CKSUM_FILE_CMD_DATA_LEN  (sizeof(CKSUM_FileCmdMsg) - CFE_SB_CMD_HDR_SIZE)
+
+
+typedef struct {
+
+   CFE_MSG_CommandHeader_t CmdHeader;
+
+   char   DirName[OS_MAX_PATH_LEN];
+   char   Filename[OS_MAX_PATH_LEN];      /* Manifest file, empty string uses the ini default */
+   uint8  Algorithm;                      /* See CKSUM_ALG_xxx definitions */
+   uint8  Spare;
+
+} CKSUM_DirCmdMsg;
+#define CKSUM_DIR_CMD_DATA_LEN  (sizeof(CKSUM_DirCmdMsg) - CFE_SB_CMD_HDR_SIZE)
+
+
+/******************************************************************************
+** Telemetry Packets
+*/
+
+/*
+** Sent periodically while a file is being processed and when each file
+** completes. For a directory command FileIndex is the manifest entry.
+*/
+
+typedef struct {
+
+   CFE_MSG_TelemetryHeader_t TlmHeader;
+
+   uint8   State;                 /* See CKSUM_STATE_xxx definitions */
+   uint8   Algorithm;             /* See CKSUM_ALG_xxx definitions */
+   uint8   DigestLen;             /* Number of valid Digest bytes, 0 until complete */
+   uint8   Spare;
+   uint32  FileIndex;             /* Index of the current file, starting at 1 */
+   uint64  FileSize;              /* File Size in bytes */
+   uint64  BytesProcessed;
+   char    Filename[OS_MAX_PATH_LEN];
+   uint8   Digest[CKSUM_DIGEST_MAX_LEN];   /* Most significant byte first */
+
+} CKSUM_StatusPkt;
+
+
+/******************************************************************************
+** File Structures
+**
+** A manifest file is a cFE file header followed by CKSUM_ManifestStats and a
+** CKSUM_ManifestEntry for each regular file in the directory.
+*/
+
+typedef struct {
+
+   char    DirName[OS_MAX_PATH_LEN];
+   uint32  DirFileCnt;            /* Number of files in the directory */
+   uint32  FilesWrittenCnt;       /* Number of entries written to file */
+   uint32  FilesFailedCnt;        /* Entries that couldn't be checksummed */
+   uint8   Algorithm;
+   uint8   Spare[3];
+
+} CKSUM_ManifestStats;
+
+
+typedef struct {
+
+   char    Name[OS_MAX_PATH_LEN];
+   uint64  Size;
+   uint32  Time;                  /* File's Last Modification Times */
+   uint8   Valid;                 /* Boolean flag: TRUE = Digest computed */
+   uint8   DigestLen;
+   uint8   Spare[2];
+   uint8   Digest[CKSUM_DIGEST_MAX_LEN];
+
+} CKSUM_ManifestEntry;
+
+
+/******************************************************************************
+** Computation
+*/
+
+typedef struct {
+
+   uint32  State[8];
+   uint64  BitLen;
+   uint32  BlockLen;
+   uint8   Block[64];
+
+} CKSUM_Sha256;
+
+
+typedef struct {
+
+   uint8   Algorithm;
+   uint8   DigestLen;
+   uint32  Crc;                   /* Valid for the CRC algorithms */
+   uint64  FileSize;              /* Bytes read from the file */
+   uint8   Digest[CKSUM_DIGEST_MAX_LEN];
+
+} CKSUM_Result;
+
+
+/*
+** Read-ahead state shared between the reader task and the child task.
+** FreeSem counts empty buffers, FullSem counts buffers ready to be hashed.
+*/
+
+typedef struct {
+
+   bool       Created;
+   osal_id_t  TaskSem;
+   osal_id_t  FreeSem;
+   osal_id_t  FullSem;
+   CFE_ES_TaskId_t TaskId;
+
+   osal_id_t  FileHandle;
+   int32      BufLen[2];          /* Bytes read, 0 at end of file, negative OS error */
+   uint8      Buf[2][FILEMGR_CKSUM_BLOCK_SIZE];
+
+} CKSUM_ReadAhead;
+
+
+/******************************************************************************
+** CKSUM_Class
+*/
+
+typedef struct {
+
+   /*
+   ** Framework References
+   */
+
+   INITBL_Class*  IniTbl;
+
+   /*
+   ** Class State Data
+   */
+
+   uint16  CmdWarningCnt;
+   uint32  ProgressBlocks;
+
+   CKSUM_ReadAhead  ReadAhead;
+   CKSUM_Sha256     Sha256;
+
+   /*
+   ** Telemetry Packets
+   */
+
+   CKSUM_StatusPkt  StatusPkt;
+
+   /*
+   ** Files
+   */
+
+   CKSUM_ManifestStats  ManifestStats;
+   CKSUM_ManifestEntry  ManifestEntry;
+
+} CKSUM_Class;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: CKSUM_Constructor
+**
+** Initialize the checksum object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. Must be called from the main app task because it creates the
+**      read-ahead task. If the task can't be created files are read
+**      synchronously.
+**
+*/
+void CKSUM_Constructor(CKSUM_Class *CksumPtr, INITBL_Class* IniTbl);
+
+
+/******************************************************************************
+** Function: CKSUM_ResetStatus
+**
+** Reset counters and status flags to a known reset state.
+**
+** Notes:
+**   1. Any counter or variable that is reported in HK telemetry that doesn't
+**      change the functional behavior should be reset.
+**
+*/
+void CKSUM_ResetStatus(void);
+
+
+/******************************************************************************
+** Function: CKSUM_ComputeFile
+**
+** Compute a file's checksum using the read-ahead buffers.
+**
+** Notes:
+**   1. Must only be called from the child task.
+**   2. Sends an error event using CmdName if the checksum can't be computed.
+**
+*/
+bool CKSUM_ComputeFile(const char* CmdName, const char* Filename, uint8 Algorithm, CKSUM_Result* Result);
+
+
+/******************************************************************************
+** Function: CKSUM_FileCmd
+**
+** Compute a file's checksum and report it in the status packet.
+*/
+bool CKSUM_FileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: CKSUM_DirCmd
+**
+** Write a manifest file with a checksum for each file in a directory.
+**
+** Notes:
+**   1. Target file will be overwritten if it exists and is closed.
+**   2. Subdirectories are counted but not descended into.
+*/
+bool CKSUM_DirCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+#endif /* _cksum_ */
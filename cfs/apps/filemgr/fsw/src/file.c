@@ -28,6 +28,7 @@
 #include "initbl.h"
 #include "childmgr.h"
 #include "file.h"
+#include "cksum.h"
 
 
 /**********************/
@@ -41,6 +42,8 @@ static FILE_Class*  File = NULL;
 ** Local Function Prototypes
 */
 
+static int32 AppendFile(osal_id_t TargetFileHandle, const char* SourceFilename);
+static int32 CopyFileData(osal_id_t TargetFileHandle, osal_id_t SourceFileHandle);
 static bool ConcatenateFiles(const char* SrcFile1, const char* SrcFile2, const char* TargetFile);
 static bool ComputeFileCrc(const char* CmdName, const char* Filename, uint32* Crc, uint8 CrcType);
 
@@ -169,6 +172,7 @@ bool FILE_CopyCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
    const FILE_CopyCmdMsg*  CopyCmd = (FILE_CopyCmdMsg *) SbBufPtr;
    FileUtil_FileInfo FileInfo;
+   osal_id_t TargetFileHandle;
    int32  SysStatus;   
    bool   PerformCopy = false;
    bool    RetStatus   = false;
@@ -232,8 +236,17 @@ bool FILE_CopyCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
    if (PerformCopy) {
       
-      SysStatus = OS_cp(CopyCmd->SourceFilename, CopyCmd->TargetFilename);
+      SysStatus = OS_OpenCreate(&TargetFileHandle, CopyCmd->TargetFilename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
 
+      if (SysStatus == OS_SUCCESS) {
+      
+         SysStatus = AppendFile(TargetFileHandle, CopyCmd->SourceFilename);
+         OS_close(TargetFileHandle);
+         
+         if (SysStatus != OS_SUCCESS) OS_remove(CopyCmd->TargetFilename);  /* remove partial target file */
+      
+      }
+      
       if (SysStatus == OS_SUCCESS) {
       
          RetStatus = true;      
@@ -243,7 +256,7 @@ bool FILE_CopyCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
       else {
          
          CFE_EVS_SendEvent(FILE_COPY_ERR_EID, CFE_EVS_EventType_ERROR,
-            "Copy file from %s to %s failed: Parameters validated but OS_cp() failed with status=%d",
+            "Copy file from %s to %s failed: Parameters validated but copy failed with status=%d",
             CopyCmd->SourceFilename, CopyCmd->TargetFilename, (int)SysStatus);
       }
       
@@ -561,7 +574,9 @@ bool FILE_SendInfoPktCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
       
       if (SendInfoPktCmd->ComputeCrc == true) {
 
-         if (SendInfoPktCmd->CrcType == CFE_MISSION_ES_CRC_16) {
+         if ((SendInfoPktCmd->CrcType == CFE_MISSION_ES_CRC_16) ||
+             (SendInfoPktCmd->CrcType == CFE_MISSION_ES_CRC_32) ||
+             (SendInfoPktCmd->CrcType == CFE_MISSION_ES_CRC_32C)) {
   
             if (ComputeFileCrc("Send File Info", SendInfoPktCmd->Filename,
                                &Crc, SendInfoPktCmd->CrcType)) {
@@ -674,6 +689,77 @@ bool FILE_SetPermissionsCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
 } /* End of FILE_SetPermissionsCmd() */
 
 
+/******************************************************************************
+** Function: AppendFile
+**
+** Notes:
+**   1. Copies the whole of SourceFilename to the current position of
+**      TargetFileHandle.
+**
+*/
+static int32 AppendFile(osal_id_t TargetFileHandle, const char* SourceFilename)
+{
+   
+   int32      SysStatus;
+   osal_id_t  SourceFileHandle;
+
+   SysStatus = OS_OpenCreate(&SourceFileHandle, SourceFilename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+   
+   if (SysStatus == OS_SUCCESS) {
+   
+      SysStatus = CopyFileData(TargetFileHandle, SourceFileHandle);
+      OS_close(SourceFileHandle);
+   
+   }
+   
+   return SysStatus;
+
+} /* End of AppendFile() */
+
+
+/******************************************************************************
+** Function: CopyFileData
+**
+** Notes:
+**   1. OS_FileCopyRange() moves the data inside the OS where it can so the
+**      child task doesn't pay a read and write per file block. The copy is
+**      done in chunks of TASK_FILE_BLOCK_CNT file blocks with a
+**      TASK_FILE_BLOCK_DELAY pause after each chunk, so the task file
+**      block configuration acts as a bandwidth limit for copies.
+**   2. Progress is kept in the file positions so each chunk picks up where
+**      the previous one ended.
+**
+*/
+static int32 CopyFileData(osal_id_t TargetFileHandle, osal_id_t SourceFileHandle)
+{
+   
+   int32   SysStatus;
+   size_t  BytesCopied;
+   size_t  ChunkSize;
+   uint16  TaskBlockCnt = 0;
+
+   ChunkSize = INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_CNT) * FILEMGR_TASK_FILE_BLOCK_SIZE;
+   if (ChunkSize == 0) ChunkSize = FILEMGR_TASK_FILE_BLOCK_SIZE;
+
+   do {
+   
+      SysStatus = OS_FileCopyRange(TargetFileHandle, SourceFileHandle, ChunkSize, &BytesCopied);
+      
+      /* A short chunk means the end of the source file was reached */
+      if (SysStatus == OS_SUCCESS && BytesCopied == ChunkSize) {
+   
+         CHILDMGR_PauseTask(&TaskBlockCnt, 1, INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY),
+                            INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID));
+      
+      }
+      
+   } while (SysStatus == OS_SUCCESS && BytesCopied == ChunkSize);
+   
+   return SysStatus;
+
+} /* End of CopyFileData() */
+
+
 /******************************************************************************
 ** Function: ConcatenateFiles
 **
@@ -682,93 +768,49 @@ static bool ConcatenateFiles(const char* SrcFile1, const char* SrcFile2, const c
 {
    
    int32      SysStatus;
-   osal_id_t  SourceFileHandle;
    osal_id_t  TargetFileHandle;
-   int32      BytesRead;
-   int32      BytesWritten;
       
    char    EventErrStr[256] = "\0";
-   uint16  TaskBlockCnt = 0;
-   bool    PerformingCatenation = true;
-   bool    ConcatenatedFiles    = false;
+   bool    ConcatenatedFiles = false;
   
-   sprintf(EventErrStr,"Unhandled concatenate file error");
-  
-   SysStatus = OS_cp(SrcFile1, TargetFile);
+   SysStatus = OS_OpenCreate(&TargetFileHandle, TargetFile, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+   
    if (SysStatus == OS_SUCCESS) {
    
-      SysStatus = OS_OpenCreate(&SourceFileHandle, SrcFile2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+      SysStatus = AppendFile(TargetFileHandle, SrcFile1);
       
       if (SysStatus == OS_SUCCESS) {
-   
-         SysStatus = OS_OpenCreate(&TargetFileHandle, SrcFile2, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
-   
+      
+         SysStatus = AppendFile(TargetFileHandle, SrcFile2);
+         
          if (SysStatus == OS_SUCCESS) {
          
-            OS_lseek(TargetFileHandle, 0, OS_SEEK_END);
-        
-            while (PerformingCatenation) {
-               
-               BytesRead = OS_read(SourceFileHandle, File->FileTaskBuf, FILEMGR_TASK_FILE_BLOCK_SIZE);
-               if (BytesRead == 0) {
-               
-                  PerformingCatenation = false;
-                  ConcatenatedFiles    = true;
-               
-               }
-               else if (BytesRead < 0) {
-                  
-                  PerformingCatenation = false;
-
-                  sprintf(EventErrStr,"Concatenate file cmd error: File read error. OS_read status = %d", BytesRead);
-
-               }
-               else {
-                  
-                  BytesWritten = OS_write(TargetFileHandle, File->FileTaskBuf, BytesRead);
-
-                  if (BytesWritten != BytesRead) {
-
-                     PerformingCatenation = false;
-                     sprintf(EventErrStr,"Concatenate file cmd error: File read/write error. BytesRead %d  not equal to BytesWritten %d",
-                             BytesRead, BytesWritten);
-                  
-                  }
-           
-                  CHILDMGR_PauseTask(&TaskBlockCnt, INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_CNT), 
-                                     INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY),
-                                     INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID));
-               
-               }
-               
-            } /* End while performing concatenation */
-
-            OS_close(TargetFileHandle);
-            
-         } /* End if opened target file */
-         else {
-                        
-            sprintf(EventErrStr,"Concatenate file cmd error: Error opening target file %s. Open status %d", SrcFile2, SysStatus);
-            
-         } /* End if  failed to open target file */
+            ConcatenatedFiles = true;
          
-         OS_close(SourceFileHandle);
+         }
+         else {
          
-      } /* End if opened source file */
-      else {
+            sprintf(EventErrStr,"Concatenate file cmd error: Error copying second source file %s to target file. Status %d", SrcFile2, SysStatus);
          
-         sprintf(EventErrStr,"Concatenate file cmd error: Error opening source file %s. Open status %d", SrcFile2, SysStatus);
+         }
          
-      } /* End if  failed to open source file */
+      } /* End if copied first source file to target */
+      else {
+      
+         sprintf(EventErrStr,"Concatenate file cmd error: Error copying first source file %s to target file. Status %d", SrcFile1, SysStatus);
+      
+      } /* End if failed to copy first source file to target */
+
+      OS_close(TargetFileHandle);
   
       if (ConcatenatedFiles == false) OS_remove(TargetFile);  /* remove partial target file */
  
-   } /* End if copied first source file to target */
+   } /* End if opened target file */
    else {
       
-      sprintf(EventErrStr,"Concatenate file cmd error: Error copying first source file to target file. OS_cp status %d", SysStatus);
+      sprintf(EventErrStr,"Concatenate file cmd error: Error opening target file %s. Open status %d", TargetFile, SysStatus);
       
-   } /* End if failed to copy first source file to target */
+   } /* End if failed to open target file */
 
    if (ConcatenatedFiles == false) CFE_EVS_SendEvent(FILE_CONCATENATE_ERR_EID, CFE_EVS_EventType_ERROR,"%s",EventErrStr);
    
@@ -781,75 +823,24 @@ static bool ConcatenateFiles(const char* SrcFile1, const char* SrcFile2, const c
 ** Function: ComputeFileCrc
 **
 ** Notes:
-**   1. TaskBlockCnt is the count of "task blocks" performed. A task block is 
-**      is group of instructions that is CPU intensive and may need to be 
-**      periodically suspended to prevent CPU hogging.
+**   1. The checksum service streams the file through its read-ahead buffers
+**      and paces itself using the same task block configurations.
 **
 */
 
 static bool ComputeFileCrc(const char* CmdName, const char* Filename, uint32* Crc, uint8 CrcType)
 {
    
-   int32      SysStatus;
-   osal_id_t  FileHandle;
-   int32      FileBytesRead;
-   
-   uint16  TaskBlockCnt = 0;   /* See prologue */
-   uint32  CurrentCrc   = 0;
-   bool    CrcComputed  = false;
-   bool    ComputingCrc = true;
-   
-
-   *Crc = 0;
-   SysStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-   
-   if (SysStatus == OS_SUCCESS) {
+   CKSUM_Result Result;
+   bool CrcComputed;
    
-      while (ComputingCrc) {
-         
-         FileBytesRead = OS_read(FileHandle, File->FileTaskBuf, FILEMGR_TASK_FILE_BLOCK_SIZE);
-
-         if (FileBytesRead == 0) {  /* Successfully finished reading file */
-            
-            ComputingCrc = false;
-            OS_close(FileHandle);
 
-            *Crc = CurrentCrc;
-            CrcComputed = true;
-           
-         }
-         else if (FileBytesRead < 0) {  /* Error reading file */
-            
-            ComputingCrc = false;
-            OS_close(FileHandle);
-            
-            CFE_EVS_SendEvent(FILE_COMPUTE_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Concatenate file cmd error: File read error, OS_read status = %d", FileBytesRead);
-
-         }
-         else {
-                
-            CurrentCrc = CFE_ES_CalculateCRC(File->FileTaskBuf, FileBytesRead,
-                                             CurrentCrc, CrcType);
-         
-            CHILDMGR_PauseTask(&TaskBlockCnt, INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_CNT),
-                               INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY), 
-                               INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID));
-         
-         } /* End if still reading file */
-
-      } /* End while computing CRC */
-   
-   }
-   else {
-      
-      CFE_EVS_SendEvent(FILE_COMPUTE_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "%s failed: Error opening file %s, OS_open status %d", CmdName, Filename, FileHandle);
+   CrcComputed = CKSUM_ComputeFile(CmdName, Filename, CrcType, &Result);
    
-   } /* End if file open */
+   *Crc = CrcComputed ? Result.Crc : 0;
    
    return CrcComputed;
    
-} /* End ComputeCrc() */
+} /* End ComputeFileCrc() */
 
 
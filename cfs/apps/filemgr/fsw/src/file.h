@@ -194,8 +194,6 @@ typedef struct {
    */
 
    uint16  CmdWarningCnt;
-
-   char FileTaskBuf[FILEMGR_TASK_FILE_BLOCK_SIZE];
    
    /*
    ** Telemetry Packets
@@ -32,6 +32,7 @@
 #define  DIR_OBJ      (&(FileMgr.Dir))
 #define  FILE_OBJ     (&(FileMgr.File))
 #define  FILESYS_OBJ  (&(FileMgr.FileSys))
+#define  CKSUM_OBJ    (&(FileMgr.Cksum))
 
 
 /*******************************/
@@ -128,6 +129,7 @@ bool FILEMGR_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
    DIR_ResetStatus();
    FILE_ResetStatus();
    FILESYS_ResetStatus();
+   CKSUM_ResetStatus();
 	  
    return true;
 
@@ -148,9 +150,10 @@ void FILEMGR_SendHousekeepingPkt(void)
 
    FileMgr.HkPkt.ChildCmdCounter     = FileMgr.ChildMgr.ValidCmdCnt;
    FileMgr.HkPkt.ChildCmdErrCounter  = FileMgr.ChildMgr.InvalidCmdCnt;
-   FileMgr.HkPkt.ChildCmdWarnCounter = FileMgr.File.CmdWarningCnt + FileMgr.Dir.CmdWarningCnt;
+   FileMgr.HkPkt.ChildCmdWarnCounter = FileMgr.File.CmdWarningCnt + FileMgr.Dir.CmdWarningCnt +
+                                       FileMgr.Cksum.CmdWarningCnt;
  
-   FileMgr.HkPkt.ChildQueueCount = FileMgr.ChildMgr.CmdQ.Count;
+   FileMgr.HkPkt.ChildQueueCount = CHILDMGR_GetCmdQueueCount(CHILDMGR_OBJ);
 
    FileMgr.HkPkt.ChildCurrentCC  = FileMgr.ChildMgr.CurrCmdCode;
    FileMgr.HkPkt.ChildPreviousCC = FileMgr.ChildMgr.PrevCmdCode;
@@ -200,6 +203,7 @@ static int32 InitApp(void)
       DIR_Constructor(DIR_OBJ, &FileMgr.IniTbl);
       FILE_Constructor(FILE_OBJ, &FileMgr.IniTbl);
       FILESYS_Constructor(FILESYS_OBJ, &FileMgr.IniTbl);
+      CKSUM_Constructor(CKSUM_OBJ, &FileMgr.IniTbl);
 
 
       /*
@@ -254,6 +258,11 @@ static int32 InitApp(void)
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILESYS_SEND_TBL_PKT_CMD_FC,         FILESYS_OBJ, FILESYS_SendTblPktCmd,        FILESYS_SEND_TBL_PKT_CMD_DATA_LEN);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILESYS_SET_TBL_STATE_CMD_FC,        FILESYS_OBJ, FILESYS_SetTblStateCmd,       FILESYS_SET_TBL_STATE_CMD_DATA_LEN);
 
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CKSUM_FILE_CMD_FC, CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, CKSUM_FILE_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CKSUM_DIR_CMD_FC,  CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, CKSUM_DIR_CMD_DATA_LEN);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, CKSUM_FILE_CMD_FC, CKSUM_OBJ, CKSUM_FileCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, CKSUM_DIR_CMD_FC,  CKSUM_OBJ, CKSUM_DirCmd);
+
       CFE_MSG_Init(&FileMgr.HkPkt.TlmHeader.Msg, (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_HK_TLM_MID), FILEMGR_TLM_HK_LEN);
 
 	   TBLMGR_Constructor(TBLMGR_OBJ);
@@ -24,6 +24,7 @@
 
 #include "app_cfg.h"
 #include "childmgr.h"
+#include "cksum.h"
 #include "dir.h"
 #include "file.h"
 #include "filesys.h"
@@ -121,6 +122,7 @@ typedef struct {
    DIR_Class      Dir;
    FILE_Class     File;
    FILESYS_Class  FileSys;
+   CKSUM_Class    Cksum;
  
 } FILEMGR_Class;
 
@@ -48,7 +48,7 @@
 **
 */
 
-#define UPLINK_RECV_BUFF_CNT     5
+#define UPLINK_RECV_BUFF_CNT    10  /* SB buffers preallocated for one batched socket read */
 #define UPLINK_RECV_BUFF_LEN  1024
 #define UPLINK_MSG_TUNNEL_CNT    8  /* Number of Message ID tunnels */
 #define UPLINK_UNUSED_MSG_ID  (CFE_SB_INVALID_MSG_ID)
@@ -38,7 +38,7 @@
 */
 
 #define  KIT_CI_MAJOR_VER    1
-#define  KIT_CI_MINOR_VER    1
+#define  KIT_CI_MINOR_VER    2
 
 #define CMDMGR_PIPE_DEPTH         10
 #define CMDMGR_PIPE_NAME          "KIT_CI_CMD_PIPE"
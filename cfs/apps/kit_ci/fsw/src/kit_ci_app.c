@@ -33,6 +33,8 @@
 */
 
 static int32 InitApp(void);
+static void InitInputPollSet(void);
+static void WaitForInput(void);
 static void ProcessCommands(void);
 static void SendHousekeepingPkt(KIT_CI_HkPkt *HkPkt);
 
@@ -82,7 +84,7 @@ void KIT_CI_AppMain(void)
    */
    while (CFE_ES_RunLoop(&RunStatus) == true) {
 
-      OS_TaskDelay(KIT_CI_RUNLOOP_DELAY);
+      WaitForInput();
 
       UPLINK_Read(KIT_CI_RUNLOOP_MSG_READ);
 
@@ -191,7 +193,7 @@ static int32 InitApp(void)
    ** Initialize application managers
    */
 
-   CFE_SB_CreatePipe(&KitCi.CmdPipe, CMDMGR_PIPE_DEPTH, CMDMGR_PIPE_NAME);
+   InitInputPollSet();
    CFE_SB_Subscribe(CFE_SB_ValueToMsgId(KIT_CI_CMD_MID), KitCi.CmdPipe);
    CFE_SB_Subscribe(CFE_SB_ValueToMsgId(KIT_CI_SEND_HK_MID), KitCi.CmdPipe);
 
@@ -226,9 +228,10 @@ static void ProcessCommands(void)
    CFE_SB_MsgId_t    MsgId   = CFE_SB_INVALID_MSG_ID;
    uint8*            MsgBytes;
    
+   /* Drain the pipe so a pollable pipe's event is cleared before the next wait */
    Status = CFE_SB_ReceiveBuffer(&SbBufPtr, KitCi.CmdPipe, CFE_SB_POLL);
 
-   if (Status == CFE_SUCCESS) {
+   while (Status == CFE_SUCCESS) {
 
       MsgBytes = SbBufPtr->Msg.Byte;
       
@@ -256,7 +259,69 @@ static void ProcessCommands(void)
 
       } /* End Msgid switch */
 
-   } /* End if SB received a packet */
+      Status = CFE_SB_ReceiveBuffer(&SbBufPtr, KitCi.CmdPipe, CFE_SB_POLL);
+
+   } /* End while SB received a packet */
 
 } /* End ProcessCommands() */
 
+
+/******************************************************************************
+** Function: InitInputPollSet
+**
+** Create the command pipe and, where the platform supports it, a poll set
+** holding the pipe's event and the uplink socket so the main loop can sleep
+** until either has input. Otherwise the main loop falls back to a fixed delay.
+*/
+static void InitInputPollSet(void)
+{
+
+   osal_id_t PipePollId;
+
+   KitCi.InputPollable = false;
+
+   if (CFE_SB_CreatePipeEx(&KitCi.CmdPipe, CMDMGR_PIPE_DEPTH, CMDMGR_PIPE_NAME,
+                           CFE_SB_PIPEOPTS_POLLABLE) != CFE_SUCCESS) {
+
+      CFE_SB_CreatePipe(&KitCi.CmdPipe, CMDMGR_PIPE_DEPTH, CMDMGR_PIPE_NAME);
+      return;
+   }
+
+   if (CFE_SB_GetPipePollId(KitCi.CmdPipe, &PipePollId) != CFE_SUCCESS) return;
+
+   if (OS_PollSetCreate(&KitCi.InputPollSet) != OS_SUCCESS) return;
+
+   if (OS_PollSetAdd(&KitCi.InputPollSet, PipePollId, OS_STREAM_STATE_READABLE) == OS_SUCCESS &&
+       (KitCi.Uplink.Connected == false ||
+        OS_PollSetAdd(&KitCi.InputPollSet, KitCi.Uplink.SocketId, OS_STREAM_STATE_READABLE) == OS_SUCCESS)) {
+
+      KitCi.InputPollable = true;
+   }
+   else {
+
+      OS_PollSetDelete(&KitCi.InputPollSet);
+   }
+
+} /* End InitInputPollSet() */
+
+
+/******************************************************************************
+** Function: WaitForInput
+**
+** The run loop delay still bounds the wait so the ES run status is checked
+** periodically when there is no input.
+*/
+static void WaitForInput(void)
+{
+
+   if (KitCi.InputPollable) {
+
+      OS_PollSetWait(&KitCi.InputPollSet, NULL, NULL, KIT_CI_RUNLOOP_DELAY);
+   }
+   else {
+
+      OS_TaskDelay(KIT_CI_RUNLOOP_DELAY);
+   }
+
+} /* End WaitForInput() */
+
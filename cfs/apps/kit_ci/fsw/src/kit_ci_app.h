@@ -92,6 +92,12 @@ typedef struct {
    */   
    CFE_SB_PipeId_t CmdPipe;   
    CMDMGR_Class    CmdMgr;
+
+   /*
+   ** Event driven main loop (uplink socket and command pipe)
+   */
+   bool            InputPollable;
+   OS_PollSet      InputPollSet;
    
    /*
    ** Telemetry Packets
@@ -36,7 +36,8 @@ static UPLINK_Class*  Uplink = NULL;
 */
 
 static void DestructorCallback(void);
-static void ProcessMsgTunnelMap(void);
+static uint16 LoadRecvBufs(uint16 MaxBufCnt);
+static void ProcessMsgTunnelMap(CFE_MSG_Message_t* MsgPtr);
 
 /******************************************************************************
 ** Function: UPLINK_ConfigMsgTunnelCmd
@@ -109,13 +110,6 @@ void UPLINK_Constructor(UPLINK_Class*  UplinkPtr, uint16 Port)
    
    Uplink = UplinkPtr;
    
-   /*
-   Uplink->Connected     = false;
-   Uplink->RecvMsgIdx    = 0;
-   Uplink->RecvMsgCnt    = 0;
-   Uplink->RecvMsgErrCnt = 0;
-   Uplink->RecvSbBufPtr  = NULL;
-   */
    memset(Uplink,0,sizeof(UPLINK_Class));
 
    Uplink->MsgTunnel.Enabled = false;
@@ -171,87 +165,71 @@ void UPLINK_Constructor(UPLINK_Class*  UplinkPtr, uint16 Port)
 int UPLINK_Read(uint16 MaxMsgRead)
 {
 
-   int  i = 0;
-   int  Status;
-   uint8* MsgBytes;
-   UPLINK_SocketRecvCmdMsg *RecvCmdMsg; 
+   int     MsgRead = 0;
+   int32   Status;
+   int32   RecvCnt;
+   uint16  BufCnt;
+   uint16  i;
+   size_t  MsgLen;
+   uint8*  MsgBytes;
+   CFE_SB_Buffer_t* SbBufPtr;
    
     
-   if (Uplink->Connected == false) return i;
+   if (Uplink->Connected == false) return MsgRead;
 
    
-   for (i = 0; i < MaxMsgRead; i++) {
+   while (MsgRead < MaxMsgRead) {
 
-      RecvCmdMsg = &(Uplink->RecvMsg[Uplink->RecvMsgIdx]);
-      
-      /*
-      if (Uplink->RecvSbBufPtr == NULL) {
+      BufCnt = LoadRecvBufs(MaxMsgRead - MsgRead);
+      if (BufCnt == 0) break;
       
-         Uplink->RecvSbBufPtr = CFE_SB_AllocateMessageBuffer(UPLINK_RECV_BUFF_LEN);
-      
-         if (Uplink->RecvSbBufPtr == NULL) {
-         
-            CFE_EVS_SendEvent(UPLINK_RECV_ERR_EID,CFE_EVS_EventType_ERROR,
-                              "Failed to allocate SB buffer of length %d", UPLINK_RECV_BUFF_LEN);
-            
-            break;
-         }
-      }   
-      */
-      Status = OS_SocketRecvFrom(Uplink->SocketId, RecvCmdMsg, sizeof(UPLINK_SocketRecvCmdMsg),
-                                 &(Uplink->SocketAddress), OS_CHECK);
+      RecvCnt = OS_SocketRecvFromMulti(Uplink->SocketId, Uplink->RecvBuf, BufCnt, OS_CHECK);
       
+      if (RecvCnt <= 0) break; /* no (more) messages */
       
-      //~Status = OS_SocketRecvFrom(Uplink->SocketId, Uplink->RecvSbBufPtr, UPLINK_RECV_BUFF_LEN,
-      //~                           &(Uplink->SocketAddress), OS_CHECK);
+      for (i = 0; i < RecvCnt; i++) {
       
-      Uplink->RecvMsgIdx++;
-      if (Uplink->RecvMsgIdx >= UPLINK_RECV_BUFF_CNT) Uplink->RecvMsgIdx = 0;
-                                 
-      if (Status >= (int32)sizeof(CFE_MSG_CommandHeader_t) && Status <= ((int32)UPLINK_RECV_BUFF_LEN)) {
+         SbBufPtr = Uplink->RecvSbBufPtr[i];
+         MsgLen   = Uplink->RecvBuf[i].RecvLen;
          
-         CFE_EVS_SendEvent(UPLINK_DEBUG_EID, CFE_EVS_EventType_INFORMATION, "UPLINK: Read %d bytes from socket",Status);
-         Uplink->RecvMsgCnt++;
-         if (Uplink->MsgTunnel.Enabled) ProcessMsgTunnelMap();
+         if (MsgLen >= sizeof(CFE_MSG_CommandHeader_t) && MsgLen <= UPLINK_RECV_BUFF_LEN) {
+         
+            Uplink->RecvMsgCnt++;
+            if (Uplink->MsgTunnel.Enabled) ProcessMsgTunnelMap(&SbBufPtr->Msg);
 
-         Status = CFE_SB_TransmitMsg( (void *)&(RecvCmdMsg->CmdHeader.Msg), false); //~TODO - cfe7.0 (CFE_SB_Buffer_t*)
-         //~Status = CFE_SB_TransmitBuffer( Uplink->RecvSbBufPtr, false); 
+            Status = CFE_SB_TransmitBuffer(SbBufPtr, false); 
 
-         if (Status == CFE_SUCCESS) {
-           
-            Uplink->RecvSbBufPtr = NULL;
+            if (Status == CFE_SUCCESS) {
+            
+               /* SB owns the buffer now, a new one is allocated for the next read */
+               Uplink->RecvSbBufPtr[i] = NULL;
+            
+            }   
+            else {
+
+               CFE_EVS_SendEvent(UPLINK_SEND_SB_MSG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                "UPLINK CFE_SB_TransmitBuffer() failed, Status = 0x%X", (int)Status);
+            }
          
-         }   
+         } /* End if valid len range */
          else {
-
-            CFE_EVS_SendEvent(UPLINK_SEND_SB_MSG_ERR_EID, CFE_EVS_EventType_ERROR,
-                             "UPLINK CFE_SB_TransmitBuffer() failed, Status = 0x%X", (int)Status);
+            
+            Uplink->RecvMsgErrCnt++;
+            MsgBytes = SbBufPtr->Msg.Byte;
+            CFE_EVS_SendEvent(UPLINK_RECV_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "UPLINK: Command dropped, Bad length %d. Bytes: 0x%02x%02x 0x%02x%02x ", (int)MsgLen,
+                               MsgBytes[0], MsgBytes[1], MsgBytes[2], MsgBytes[3]);
          }
-      
-      } /* End if valid len range */
-      else if (Status > 0) {
-         
-         Uplink->RecvMsgErrCnt++;
-         MsgBytes = Uplink->RecvSbBufPtr->Msg.Byte;
-         CFE_EVS_SendEvent(UPLINK_RECV_ERR_EID, CFE_EVS_EventType_ERROR,
-                           "UPLINK: Command dropped, Bad length %d. Bytes: 0x%02x%02x 0x%02x%02x ", (int)Status,
-                            MsgBytes[0], MsgBytes[1], MsgBytes[2], MsgBytes[3]);
-         
-         //~ TODO - cfe7.0 Format header
-         /*
-         CFE_EVS_SendEvent(UPLINK_RECV_ERR_EID,CFE_EVS_EventType_ERROR,
-                           "UPLINK: Command dropped, Bad length %d. Header: 0x%02x%2x 0x%02x%2x 0x%02x%2x 0x%02x%2x", (int)Status,
-                		         Uplink->RecvBuff[0], Uplink->RecvBuff[1], Uplink->RecvBuff[2], Uplink->RecvBuff[3],
-                              Uplink->RecvBuff[4], Uplink->RecvBuff[5], Uplink->RecvBuff[6], Uplink->RecvBuff[7]);
-         */
-      }
-      else {
-         break; /* no (more) messages */
-      }
 
+      } /* End message loop */
+
+      MsgRead += RecvCnt;
+      
+      if (RecvCnt < BufCnt) break; /* socket drained */
+      
    } /* End receive loop */
 
-   return i;
+   return MsgRead;
 
 } /* End UPLINK_Read() */
 
@@ -282,32 +260,79 @@ void UPLINK_ResetStatus()
 static void DestructorCallback(void)
 {
 
+   int i;
+   
    CFE_EVS_SendEvent(UPLINK_DESTRUCTOR_EID, CFE_EVS_EventType_INFORMATION, 
                      "UPLINK: UPLINK deleting callback. Closing Network socket.");
 
    OS_close(Uplink->SocketId);
 
+   for (i=0; i < UPLINK_RECV_BUFF_CNT; i++) {
+   
+      if (Uplink->RecvSbBufPtr[i] != NULL) {
+         
+         CFE_SB_ReleaseMessageBuffer(Uplink->RecvSbBufPtr[i]);
+         Uplink->RecvSbBufPtr[i] = NULL;
+      }
+   }
+   
 } /* End DestructorCallback() */
 
+
+/******************************************************************************
+** Function: LoadRecvBufs
+**
+** Make sure the first MaxBufCnt receive slots (limited to UPLINK_RECV_BUFF_CNT)
+** have an SB buffer and return the number of slots that can be used. Buffers
+** that weren't transmitted by the previous read are reused.
+**
+*/
+static uint16 LoadRecvBufs(uint16 MaxBufCnt)
+{
+
+   uint16 i;
+   
+   if (MaxBufCnt > UPLINK_RECV_BUFF_CNT) MaxBufCnt = UPLINK_RECV_BUFF_CNT;
+   
+   for (i=0; i < MaxBufCnt; i++) {
+   
+      if (Uplink->RecvSbBufPtr[i] == NULL) {
+      
+         Uplink->RecvSbBufPtr[i] = CFE_SB_AllocateMessageBuffer(UPLINK_RECV_BUFF_LEN);
+      
+         if (Uplink->RecvSbBufPtr[i] == NULL) {
+         
+            CFE_EVS_SendEvent(UPLINK_SB_BUF_ALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "UPLINK: Failed to allocate SB buffer of length %d", UPLINK_RECV_BUFF_LEN);
+            break;
+         }
+      }
+      
+      Uplink->RecvBuf[i].Buffer = Uplink->RecvSbBufPtr[i];
+      Uplink->RecvBuf[i].BufLen = UPLINK_RECV_BUFF_LEN;
+   
+   } /* End buffer loop */
+   
+   return i;
+   
+} /* End LoadRecvBufs() */
+
 /******************************************************************************
 ** Function: ProcessMsgTunnelMap
 **
 ** This function should only be called if message tunneling is enabled in order
 ** to save processing time. It loops thru the message tunnel map and if the
-** current input message idea is matched and the mapping is enabled then the
+** input message ID is matched and the mapping is enabled then the
 ** message ID is replaced.
 **
 */
-static void ProcessMsgTunnelMap(void)
+static void ProcessMsgTunnelMap(CFE_MSG_Message_t* MsgPtr)
 {
 
    int  i;
    CFE_SB_MsgId_t     OrgMsgId;
-   CFE_MSG_Message_t* MsgPtr;
    
 
-   MsgPtr = &((Uplink->RecvMsg[Uplink->RecvMsgIdx]).CmdHeader.Msg);
-   
    CFE_MSG_GetMsgId(MsgPtr, &OrgMsgId);
    
    for (i=0; i < UPLINK_MSG_TUNNEL_CNT; i++) {
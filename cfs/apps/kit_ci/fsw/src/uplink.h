@@ -2,7 +2,12 @@
 ** Purpose: Manage the uplink socket
 **
 ** Notes:
-**   1. The "message tunnel" is a simple feature that allows a user to intercept a message and replace the
+**   1. Commands are read from the socket in batches directly into SB buffers
+**      that are preallocated with CFE_SB_AllocateMessageBuffer() and then sent
+**      with CFE_SB_TransmitBuffer() so there is no copy between the socket and
+**      the software bus. A buffer that isn't transmitted is kept for the next
+**      read.
+**   2. The "message tunnel" is a simple feature that allows a user to intercept a message and replace the
 **      message ID. This is handy for testing.  The new message can be routed to a test application that
 **      can manipulate the packet and if needed put back the original message IF so the modified packet gets
 **      routed to the original destination. An example would be testing a file transport protocol and the user
@@ -49,7 +54,8 @@
 #define UPLINK_CFG_MSG_TUNNEL_DIS_EID      (UPLINK_BASE_EID +  6)
 #define UPLINK_CFG_MSG_TUNNEL_IDX_ERR_EID  (UPLINK_BASE_EID +  7)
 #define UPLINK_DESTRUCTOR_EID              (UPLINK_BASE_EID +  8) 
-#define UPLINK_DEBUG_EID                   (UPLINK_BASE_EID +  9)
+/* (UPLINK_BASE_EID +  9) was UPLINK_DEBUG_EID, retired so ground event definitions stay unambiguous */
+#define UPLINK_SB_BUF_ALLOC_ERR_EID        (UPLINK_BASE_EID + 10)
 
 
 /**********************/
@@ -71,13 +77,6 @@ typedef struct {
 } UPLINK_ConfigMsgTunnelCmdMsg;
 #define UPLINK_CONFIG_MSG_TUNNEL_CMD_DATA_LEN  (sizeof(UPLINK_ConfigMsgTunnelCmdMsg) - CFE_SB_CMD_HDR_SIZE)
 
-typedef struct {
-
-   CFE_MSG_CommandHeader_t  CmdHeader;
-   uint8    Payload[UPLINK_RECV_BUFF_LEN];
-   
-} UPLINK_SocketRecvCmdMsg;
-
 
 /******************************************************************************
 ** Message Tunnel
@@ -121,9 +120,8 @@ typedef struct {
 
    uint32   RecvMsgCnt;
    uint32   RecvMsgErrCnt;
-   uint32   RecvMsgIdx;
-   UPLINK_SocketRecvCmdMsg RecvMsg[UPLINK_RECV_BUFF_CNT];
-   CFE_SB_Buffer_t *RecvSbBufPtr;  // CI_LAB proto
+   CFE_SB_Buffer_t  *RecvSbBufPtr[UPLINK_RECV_BUFF_CNT];
+   OS_SockRecvBuf_t  RecvBuf[UPLINK_RECV_BUFF_CNT];
 
    UPLINK_MsgTunnel MsgTunnel;
 
@@ -168,6 +166,10 @@ void UPLINK_Constructor(UPLINK_Class*  UplinkPtr, uint16 Port);
 **
 ** Read up to MaxMsgRead messages and return the number of messages read.
 **
+** Notes:
+**   1. Each socket read receives up to UPLINK_RECV_BUFF_CNT messages with one
+**      call to OS_SocketRecvFromMulti().
+**
 */
 int UPLINK_Read(uint16 MaxMsgRead);
 
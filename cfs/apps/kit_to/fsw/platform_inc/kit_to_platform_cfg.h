@@ -46,6 +46,15 @@
 
 #define  KIT_TO_TLM_PORT  1235
 
+/*
+** Telemetry packet packing. When true, consecutive telemetry packets are
+** concatenated into UDP datagrams of at most KIT_TO_TLM_MAX_DATAGRAM_LEN bytes
+** and the ground system splits them using the CCSDS packet length. The default
+** length fits a 1500 byte Ethernet MTU after the IPv4 and UDP headers.
+*/
+#define  KIT_TO_TLM_PACK_PKTS          false
+#define  KIT_TO_TLM_MAX_DATAGRAM_LEN   1472
+
 #define  KIT_TO_DEF_PKTTBL_FILENAME  "/cf/osk_to_pkt_tbl.json"
 
 #endif /* _kit_to_platform_cfg_ */
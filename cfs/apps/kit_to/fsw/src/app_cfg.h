@@ -40,10 +40,11 @@
 **       11-bit AppId range. Reorder command function codes to group pktmgr and
 **       app level commands
 ** 2.1 - Added event log playback
+** 2.2 - Batched telemetry downlink with optional packet packing
 */
 
 #define  KIT_TO_MAJOR_VER     2
-#define  KIT_TO_MINOR_VER     1
+#define  KIT_TO_MINOR_VER     2
 
 
 #define  KIT_TO_CMD_PIPE_DEPTH    10
@@ -108,6 +109,10 @@
 #define PKTMGR_PIPE_DEPTH  50
 #define PKTMGR_PIPE_NAME   "KIT_TO_PKT_PIPE"
 
+#define PKTMGR_RECV_BATCH_MAX  16  /* Max packets read from the pipe and sent with one socket call */
+
+#define PKTMGR_FILTER_BENCHMARK_PKTS  100000  /* Packets evaluated by the test filter command's timing pass */
+
 /*
 ** Statistics
 */
@@ -213,6 +213,9 @@ bool KIT_TO_SetRunLoopDelayCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr
 /******************************************************************************
 ** Function: KIT_TO_TestFilterCmd
 **
+** Notes:
+**   1. The final pass times PKTMGR_FILTER_BENCHMARK_PKTS evaluations of the
+**      compiled sequence count filter used on the telemetry output path.
 */
 bool KIT_TO_TestFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
 {
@@ -225,6 +228,11 @@ bool KIT_TO_TestFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
    CFE_TIME_SysTime_t      DeltaTime;
    KIT_TO_DataTypePkt      TestPkt;  /* Only using the header so actual packet doesn't matter */
    PktUtil_Filter          Filter;
+   PktUtil_CompiledFilter  CompiledFilter;
+   uint32                  i;
+   uint32                  FilteredCnt = 0;
+   OS_time_t               StartTime;
+   OS_time_t               StopTime;
  
    
    Filter.Type  = PKTUTIL_FILTER_BY_SEQ_CNT;
@@ -280,6 +288,23 @@ bool KIT_TO_TestFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
 
    }
 
+   Filter.Type = PKTUTIL_FILTER_BY_SEQ_CNT;
+   PktUtil_CompileFilter(&CompiledFilter, &Filter);
+
+   OS_GetLocalTime(&StartTime);
+   for (i=0; i < PKTMGR_FILTER_BENCHMARK_PKTS; i++) {
+      
+      CFE_MSG_SetSequenceCount(&(TestPkt.TlmHeader.Msg), i & 0x3FFF);
+      FilteredCnt += PktUtil_IsPacketFilteredCompiled((const CFE_SB_Buffer_t*)&TestPkt, &CompiledFilter);
+   
+   }
+   OS_GetLocalTime(&StopTime);
+
+   CFE_EVS_SendEvent(KIT_TO_TEST_FILTER_EID, CFE_EVS_EventType_INFORMATION,
+                     "Compiled sequence count filter: %d of %d packets filtered in %d usec (includes setting the sequence count)",
+                     (int)FilteredCnt, PKTMGR_FILTER_BENCHMARK_PKTS,
+                     (int)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(StopTime, StartTime)));
+
    return true;
 
 } /* End KIT_TO_TestFilterCmd() */
@@ -43,6 +43,8 @@ static void  DestructorCallback(void);
 static void  FlushTlmPipe(void);
 static int32 SubscribeNewPkt(PKTTBL_Pkt* NewPkt);
 static void  ComputeStats(uint16 PktsSent, uint32 BytesSent);
+static uint32 LoadDatagrams(CFE_SB_Buffer_t* SbBufPtr[], uint32 SbBufCnt);
+static bool  CompileFilter(CFE_MSG_ApId_t ApId);
 
 
 /******************************************************************************
@@ -52,16 +54,22 @@ static void  ComputeStats(uint16 PktsSent, uint32 BytesSent);
 void PKTMGR_Constructor(PKTMGR_Class*  PktMgrPtr, const char* PipeName, uint16 PipeDepth)
 {
 
+   CFE_MSG_ApId_t ApId;
+
    PktMgr = PktMgrPtr;
 
    PktMgr->DownlinkOn   = false;
    PktMgr->SuppressSend = true;
    PktMgr->TlmSockId    = 0;
    strncpy(PktMgr->TlmDestIp, "000.000.000.000", PKTMGR_IP_STR_LEN);
+   OS_SocketAddrInit(&PktMgr->TlmSockAddr, OS_SocketDomain_INET);
 
    PKTMGR_InitStats(KIT_TO_RUN_LOOP_DELAY_MS,PKTMGR_STATS_STARTUP_INIT_MS);
 
    PKTTBL_SetTblToUnused(&(PktMgr->Tbl));
+   for (ApId=0; ApId < PKTTBL_MAX_APP_ID; ApId++) {
+      CompileFilter(ApId);
+   }
 
    CFE_SB_CreatePipe(&(PktMgr->TlmPipe), PipeDepth, PipeName);
    
@@ -127,60 +135,71 @@ void PKTMGR_InitStats(uint16 OutputTlmInterval, uint16 InitDelay)
 /******************************************************************************
 ** Function: PKTMGR_OutputTelemetry
 **
+** Notes:
+**   1. If the socket only queues part of a batch the remaining datagrams are
+**      resent for as long as each send makes progress. Output is suppressed
+**      only when the first send of a batch fails. A batch that stops part way
+**      drops its remaining datagrams but output continues with the next batch.
+**   2. Only packets and bytes of datagrams that were sent are counted.
 */
 uint16 PKTMGR_OutputTelemetry(void)
 {
 
-   OS_SockAddr_t    SockAddr;
    int32            OsStatus;
    int32            SbStatus;
-   size_t           MsgSize;
-   CFE_SB_Buffer_t *SbBufPtr;
-   CFE_MSG_ApId_t   ApId;
+   CFE_SB_Buffer_t *SbBufPtr[PKTMGR_RECV_BATCH_MAX];
+   uint32           SbBufCnt;
+   uint32           DgramCnt;
+   uint32           DgramSent;
+   uint32           i;
    uint16           NumPktsOutput  = 0;
    uint32           NumBytesOutput = 0;
    
    
-   OS_SocketAddrInit(&SockAddr, OS_SocketDomain_INET);
-   OS_SocketAddrSetPort(&SockAddr, KIT_TO_TLM_PORT);
-   OS_SocketAddrFromString(&SockAddr, PktMgr->TlmDestIp);
-   OsStatus = 0;
-
    do {
        
-      SbStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, PktMgr->TlmPipe, CFE_SB_POLL);
+      /* Pull everything waiting on the pipe (up to a batch) with one SB lock round trip */
+      SbStatus = CFE_SB_ReceiveBufferBatch(SbBufPtr, PKTMGR_RECV_BATCH_MAX, &SbBufCnt, PktMgr->TlmPipe, CFE_SB_POLL);
 
-      if ( (SbStatus == CFE_SUCCESS) && (PktMgr->SuppressSend == false) ) {
+      if ( (SbBufCnt > 0) && PktMgr->DownlinkOn && (PktMgr->SuppressSend == false) ) {
            
-         CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgSize);
+         DgramCnt  = LoadDatagrams(SbBufPtr, SbBufCnt);
+         DgramSent = 0;
 
-         if(PktMgr->DownlinkOn) {
+         while (DgramSent < DgramCnt) {
             
-            CFE_MSG_GetApId(&(SbBufPtr->Msg), &ApId);
-            
-            if (!PktUtil_IsPacketFiltered(SbBufPtr, &(PktMgr->Tbl.Pkt[ApId].Filter))) {
-               
-               OsStatus = OS_SocketSendTo(PktMgr->TlmSockId, SbBufPtr, MsgSize, &SockAddr);
-          
-               ++NumPktsOutput;
-               NumBytesOutput += MsgSize;
+            OsStatus = OS_SocketSendToMulti(PktMgr->TlmSockId, &PktMgr->Dgram[DgramSent], (DgramCnt - DgramSent),
+                                            &PktMgr->TlmSockAddr);
+         
+            if (OsStatus <= 0) break;
 
-            } /* End if packet is not filtered */
+            for (i=DgramSent; i < (DgramSent + (uint32)OsStatus); i++) {
+               NumPktsOutput  += PktMgr->DgramPktCnt[i];
+               NumBytesOutput += PktMgr->Dgram[i].BufLen;
+            }
+            DgramSent += (uint32)OsStatus;
 
-         }
-         else {
-            OsStatus = 0;
-         }
-         
-         if (OsStatus < 0) {
+         } /* End while datagrams to send */
+
+         if (DgramSent < DgramCnt) {
+            
+            if (DgramSent == 0 && OsStatus < 0) {
                 
-            CFE_EVS_SendEvent(PKTMGR_SOCKET_SEND_ERR_EID,CFE_EVS_EventType_ERROR,
-                              "Error sending packet on socket %s, port %d, status %d. Tlm output suppressed\n",
-                              PktMgr->TlmDestIp, KIT_TO_TLM_PORT, OsStatus);
-            PktMgr->SuppressSend = true;
-         
-         }
-      } /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
+               CFE_EVS_SendEvent(PKTMGR_SOCKET_SEND_ERR_EID,CFE_EVS_EventType_ERROR,
+                                 "Error sending packet on socket %s, port %d, status %d. Tlm output suppressed\n",
+                                 PktMgr->TlmDestIp, KIT_TO_TLM_PORT, OsStatus);
+               PktMgr->SuppressSend = true;
+            
+            }
+            else {
+
+               CFE_EVS_SendEvent(PKTMGR_SOCKET_SEND_ERR_EID,CFE_EVS_EventType_ERROR,
+                                 "Socket %s, port %d only sent %d of %d datagrams, status %d\n",
+                                 PktMgr->TlmDestIp, KIT_TO_TLM_PORT, (int)DgramSent, (int)DgramCnt, OsStatus);
+            
+            }
+         } /* End if datagrams not sent */
+      } /* If SbBufCnt == 0, then no packet was received from CFE_SB_ReceiveBufferBatch() */
    
    } while (SbStatus == CFE_SUCCESS);
 
@@ -212,6 +231,14 @@ bool PKTMGR_LoadTbl(PKTTBL_Tbl* NewTbl)
 
    for (ApId=0; ApId < PKTTBL_MAX_APP_ID; ApId++) {
 
+      if (!CompileFilter(ApId)) {
+         
+         CFE_EVS_SendEvent(PKTMGR_LOAD_TBL_FILTER_ERR_EID,CFE_EVS_EventType_ERROR,
+                           "Invalid filter (Type,N,X,O) (%d,%d,%d,%d) for table entry %d. Packet will always be filtered",
+                           PktMgr->Tbl.Pkt[ApId].Filter.Type, PktMgr->Tbl.Pkt[ApId].Filter.Param.N,
+                           PktMgr->Tbl.Pkt[ApId].Filter.Param.X, PktMgr->Tbl.Pkt[ApId].Filter.Param.O, ApId);
+      }
+      
       if (PktMgr->Tbl.Pkt[ApId].StreamId != PKTTBL_UNUSED_MSG_ID) {
          
          ++PktCnt;
@@ -260,6 +287,13 @@ bool PKTMGR_LoadTblEntry(CFE_MSG_ApId_t ApId, PKTTBL_Pkt* PktArray)
 
    CFE_PSP_MemCpy(NewPkt,&PktArray[ApId],sizeof(PKTTBL_Pkt));
 
+   if (!CompileFilter(ApId)) {
+      
+      CFE_EVS_SendEvent(PKTMGR_LOAD_TBL_FILTER_ERR_EID,CFE_EVS_EventType_ERROR,
+                        "Invalid filter (Type,N,X,O) (%d,%d,%d,%d) for table entry %d. Packet will always be filtered",
+                        NewPkt->Filter.Type, NewPkt->Filter.Param.N, NewPkt->Filter.Param.X, NewPkt->Filter.Param.O, ApId);
+   }
+
    Status = SubscribeNewPkt(NewPkt);
    
    if(Status == CFE_SUCCESS) {
@@ -294,6 +328,11 @@ bool PKTMGR_EnableOutputCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
    strncpy(PktMgr->TlmDestIp, EnableOutputCmd->DestIp, PKTMGR_IP_STR_LEN);
 
+   /* Build the destination address once rather than on every output cycle */
+   OS_SocketAddrInit(&PktMgr->TlmSockAddr, OS_SocketDomain_INET);
+   OS_SocketAddrSetPort(&PktMgr->TlmSockAddr, KIT_TO_TLM_PORT);
+   OS_SocketAddrFromString(&PktMgr->TlmSockAddr, PktMgr->TlmDestIp);
+
    PktMgr->SuppressSend = false;
 
    /*
@@ -339,6 +378,7 @@ bool PKTMGR_AddPktCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
 
    const PKTMGR_AddPktCmdMsg *AddPktCmd = (const PKTMGR_AddPktCmdMsg *) SbBufPtr;
    PKTTBL_Pkt     NewPkt;
+   PktUtil_CompiledFilter NewFilter;
    bool           RetStatus = true;
    int32          Status;
    CFE_MSG_ApId_t ApId;
@@ -346,19 +386,28 @@ bool PKTMGR_AddPktCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
    ApId = AddPktCmd->StreamId & PKTTBL_APP_ID_MASK;
    
-   if (PktMgr->Tbl.Pkt[ApId].StreamId == PKTTBL_UNUSED_MSG_ID) {
-      
-      NewPkt.StreamId     = AddPktCmd->StreamId;
-      NewPkt.Qos          = AddPktCmd->Qos;
-      NewPkt.BufLim       = AddPktCmd->BufLim;
-      NewPkt.Filter.Type  = AddPktCmd->FilterType;
-      NewPkt.Filter.Param = AddPktCmd->FilterParam;
+   NewPkt.StreamId     = AddPktCmd->StreamId;
+   NewPkt.Qos          = AddPktCmd->Qos;
+   NewPkt.BufLim       = AddPktCmd->BufLim;
+   NewPkt.Filter.Type  = AddPktCmd->FilterType;
+   NewPkt.Filter.Param = AddPktCmd->FilterParam;
+   
+   if (!PktUtil_CompileFilter(&NewFilter, &NewPkt.Filter)) {
+   
+      CFE_EVS_SendEvent(PKTMGR_ADD_PKT_ERROR_EID, CFE_EVS_EventType_ERROR,
+                        "Error adding packet 0x%04X. Invalid filter (Type,N,X,O) (%d,%d,%d,%d)",
+                        AddPktCmd->StreamId, AddPktCmd->FilterType, AddPktCmd->FilterParam.N,
+                        AddPktCmd->FilterParam.X, AddPktCmd->FilterParam.O);
    
+   } /* End if invalid filter */
+   else if (PktMgr->Tbl.Pkt[ApId].StreamId == PKTTBL_UNUSED_MSG_ID) {
+      
       Status = SubscribeNewPkt(&NewPkt);
    
       if (Status == CFE_SUCCESS) {
 
          PktMgr->Tbl.Pkt[ApId] = NewPkt;
+         PktMgr->Filter[ApId]  = NewFilter;
       
          CFE_EVS_SendEvent(PKTMGR_ADD_PKT_SUCCESS_EID, CFE_EVS_EventType_INFORMATION,
                            "Added packet 0x%04X, QoS (%d,%d), BufLim %d",
@@ -417,6 +466,7 @@ bool PKTMGR_RemoveAllPktsCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
          }
 
          PKTTBL_SetPacketToUnused(&(PktMgr->Tbl.Pkt[ApId]));
+         CompileFilter(ApId);
 
       } /* End if packet in use */
 
@@ -462,6 +512,7 @@ bool PKTMGR_RemovePktCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
    if ( PktMgr->Tbl.Pkt[ApId].StreamId != PKTTBL_UNUSED_MSG_ID) {
 
       PKTTBL_SetPacketToUnused(&(PktMgr->Tbl.Pkt[ApId]));
+      CompileFilter(ApId);
       
       Status = CFE_SB_Unsubscribe(RemovePktCmd->StreamId, PktMgr->TlmPipe);
       if(Status == CFE_SUCCESS)
@@ -539,13 +590,18 @@ bool PKTMGR_UpdateFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
    const PKTMGR_UpdateFilterCmdMsg *UpdateFilterCmd = (const PKTMGR_UpdateFilterCmdMsg *) SbBufPtr;
    bool           RetStatus = false;
    CFE_MSG_ApId_t ApId;
+   PktUtil_Filter NewFilter;
+   PktUtil_CompiledFilter NewCompiledFilter;
 
    
    ApId = UpdateFilterCmd->StreamId & PKTTBL_APP_ID_MASK;
    
+   NewFilter.Type  = UpdateFilterCmd->FilterType;
+   NewFilter.Param = UpdateFilterCmd->FilterParam;
+   
    if (PktMgr->Tbl.Pkt[ApId].StreamId != PKTTBL_UNUSED_MSG_ID) {
       
-      if (PktUtil_IsFilterTypeValid(UpdateFilterCmd->FilterType)) {
+      if (PktUtil_CompileFilter(&NewCompiledFilter, &NewFilter)) {
         
          PktUtil_Filter* TblFilter = &(PktMgr->Tbl.Pkt[ApId].Filter);
          
@@ -556,17 +612,18 @@ bool PKTMGR_UpdateFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
                            UpdateFilterCmd->FilterType,   UpdateFilterCmd->FilterParam.N,
                            UpdateFilterCmd->FilterParam.X,UpdateFilterCmd->FilterParam.O);
                            
-         TblFilter->Type  = UpdateFilterCmd->FilterType;
-         TblFilter->Param = UpdateFilterCmd->FilterParam;         
+         *TblFilter = NewFilter;
+         PktMgr->Filter[ApId] = NewCompiledFilter;
         
          RetStatus = true;
       
-      } /* End if valid packet filter type */
+      } /* End if valid packet filter */
       else {
    
          CFE_EVS_SendEvent(PKTMGR_UPDATE_FILTER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
-                           "Error updating filter for packet 0x%04X. Invalid filter type %d",
-                           UpdateFilterCmd->StreamId, UpdateFilterCmd->FilterType);
+                           "Error updating filter for packet 0x%04X. Invalid filter (Type,N,X,O) (%d,%d,%d,%d)",
+                           UpdateFilterCmd->StreamId, UpdateFilterCmd->FilterType, UpdateFilterCmd->FilterParam.N,
+                           UpdateFilterCmd->FilterParam.X, UpdateFilterCmd->FilterParam.O);
       }
    
    } /* End if packet entry unused */
@@ -706,3 +763,85 @@ static void ComputeStats(uint16 PktsSent, uint32 BytesSent)
    
 
 } /* End ComputeStats() */
+
+
+/******************************************************************************
+** Function:  LoadDatagrams
+**
+** Load the unfiltered packets of a receive batch into the datagram list that
+** is sent with one socket call. Returns the number of datagrams loaded and
+** records the number of packets carried by each datagram.
+**
+** Notes:
+**   1. Without packing each datagram references its SB buffer directly. The
+**      SB buffers stay valid until the next receive from the pipe.
+**   2. With packing, packets are copied into the datagram buffers back to back
+**      and a packet too large for a datagram is sent from its SB buffer.
+*/
+static uint32 LoadDatagrams(CFE_SB_Buffer_t* SbBufPtr[], uint32 SbBufCnt)
+{
+
+   uint32          i;
+   uint32          DgramCnt = 0;
+   bool            DgramPacking = false;  /* True when the last datagram is a packing buffer */
+   bool            PktPassed[PKTMGR_RECV_BATCH_MAX];
+   size_t          MsgSize;
+   OS_SockBuf_t*   Dgram;
+   
+   if (PktUtil_FilterPacketBatch(SbBufPtr, SbBufCnt, PktMgr->Filter, PKTTBL_MAX_APP_ID, PktPassed) == 0) return 0;
+   
+   for (i=0; i < SbBufCnt; i++) {
+      
+      if (!PktPassed[i]) continue;
+      
+      CFE_MSG_GetSize(&SbBufPtr[i]->Msg, &MsgSize);
+         
+      if (KIT_TO_TLM_PACK_PKTS && (MsgSize <= KIT_TO_TLM_MAX_DATAGRAM_LEN)) {
+      
+         if (!DgramPacking || (PktMgr->Dgram[DgramCnt-1].BufLen + MsgSize) > KIT_TO_TLM_MAX_DATAGRAM_LEN) {
+         
+            PktMgr->Dgram[DgramCnt].Buffer = PktMgr->DgramBuf[DgramCnt];
+            PktMgr->Dgram[DgramCnt].BufLen = 0;
+            PktMgr->DgramPktCnt[DgramCnt]  = 0;
+            DgramPacking = true;
+            DgramCnt++;
+         
+         }
+         
+         Dgram = &PktMgr->Dgram[DgramCnt-1];
+         memcpy(&PktMgr->DgramBuf[DgramCnt-1][Dgram->BufLen], SbBufPtr[i], MsgSize);
+         Dgram->BufLen += MsgSize;
+         ++(PktMgr->DgramPktCnt[DgramCnt-1]);
+      
+      }
+      else {
+      
+         PktMgr->Dgram[DgramCnt].Buffer = SbBufPtr[i];
+         PktMgr->Dgram[DgramCnt].BufLen = MsgSize;
+         PktMgr->DgramPktCnt[DgramCnt]  = 1;
+         DgramPacking = false;
+         DgramCnt++;
+      
+      }
+      
+   } /* End packet loop */
+   
+   return DgramCnt;
+   
+} /* End LoadDatagrams() */
+
+
+/******************************************************************************
+** Function: CompileFilter
+**
+** Compile the table filter for ApId into the filter used on the packet path.
+** Returns false if the table filter is invalid in which case the packet is
+** always filtered.
+*/
+static bool CompileFilter(CFE_MSG_ApId_t ApId)
+{
+
+   return PktUtil_CompileFilter(&(PktMgr->Filter[ApId]), &(PktMgr->Tbl.Pkt[ApId].Filter));
+
+} /* End CompileFilter() */
+
@@ -52,6 +52,7 @@
 #define PKTMGR_UPDATE_FILTER_CMD_SUCCESS_EID     (PKTMGR_BASE_EID + 15)
 #define PKTMGR_UPDATE_FILTER_CMD_ERR_EID         (PKTMGR_BASE_EID + 16)
 #define PKTMGR_DEBUG_EID                         (PKTMGR_BASE_EID + 17)
+#define PKTMGR_LOAD_TBL_FILTER_ERR_EID           (PKTMGR_BASE_EID + 18)
 
 
 /*
@@ -176,12 +177,18 @@ typedef struct {
    CFE_SB_PipeId_t   TlmPipe;
    osal_id_t         TlmSockId;
    char              TlmDestIp[PKTMGR_IP_STR_LEN];
+   OS_SockAddr_t     TlmSockAddr;  /* Built from TlmDestIp when output is enabled */
+
+   OS_SockBuf_t      Dgram[PKTMGR_RECV_BATCH_MAX];  /* Datagrams sent in one output cycle */
+   uint8             DgramBuf[PKTMGR_RECV_BATCH_MAX][KIT_TO_TLM_MAX_DATAGRAM_LEN]; /* Packed datagram storage */
+   uint16            DgramPktCnt[PKTMGR_RECV_BATCH_MAX];  /* Packets carried by each datagram */
 
    bool              DownlinkOn;
    bool              SuppressSend;
    PKTMGR_Stats      Stats;
 
    PKTTBL_Tbl        Tbl;
+   PktUtil_CompiledFilter  Filter[PKTTBL_MAX_APP_ID];  /* Compiled from Tbl filters when they're loaded */
 
    PKTMGR_PktTlm     PktTlm;
 
@@ -258,7 +265,8 @@ uint16 PKTMGR_OutputTelemetry(void);
 ** loads the entire new table and subscribes to each message.
 **
 ** Notes:
-**   1. No validity checks are performed on the table data.
+**   1. Only the filters are validated. A packet with an invalid filter is
+**      reported and always filtered.
 **   2. Function signature must match PKTTBL_LoadTbl
 **
 */
@@ -296,6 +304,7 @@ bool PKTMGR_EnableOutputCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
 **
 ** Notes:
 **   1. Command rejected if table has existing entry for thecommanded Stream ID
+**      or if the filter is invalid
 **   2. Only update the table if the software bus subscription successful
 ** 
 */
@@ -339,7 +348,7 @@ bool PKTMGR_SendPktTblTlmCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
 **
 ** Notes:
 **   1. Command rejected if AppId packet entry has not been loaded 
-**   2. The filter type is verified but the filter parameter values are not 
+**   2. Command rejected if the filter type or parameters are invalid
 ** 
 */
 bool PKTMGR_UpdateFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
@@ -43,7 +43,6 @@
 #define CHILDMGR_RUNTIME_ERR  0xC0000001  /* See cfe_error.h for fields */
 
 #define CHILDMGR_SEM_INVALID  0xFFFFFFFF
-#define CHILDMGR_MUTEX_NAME   "CHILDMGR_MUTEX_"   /* A number will be appended for each child task*/
 #define CHILDMGR_CNTSEM_NAME  "CHILDMGR_CNTSEM_"  /* A number will be appended for each child task*/
 
 /*
@@ -82,6 +81,11 @@ typedef struct {
 
 /*
 ** Command Queue
+**
+** Single producer (parent app) and single consumer (child task) ring. Each
+** side owns its index and publishes progress through a free-running counter
+** so the two tasks never need a lock. PutCnt - DoneCnt is the number of
+** commands queued including the one the child is executing.
 */
 
 
@@ -95,11 +99,11 @@ typedef struct {
 
 typedef struct {
 
-   uint32  Mutex;
-   uint8   WriteIndex;
-   uint8   ReadIndex;
-   uint8   Count;
-   uint8   Spare;
+   uint32  PutCnt;         /* Only written by the parent */
+   uint32  DoneCnt;        /* Only written by the child  */
+   uint8   WriteIndex;     /* Parent's next entry        */
+   uint8   ReadIndex;      /* Child's current entry      */
+   uint8   Spare[2];
    
    CHILDMGR_CmdQ_Entry  Entry[CHILDMGR_CMD_Q_ENTRIES];
 
@@ -196,10 +200,20 @@ void CHILDMGR_ResetStatus(CHILDMGR_Class* ChildMgr);
 ** Notes:
 **   1. This command function is registered with the app's cmdmgr with all of
 **      the function codes that use the child task to process the command.
+**   2. The child task is only signalled when the queue was empty. Commands
+**      queued while the child is busy are picked up when it finishes.
 */
 bool CHILDMGR_InvokeChildCmd(void* ObjDataPtr, const CFE_SB_Buffer_t*  SbBufPtr);
 
 
+/******************************************************************************
+** Function: CHILDMGR_GetCmdQueueCount
+** 
+** Return the number of queued commands including the one being executed.
+*/
+uint8 CHILDMGR_GetCmdQueueCount(const CHILDMGR_Class* ChildMgr);
+
+
 /******************************************************************************
 ** Function: CHILDMGR_PauseTask
 ** 
@@ -2,7 +2,9 @@
 ** Purpose: Manage command dispatching for an application
 **
 ** Notes:
-**   None
+**   1. Each function code owns a dispatch descriptor whose expected message
+**      size and checksum policy are resolved at registration so dispatching
+**      a command is one bounds-checked table lookup plus one size compare.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -40,6 +42,20 @@
 
 typedef bool (*CMDMGR_CmdFuncPtr) (void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
 
+/*
+** Checksum policy applied when a command is dispatched. Commands default to
+** CMDMGR_CHECKSUM_VALIDATE. CMDMGR_CHECKSUM_IGNORE is intended for high rate
+** commands from onboard apps whose integrity is already assured by the
+** software bus.
+*/
+typedef enum
+{
+
+   CMDMGR_CHECKSUM_VALIDATE = 0,
+   CMDMGR_CHECKSUM_IGNORE   = 1
+
+} CMDMGR_ChecksumPolicy;
+
 /*
 ** Alternate command counters allow an individual command to have its own 
 ** counters. The class counters are not incremented for the command. This
@@ -58,16 +74,20 @@ typedef struct
 /*
 ** Objects register their command functions so each command structure
 ** contains a pointer to the object's data and to the command function.
+** MsgSize is the total message size (header plus user data) computed when
+** the function is registered so dispatch never derives it per command.
 */
 
 typedef struct
 {
 
    uint16             UserDataLen;    /* User data length in bytes  */
+   CFE_MSG_Size_t     MsgSize;        /* Expected total message size in bytes */
    void*              DataPtr;
    CMDMGR_CmdFuncPtr  FuncPtr; 
 
-   CMDMGR_AltCnt      AltCnt;
+   CMDMGR_ChecksumPolicy  ChecksumPolicy;
+   CMDMGR_AltCnt          AltCnt;
 
 } CMDMGR_Cmd;
 
@@ -112,6 +132,17 @@ bool    CMDMGR_RegisterFuncAltCnt(CMDMGR_Class* CmdMgr, uint16 FuncCode, void* O
                                   CMDMGR_CmdFuncPtr ObjFuncPtr, uint16 UserDataLen);
 
 
+/******************************************************************************
+** Function: CMDMGR_SetChecksumPolicy
+**
+** Change the checksum policy of a registered command function. Must be called
+** after the function is registered because registering restores the default
+** CMDMGR_CHECKSUM_VALIDATE policy.
+*/
+bool CMDMGR_SetChecksumPolicy(CMDMGR_Class* CmdMgr, uint16 FuncCode, 
+                              CMDMGR_ChecksumPolicy ChecksumPolicy);
+
+
 /******************************************************************************
 ** Function: CMDMGR_ResetStatus
 **
@@ -122,10 +153,24 @@ void CMDMGR_ResetStatus(CMDMGR_Class* CmdMgr);
 /******************************************************************************
 ** Function: CMDMGR_DispatchFunc
 **
+** Notes:
+**   1. Invalid function codes only increment the class invalid command
+**      counter since they have no descriptor.
 */
 bool CMDMGR_DispatchFunc(CMDMGR_Class* CmdMgr, const CFE_SB_Buffer_t*  SbBufPtr);
 
 
+/******************************************************************************
+** Function: CMDMGR_Benchmark
+**
+** Dispatch CmdCnt synthetic commands through a private command manager
+** instance, once with each checksum policy, and report the average dispatch
+** time using OS_printf(). Called by OSK_C_FW_LibInit() when
+** CMDMGR_BENCHMARK_CMD_CNT is non-zero.
+*/
+void CMDMGR_Benchmark(uint32 CmdCnt);
+
+
 /******************************************************************************
 ** Function: CMDMGR_ValidBoolArg
 **
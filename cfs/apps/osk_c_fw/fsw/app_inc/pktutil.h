@@ -4,6 +4,11 @@
 ** Notes:
 **   1. PktUtil_IsPacketFiltered is taken from cfs_utils. My initial motivation
 **      was the macros defined in C file and not a header and no structures.
+**   2. Apps that filter every packet should compile their filters with
+**      PktUtil_CompileFilter() when the filter is loaded and use the compiled
+**      filter functions on the packet path. Compiling validates the filter
+**      parameters once and replaces the modulo divide with a mask or a
+**      multiply by a precomputed reciprocal.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -77,6 +82,26 @@ typedef struct {
 
 } PktUtil_Filter;
 
+/*
+** Filter with validated parameters ready for per packet evaluation. A filter
+** with invalid parameters compiles to PKTUTIL_FILTER_ALWAYS which matches 
+** PktUtil_IsPacketFiltered()'s treatment of invalid parameters. 
+** 
+** When X is a power of two the group remainder is masked with XMask (X-1)
+** and XRecip is zero. Otherwise XRecip is floor((2^32-1)/X)+1 which gives
+** an exact 16-bit remainder with two multiplies instead of a divide.
+*/
+typedef struct {
+   
+   uint16  Type;   /* PktUtil_FilterType */
+   uint16  N;
+   uint16  X;
+   uint16  O;
+   uint16  XMask;
+   uint32  XRecip;
+
+} PktUtil_CompiledFilter;
+
 /************************/
 /** Exported Functions **/
 /************************/
@@ -89,6 +114,43 @@ typedef struct {
 bool PktUtil_IsPacketFiltered(const CFE_SB_Buffer_t* MessagePtr, const PktUtil_Filter *Filter);
 
 
+/******************************************************************************
+** Function: PktUtil_CompileFilter
+**
+** Validate a filter's parameters and compile it for packet evaluation.
+**
+** Notes:
+**   1. Returns false if the filter type or the parameters of a sequence count
+**      or time filter are invalid. The compiled filter is always usable and
+**      is set to always filter when false is returned.
+*/
+bool PktUtil_CompileFilter(PktUtil_CompiledFilter *CompiledFilter, const PktUtil_Filter *Filter);
+
+
+/******************************************************************************
+** Function: PktUtil_IsPacketFilteredCompiled
+**
+** Same result as PktUtil_IsPacketFiltered() for the filter used to create 
+** the compiled filter.
+*/
+bool PktUtil_IsPacketFilteredCompiled(const CFE_SB_Buffer_t* SbBufPtr, const PktUtil_CompiledFilter *Filter);
+
+
+/******************************************************************************
+** Function: PktUtil_FilterPacketBatch
+**
+** Evaluate a batch of packets against a table of compiled filters indexed by
+** CCSDS ApId. PktPassed[i] is set to true if SbBufPtr[i] passed its filter 
+** and the number of packets that passed is returned.
+**
+** Notes:
+**   1. A packet with an ApId greater than or equal to FilterCnt is filtered.
+*/
+uint32 PktUtil_FilterPacketBatch(CFE_SB_Buffer_t* const SbBufPtr[], uint32 SbBufCnt, 
+                                 const PktUtil_CompiledFilter *FilterTbl, uint16 FilterCnt, 
+                                 bool PktPassed[]);
+
+
 /******************************************************************************
 ** Function: PktUtil_IsFilterTypeValid
 **
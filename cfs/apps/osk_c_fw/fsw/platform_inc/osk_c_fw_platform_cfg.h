@@ -50,6 +50,17 @@
 #define  INITBL_MAX_CFG_ITEMS  30   /* Max number of JSON ini file configuration items */
 
 
+/******************************************************************************
+** Command Manager (CMDMGR)
+**
+** CMDMGR_BENCHMARK_CMD_CNT is the number of synthetic commands dispatched at
+** library initialization to measure CMDMGR_DispatchFunc() overhead. Zero 
+** disables the benchmark; 1000000 gives a stable per command figure.
+*/
+
+#define CMDMGR_BENCHMARK_CMD_CNT  0
+
+
 /******************************************************************************
 ** Table Manager (TBLMGR)
 */
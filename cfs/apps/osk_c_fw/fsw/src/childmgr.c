@@ -99,32 +99,21 @@ int32 CHILDMGR_Constructor(CHILDMGR_Class* ChildMgr,
    
    if (RetStatus == CFE_SUCCESS) {
       
-      AppendIdToStr(ServiceName, CHILDMGR_MUTEX_NAME);
-      if (DBG_CHILDMGR) OS_printf("CHILDMGR_Constructor() - OS_MutSemCreate(%s)\n", ServiceName);
-      RetStatus = OS_MutSemCreate(&ChildMgr->CmdQ.Mutex, ServiceName, 0);
+      if (DBG_CHILDMGR) OS_printf("CHILDMGR_Constructor() - Before CFE_ES_CreateChildTask\n");
+      RetStatus = CFE_ES_CreateChildTask(&ChildMgr->TaskId,
+                                         TaskInit->TaskName,
+                                         ChildTaskMainFunc, 0,
+                                         TaskInit->StackSize,
+                                         TaskInit->Priority, 0);
+      if (DBG_CHILDMGR) OS_printf("CHILDMGR_Constructor() - After CFE_ES_CreateChildTask. Status=0x%08X\n", RetStatus);
       
-      if (RetStatus == CFE_SUCCESS) {      
-         
-         if (DBG_CHILDMGR) OS_printf("CHILDMGR_Constructor() - Before CFE_ES_CreateChildTask\n");
-         RetStatus = CFE_ES_CreateChildTask(&ChildMgr->TaskId,
-                                            TaskInit->TaskName,
-                                            ChildTaskMainFunc, 0,
-                                            TaskInit->StackSize,
-                                            TaskInit->Priority, 0);
-         if (DBG_CHILDMGR) OS_printf("CHILDMGR_Constructor() - After CFE_ES_CreateChildTask. Status=0x%08X\n", RetStatus);
-         
-         if (RetStatus == CFE_SUCCESS) { 
-                     
-            RegChildMgrInstance(ChildMgr);
-             
-         }
-         else {
-            strcpy(FailedFuncStr, "CFE_ES_CreateChildTask()");
-         }
-         
-      } /* End if Mutex created */
+      if (RetStatus == CFE_SUCCESS) { 
+                  
+         RegChildMgrInstance(ChildMgr);
+          
+      }
       else {
-         strcpy(FailedFuncStr, "OS_MutSemCreate()");
+         strcpy(FailedFuncStr, "CFE_ES_CreateChildTask()");
       }
      
    } /* End if CountSem created */
@@ -189,92 +178,95 @@ void CHILDMGR_ResetStatus(CHILDMGR_Class* ChildMgr)
 **      command processed by the child task must be registered using
 **      CHILDMGR_RegisterFunc() and teh object data pointer must reference
 **      the ChildMgr instance.
+**   2. The entry is copied before PutCnt is published so the child never
+**      sees a partial command. The wake-up semaphore is only given when the
+**      child had completed every queued command, otherwise the child picks
+**      up the new command when it rechecks PutCnt. PutCnt/DoneCnt use
+**      sequentially consistent atomics because each side stores its own
+**      counter and then loads the other's.
 */
 bool CHILDMGR_InvokeChildCmd(void* ObjDataPtr, const CFE_SB_Buffer_t*  SbBufPtr)
 {
 
    bool RetStatus = false;
    CHILDMGR_Class* ChildMgr = (CHILDMGR_Class*)ObjDataPtr;
+   CHILDMGR_CmdQ*  CmdQ = &ChildMgr->CmdQ;
    
-   char EventErrStr[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH] = "\0";
    CFE_MSG_Size_t MsgLen;
-   
-   uint8 LocalQueueCount = ChildMgr->CmdQ.Count; /* Use local instance during checks */
    CFE_MSG_FcnCode_t FuncCode;
    
-   CFE_MSG_GetFcnCode(&SbBufPtr->Msg, &FuncCode);
-   
-   sprintf(EventErrStr, "Error dispatching commmand function %d. Undefined error", FuncCode);
+   uint32 PutCnt  = CmdQ->PutCnt;  /* Only this task writes PutCnt */
+   uint32 DoneCnt = __atomic_load_n(&CmdQ->DoneCnt, __ATOMIC_SEQ_CST);
+   uint32 LocalQueueCount = PutCnt - DoneCnt;
    
-   CFE_EVS_SendEvent(CHILDMGR_DEBUG_EID, CFE_EVS_EventType_DEBUG,
-      "CHILDMGR_InvokeChildCmd() Entry: fc=%d, ChildMgr->WakeUpSemaphore=%d,WriteIdx=%d,ReadIdx=%d,Count=%d\n",
-      FuncCode,ChildMgr->WakeUpSemaphore,ChildMgr->CmdQ.WriteIndex,ChildMgr->CmdQ.ReadIndex,ChildMgr->CmdQ.Count);
+   if (DBG_CHILDMGR) OS_printf("CHILDMGR_InvokeChildCmd() Entry: WriteIdx=%d, PutCnt=%u, DoneCnt=%u\n",
+                               CmdQ->WriteIndex, (unsigned int)PutCnt, (unsigned int)DoneCnt);
+
+   CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgLen);
 
    /*
    ** Verify child task is active and queue interface is healthy
    */
-   if (ChildMgr->WakeUpSemaphore == CHILDMGR_SEM_INVALID) {
+   if ((ChildMgr->WakeUpSemaphore != CHILDMGR_SEM_INVALID) &&
+       (LocalQueueCount < CHILDMGR_CMD_Q_ENTRIES) &&
+       (CmdQ->WriteIndex < CHILDMGR_CMD_Q_ENTRIES) &&
+       (MsgLen <= sizeof(CHILDMGR_CmdQ_Entry))) {
+       
+      memcpy(&(CmdQ->Entry[CmdQ->WriteIndex]), SbBufPtr, MsgLen);
+
+      ++CmdQ->WriteIndex;
+
+      if (CmdQ->WriteIndex >= CHILDMGR_CMD_Q_ENTRIES) {
+         
+         CmdQ->WriteIndex = 0;
       
-      sprintf(EventErrStr, "Error dispatching commmand function %d. Child task is disabled",FuncCode);
+      }
 
-   }
-   else if (LocalQueueCount == CHILDMGR_CMD_Q_ENTRIES) {
+      __atomic_store_n(&CmdQ->PutCnt, PutCnt + 1, __ATOMIC_SEQ_CST);
       
-      sprintf(EventErrStr, "Error dispatching commmand function %d. Child task queue is full",FuncCode);
-    
-   }
-   else if ( (LocalQueueCount > CHILDMGR_CMD_Q_ENTRIES) ||
-             (ChildMgr->CmdQ.WriteIndex >= CHILDMGR_CMD_Q_ENTRIES) ) {
+      /* Only wake the child on the empty to non-empty transition */
+      if (__atomic_load_n(&CmdQ->DoneCnt, __ATOMIC_SEQ_CST) == PutCnt) {
 
-      sprintf(EventErrStr, "Error dispatching commmand function %d. Child task interface is corrupted: Count=%d, Index=%d",
-              FuncCode, LocalQueueCount, ChildMgr->CmdQ.WriteIndex);
+         if (DBG_CHILDMGR) OS_printf("CHILDMGR_InvokeChildCmd() Before OS_CountSemGive(ChildMgr->WakeUpSemaphore=%d)\n",ChildMgr->WakeUpSemaphore);
+         OS_CountSemGive(ChildMgr->WakeUpSemaphore); /* Signal child task to call command handler */
 
+      }
+
+      RetStatus = true;
+      
    }
    else {
-       
-      CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgLen);
       
-      if (MsgLen <= sizeof(CHILDMGR_CmdQ_Entry)) {
-         
-         memcpy(&(ChildMgr->CmdQ.Entry[ChildMgr->CmdQ.WriteIndex]), SbBufPtr, MsgLen);
-
-         ++ChildMgr->CmdQ.WriteIndex;
+      CFE_MSG_GetFcnCode(&SbBufPtr->Msg, &FuncCode);
 
-         if (ChildMgr->CmdQ.WriteIndex >= CHILDMGR_CMD_Q_ENTRIES) {
-            
-            ChildMgr->CmdQ.WriteIndex = 0;
-         
-         }
+      if (ChildMgr->WakeUpSemaphore == CHILDMGR_SEM_INVALID) {
+      
+         CFE_EVS_SendEvent(CHILDMGR_INVOKE_CHILD_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error dispatching commmand function %d. Child task is disabled", FuncCode);
 
-         /* Prevent parent/child updating queue counter at same time */
-         OS_MutSemTake(ChildMgr->CmdQ.Mutex);
-         ++ChildMgr->CmdQ.Count;
-         OS_MutSemGive(ChildMgr->CmdQ.Mutex);
+      }
+      else if (LocalQueueCount == CHILDMGR_CMD_Q_ENTRIES) {
+      
+         CFE_EVS_SendEvent(CHILDMGR_INVOKE_CHILD_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error dispatching commmand function %d. Child task queue is full", FuncCode);
+    
+      }
+      else if ((LocalQueueCount > CHILDMGR_CMD_Q_ENTRIES) ||
+               (CmdQ->WriteIndex >= CHILDMGR_CMD_Q_ENTRIES)) {
 
-         /* Does the child task still have a semaphore? */
-         if (ChildMgr->WakeUpSemaphore != CHILDMGR_SEM_INVALID) {
-            
-           if (DBG_CHILDMGR) OS_printf("CHILDMGR_InvokeChildCmd() Before OS_CountSemGive(ChildMgr->WakeUpSemaphore=%d)\n",ChildMgr->WakeUpSemaphore);
-           OS_CountSemGive(ChildMgr->WakeUpSemaphore); /* Signal child task to call command handler */
-         
-         }
+         CFE_EVS_SendEvent(CHILDMGR_INVOKE_CHILD_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error dispatching commmand function %d. Child task interface is corrupted: Count=%u, Index=%d",
+                           FuncCode, (unsigned int)LocalQueueCount, CmdQ->WriteIndex);
 
-         RetStatus = true   ;
-         
-      }/* End if valid message length */
+      }
       else {
          
-         sprintf(EventErrStr, "Error dispatching commmand function %d. Command message length %d exceed max %d",
-            FuncCode, MsgLen, sizeof(CHILDMGR_CmdQ_Entry));
+         CFE_EVS_SendEvent(CHILDMGR_INVOKE_CHILD_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error dispatching commmand function %d. Command message length %d exceed max %d",
+                           FuncCode, (int)MsgLen, (int)sizeof(CHILDMGR_CmdQ_Entry));
       
       }
-   } /* End if command queue intact */
-
-   if (!RetStatus) {
-      
-      CFE_EVS_SendEvent(CHILDMGR_INVOKE_CHILD_ERR_EID, CFE_EVS_EventType_ERROR, "%s", EventErrStr);
-
-   }
+   } /* End if command can't be queued */
 
    return RetStatus;
 
@@ -282,6 +274,19 @@ bool CHILDMGR_InvokeChildCmd(void* ObjDataPtr, const CFE_SB_Buffer_t*  SbBufPtr)
 } /* End CHILDMGR_InvokeChildCmd() */
 
 
+/******************************************************************************
+** Function: CHILDMGR_GetCmdQueueCount
+** 
+*/
+uint8 CHILDMGR_GetCmdQueueCount(const CHILDMGR_Class* ChildMgr)
+{
+
+   return (uint8)(__atomic_load_n(&ChildMgr->CmdQ.PutCnt, __ATOMIC_RELAXED) -
+                  __atomic_load_n(&ChildMgr->CmdQ.DoneCnt, __ATOMIC_RELAXED));
+
+} /* End CHILDMGR_GetCmdQueueCount() */
+
+
 /******************************************************************************
 ** Function: CHILDMGR_PauseTask
 ** 
@@ -424,29 +429,30 @@ void ChildMgr_TaskMainCmdDispatch(void)
 
          if (ChildMgr->RunStatus == CFE_SUCCESS) {
          
-            /* Check parent/child handshake integrity and terminate main loop if errors */
-            if (ChildMgr->CmdQ.Count == 0) {
+            /* 
+            ** Drain the queue before pending again. The parent only gives
+            ** the semaphore when it finds the queue empty so a wake-up can
+            ** arrive after its command was already dispatched by this loop.
+            */
+            while ((ChildMgr->RunStatus == CFE_SUCCESS) &&
+                   (__atomic_load_n(&ChildMgr->CmdQ.PutCnt, __ATOMIC_SEQ_CST) != ChildMgr->CmdQ.DoneCnt)) {
+
+               /* Check parent/child handshake integrity and terminate main loop if errors */
+               if (ChildMgr->CmdQ.ReadIndex >= CHILDMGR_CMD_Q_ENTRIES) {
+
+                  CFE_EVS_SendEvent(CHILDMGR_INVALID_Q_READ_IDX_EID, CFE_EVS_EventType_ERROR,
+                     "CHILDMGR_Task invoked with a command queue read index of %d that is greater than max %d",
+                     (int)ChildMgr->CmdQ.ReadIndex, (CHILDMGR_CMD_Q_ENTRIES-1));
+
+                  ChildMgr->RunStatus = OS_ERROR;
             
-               CFE_EVS_SendEvent(CHILDMGR_EMPTY_TASK_Q_EID, CFE_EVS_EventType_ERROR,
-                  "CHILDMGR_Task invoked with an empty command queue");
-
-               ChildMgr->RunStatus = OS_ERROR;
-         
-            }
-            else if (ChildMgr->CmdQ.ReadIndex >= CHILDMGR_CMD_Q_ENTRIES) {
-
-               CFE_EVS_SendEvent(CHILDMGR_INVALID_Q_READ_IDX_EID, CFE_EVS_EventType_ERROR,
-                  "CHILDMGR_Task invoked with a command queue read index of %d that is greater than max %d",
-                  (int)ChildMgr->CmdQ.ReadIndex, (CHILDMGR_CMD_Q_ENTRIES-1));
-
-               ChildMgr->RunStatus = OS_ERROR;
-         
-            }
-            else {
+               }
+               else {
+               
+                  DispatchCmdFunc(ChildMgr);
             
-               DispatchCmdFunc(ChildMgr);
-         
-            }
+               }
+            } /* End while commands queued */
       
          } /* End if wake up semaphore successful */
          else {
@@ -506,13 +512,11 @@ static void DispatchCmdFunc(CHILDMGR_Class* ChildMgr)
 
    if (ChildMgr->CmdQ.ReadIndex >= CHILDMGR_CMD_Q_ENTRIES) ChildMgr->CmdQ.ReadIndex = 0;
    
-   OS_MutSemTake(ChildMgr->CmdQ.Mutex);
-   --ChildMgr->CmdQ.Count;
-   OS_MutSemGive(ChildMgr->CmdQ.Mutex);
+   /* Entry is no longer referenced so the parent can reuse it */
+   __atomic_store_n(&ChildMgr->CmdQ.DoneCnt, ChildMgr->CmdQ.DoneCnt + 1, __ATOMIC_SEQ_CST);
 
-   CFE_EVS_SendEvent (CHILDMGR_DEBUG_EID, CFE_EVS_EventType_DEBUG,
-      "DispatchCmdFunc() Exit: ChildMgr->WakeUpSemaphore=%d,WriteIdx=%d,ReadIdx=%d,Count=%d\n",
-      ChildMgr->WakeUpSemaphore,ChildMgr->CmdQ.WriteIndex,ChildMgr->CmdQ.ReadIndex,ChildMgr->CmdQ.Count);
+   if (DBG_CHILDMGR) OS_printf("DispatchCmdFunc() Exit: ReadIdx=%d, DoneCnt=%u\n",
+                               ChildMgr->CmdQ.ReadIndex, (unsigned int)ChildMgr->CmdQ.DoneCnt);
 
 } /* End DispatchCmdFunc() */
 
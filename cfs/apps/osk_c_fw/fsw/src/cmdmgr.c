@@ -27,6 +27,22 @@
 
 ///#define DBG_CMDMGR
 
+#define CMDMGR_BENCHMARK_MID   0x1800  /* Synthetic command is never sent so any command MID works */
+#define CMDMGR_BENCHMARK_FC    CMDMGR_APP_START_FC
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+typedef struct
+{
+
+   CFE_MSG_CommandHeader_t  CmdHeader;
+   uint32                   Data;
+
+} CMDMGR_BenchmarkCmdMsg;
+
 
 /**********************/
 /** Global File Data **/
@@ -44,6 +60,7 @@ static const char* BoolStr[] = {
 /******************************/
 
 static bool UnusedFuncCode(void* ObjDataPtr, const CFE_SB_Buffer_t* MsgPtr);
+static bool BenchmarkFunc(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
 
 
 /******************************************************************************
@@ -52,6 +69,8 @@ static bool UnusedFuncCode(void* ObjDataPtr, const CFE_SB_Buffer_t* MsgPtr);
 ** Notes:
 **    1. This function must be called prior to any other functions being
 **       called using the same cmdmgr instance.
+**    2. Unused function codes expect a command with no user data so their
+**       descriptors resolve to the header size.
 **
 */
 void CMDMGR_Constructor(CMDMGR_Class* CmdMgr)
@@ -63,6 +82,8 @@ void CMDMGR_Constructor(CMDMGR_Class* CmdMgr)
    for (i=0; i < CMDMGR_CMD_FUNC_TOTAL; i++) {
       
       CmdMgr->Cmd[i].FuncPtr = UnusedFuncCode;
+      CmdMgr->Cmd[i].MsgSize = sizeof(CFE_MSG_CommandHeader_t);
+      CmdMgr->Cmd[i].ChecksumPolicy = CMDMGR_CHECKSUM_VALIDATE;
    
    }
 
@@ -85,6 +106,8 @@ bool CMDMGR_RegisterFunc(CMDMGR_Class* CmdMgr, uint16 FuncCode, void* ObjDataPtr
       CmdMgr->Cmd[FuncCode].DataPtr = ObjDataPtr;
       CmdMgr->Cmd[FuncCode].FuncPtr = ObjFuncPtr;
       CmdMgr->Cmd[FuncCode].UserDataLen = UserDataLen;
+      CmdMgr->Cmd[FuncCode].MsgSize     = sizeof(CFE_MSG_CommandHeader_t) + UserDataLen;
+      CmdMgr->Cmd[FuncCode].ChecksumPolicy = CMDMGR_CHECKSUM_VALIDATE;
 
       CmdMgr->Cmd[FuncCode].AltCnt.Enabled = false   ;
       CmdMgr->Cmd[FuncCode].AltCnt.Valid   = 0;
@@ -128,6 +151,35 @@ bool CMDMGR_RegisterFuncAltCnt(CMDMGR_Class* CmdMgr, uint16 FuncCode, void* ObjD
 } /* End CMDMGR_RegisterFuncAltCnt() */
 
 
+/******************************************************************************
+** Function: CMDMGR_SetChecksumPolicy
+**
+*/
+bool CMDMGR_SetChecksumPolicy(CMDMGR_Class* CmdMgr, uint16 FuncCode, 
+                              CMDMGR_ChecksumPolicy ChecksumPolicy)
+{
+
+   bool    RetStatus = false;
+
+   if (FuncCode < CMDMGR_CMD_FUNC_TOTAL) {
+      
+      CmdMgr->Cmd[FuncCode].ChecksumPolicy = ChecksumPolicy;
+
+      RetStatus = true;
+
+   }
+   else {
+      
+      CFE_EVS_SendEvent (CMDMGR_REG_INVALID_FUNC_CODE_ERR_EID, CFE_EVS_EventType_ERROR,
+         "Attempt to set checksum policy for function code %d which is greater than max %d",
+         FuncCode,(CMDMGR_CMD_FUNC_TOTAL-1));
+   }
+
+   return RetStatus;
+   
+} /* End CMDMGR_SetChecksumPolicy() */
+
+
 /******************************************************************************
 ** Function: CMDMGR_ResetStatus
 **
@@ -162,61 +214,76 @@ void CMDMGR_ResetStatus(CMDMGR_Class* CmdMgr)
 **      if an app wants a message response then it should publish the format. 
 **   2. cFE 7.0 removed CFE_SB_GetChecksum() so it is not reported in the event
 **      message. 
+**   3. The function code is range checked before the descriptor is accessed
+**      and an invalid function code only updates the class counters.
+**   4. The user data length is only derived for the error event. A valid
+**      command is checked with a single compare against the descriptor's
+**      precomputed message size.
 **
 */
 bool CMDMGR_DispatchFunc(CMDMGR_Class* CmdMgr, const CFE_SB_Buffer_t*  SbBufPtr)
 {
 
    bool   ValidCmd = false;
-   bool   ChecksumValid;
-   size_t UserDataLen; 
-   CFE_MSG_FcnCode_t FuncCode;
-
-   UserDataLen = CFE_SB_GetUserDataLength(&SbBufPtr->Msg);
+   bool   ChecksumValid = true;
+   CFE_MSG_Size_t    MsgSize = 0;
+   CFE_MSG_FcnCode_t FuncCode = 0;
+   const CMDMGR_Cmd* Cmd;
 
    CFE_MSG_GetFcnCode(&SbBufPtr->Msg, &FuncCode);
-   CFE_MSG_ValidateChecksum(&SbBufPtr->Msg, &ChecksumValid);
    
    if (DBG_CMDMGR) OS_printf("CMDMGR_DispatchFunc(): [0]=0x%X, [1]=0x%X, [2]=0x%X, [3]=0x%X\n",
                              ((uint8*)SbBufPtr)[0],((uint8*)SbBufPtr)[1],((uint8*)SbBufPtr)[2],((uint8*)SbBufPtr)[3]);
    if (DBG_CMDMGR) OS_printf("CMDMGR_DispatchFunc(): [4]=0x%X, [5]=0x%X, [6]=0x%X, [7]=0x%X\n",
                              ((uint8*)SbBufPtr)[4],((uint8*)SbBufPtr)[5],((uint8*)SbBufPtr)[6],((uint8*)SbBufPtr)[7]);
-   if (DBG_CMDMGR) OS_printf("CMDMGR_DispatchFunc(): FuncCode %d, DataLen %d\n", FuncCode,UserDataLen);
 
-   if (FuncCode < CMDMGR_CMD_FUNC_TOTAL) {
+   if (FuncCode >= CMDMGR_CMD_FUNC_TOTAL) {
+      
+      CFE_EVS_SendEvent (CMDMGR_DISPATCH_INVALID_FUNC_CODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                         "Invalid command function code %d is greater than max %d",
+                         FuncCode, (CMDMGR_CMD_FUNC_TOTAL-1));
 
-      if (UserDataLen == CmdMgr->Cmd[FuncCode].UserDataLen) {
+      CmdMgr->InvalidCmdCnt++;
+      
+      return false;
 
-         if (ChecksumValid) {
+   } /* End if invalid function code */
+
+   Cmd = &CmdMgr->Cmd[FuncCode];
+   
+   CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgSize);
 
-            ValidCmd = (CmdMgr->Cmd[FuncCode].FuncPtr)(CmdMgr->Cmd[FuncCode].DataPtr, SbBufPtr);
+   if (DBG_CMDMGR) OS_printf("CMDMGR_DispatchFunc(): FuncCode %d, MsgSize %d\n", FuncCode, (int)MsgSize);
 
-         } /* End if valid checksum */
-         else {
+   if (MsgSize == Cmd->MsgSize) {
 
-            CFE_EVS_SendEvent (CMDMGR_DISPATCH_INVALID_CHECKSUM_ERR_EID, CFE_EVS_EventType_ERROR,
-                               "Invalid command checksum");
+      if (Cmd->ChecksumPolicy == CMDMGR_CHECKSUM_VALIDATE) {
          
-         }
-      } /* End if valid length */
-      else {
+         CFE_MSG_ValidateChecksum(&SbBufPtr->Msg, &ChecksumValid);
+      
+      }
+      
+      if (ChecksumValid) {
 
-         CFE_EVS_SendEvent (CMDMGR_DISPATCH_INVALID_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                            "Invalid command user data length %d, expected %d",
-                            UserDataLen, CmdMgr->Cmd[FuncCode].UserDataLen);
+         ValidCmd = (Cmd->FuncPtr)(Cmd->DataPtr, SbBufPtr);
 
-      }
+      } /* End if valid checksum */
+      else {
 
-   } /* End if valid function code */
-   else {
+         CFE_EVS_SendEvent (CMDMGR_DISPATCH_INVALID_CHECKSUM_ERR_EID, CFE_EVS_EventType_ERROR,
+                            "Invalid command checksum");
       
-      CFE_EVS_SendEvent (CMDMGR_DISPATCH_INVALID_FUNC_CODE_ERR_EID, CFE_EVS_EventType_ERROR,
-                         "Invalid command function code %d is greater than max %d",
-                         FuncCode, (CMDMGR_CMD_FUNC_TOTAL-1));
+      }
+   } /* End if valid length */
+   else {
 
-   } /* End if invalid function code */
+      CFE_EVS_SendEvent (CMDMGR_DISPATCH_INVALID_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                         "Invalid command user data length %d, expected %d",
+                         (int)CFE_SB_GetUserDataLength(&SbBufPtr->Msg), Cmd->UserDataLen);
 
-   if (CmdMgr->Cmd[FuncCode].AltCnt.Enabled) {
+   }
+
+   if (Cmd->AltCnt.Enabled) {
    
       ValidCmd ? CmdMgr->Cmd[FuncCode].AltCnt.Valid++ : CmdMgr->Cmd[FuncCode].AltCnt.Invalid++;
    
@@ -232,6 +299,70 @@ bool CMDMGR_DispatchFunc(CMDMGR_Class* CmdMgr, const CFE_SB_Buffer_t*  SbBufPtr)
 } /* End CMDMGR_DispatchFunc() */
 
 
+/******************************************************************************
+** Function: CMDMGR_Benchmark
+**
+** Notes:
+**   1. Uses a local command manager instance so no app's counters are
+**      affected. The command manager is large so it is declared static which
+**      means this function is not reentrant. It's only intended to be called
+**      once during library initialization.
+**
+*/
+void CMDMGR_Benchmark(uint32 CmdCnt)
+{
+
+   static CMDMGR_Class BenchmarkCmdMgr;
+   
+   union
+   {
+      CFE_SB_Buffer_t         SbBuf;
+      CMDMGR_BenchmarkCmdMsg  Cmd;
+   } BenchmarkBuf;
+   
+   CMDMGR_ChecksumPolicy Policy;
+   uint32    i;
+   uint32    FuncCnt;
+   int64     ElapsedNs;
+   OS_time_t StartTime;
+   OS_time_t StopTime;
+   
+   CMDMGR_Constructor(&BenchmarkCmdMgr);
+   CMDMGR_RegisterFunc(&BenchmarkCmdMgr, CMDMGR_BENCHMARK_FC, &FuncCnt, BenchmarkFunc,
+                       sizeof(CMDMGR_BenchmarkCmdMsg) - sizeof(CFE_MSG_CommandHeader_t));
+
+   CFE_PSP_MemSet(&BenchmarkBuf, 0, sizeof(BenchmarkBuf));
+   CFE_MSG_Init(&BenchmarkBuf.SbBuf.Msg, CFE_SB_ValueToMsgId(CMDMGR_BENCHMARK_MID), 
+                sizeof(CMDMGR_BenchmarkCmdMsg));
+   CFE_MSG_SetFcnCode(&BenchmarkBuf.SbBuf.Msg, CMDMGR_BENCHMARK_FC);
+   CFE_MSG_GenerateChecksum(&BenchmarkBuf.SbBuf.Msg);
+   
+   for (Policy = CMDMGR_CHECKSUM_VALIDATE; Policy <= CMDMGR_CHECKSUM_IGNORE; Policy++) {
+   
+      CMDMGR_SetChecksumPolicy(&BenchmarkCmdMgr, CMDMGR_BENCHMARK_FC, Policy);
+      FuncCnt = 0;
+      
+      OS_GetLocalTime(&StartTime);
+      for (i=0; i < CmdCnt; i++) {
+         
+         CMDMGR_DispatchFunc(&BenchmarkCmdMgr, &BenchmarkBuf.SbBuf);
+      
+      }
+      OS_GetLocalTime(&StopTime);
+      
+      ElapsedNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(StopTime, StartTime));
+      
+      OS_printf("CMDMGR benchmark: %u of %u commands dispatched with checksum %s in %lu usec, %lu nsec/cmd\n",
+                (unsigned int)FuncCnt, (unsigned int)CmdCnt,
+                (Policy == CMDMGR_CHECKSUM_VALIDATE) ? "validated" : "ignored",
+                (unsigned long)(ElapsedNs / 1000),
+                (unsigned long)(CmdCnt > 0 ? ElapsedNs / CmdCnt : 0));
+   
+   } /* End policy loop */
+   
+} /* End CMDMGR_Benchmark() */
+
+
 /******************************************************************************
 ** Function: UnusedFuncCode
 **
@@ -250,6 +381,22 @@ static bool UnusedFuncCode(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
 } /* End UnusedFuncCode() */
 
 
+/******************************************************************************
+** Function: BenchmarkFunc
+**
+** Count dispatched benchmark commands so the benchmark can confirm every
+** command reached the function.
+*/
+static bool BenchmarkFunc(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   (*(uint32*)ObjDataPtr)++;
+
+   return true;
+
+} /* End BenchmarkFunc() */
+
+
 /******************************************************************************
 ** Function: CMDMGR_ValidBoolArg
 **
@@ -20,6 +20,7 @@
 
 #include "osk_c_fw_cfg.h"
 #include "osk_c_fw_ver.h"
+#include "cmdmgr.h"
 
 /*
 ** Exported Functions
@@ -35,6 +36,12 @@ uint32 OSK_C_FW_LibInit(void)
    OS_printf("OSK C Application Framework Library Initialized. Version %d.%d.%d\n",
              OSK_C_FW_MAJOR_VER, OSK_C_FW_MINOR_VER, OSK_C_FW_LOCAL_REV);
    
+   if (CMDMGR_BENCHMARK_CMD_CNT > 0) {
+      
+      CMDMGR_Benchmark(CMDMGR_BENCHMARK_CMD_CNT);
+   
+   }
+   
   return OS_SUCCESS;
 
 } /* End OSK_C_FW_LibInit() */
@@ -6,6 +6,7 @@
 **   2.0.0 - Improved JSON API: Added const & simplified obj reg.
 **           Added PktUtil 
 **   3.0.0 - Update to comply with cFE 7.0 API changes
+**   3.1.0 - Precomputed CMDMGR dispatch descriptors with checksum policy
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -21,7 +22,7 @@
 
 
 #define OSK_C_FW_MAJOR_VER    3
-#define OSK_C_FW_MINOR_VER    0
+#define OSK_C_FW_MINOR_VER    1
 #define OSK_C_FW_LOCAL_REV    0
 
       
@@ -24,9 +24,26 @@
 #include "pktutil.h"
 
 
-/*********************/
-/** Local Functions **/
-/*********************/
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/* CCSDS primary header fields read directly on the compiled filter path */
+#define PKTUTIL_APID_MASK     0x07FF
+#define PKTUTIL_SEQ_CNT_MASK  0x3FFF
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static uint16 GetFilterValue(const CFE_SB_Buffer_t* SbBufPtr, uint16 FilterType);
+static bool IsFilterValueFiltered(uint16 FilterValue, const PktUtil_CompiledFilter *Filter);
+
+
+/**********************/
+/** Global Functions **/
+/**********************/
 
 /******************************************************************************
 ** Function: PktUtil_IsPacketFiltered
@@ -35,70 +52,127 @@
 **   N = The filter will pass this many packets
 **   X = out of every group of this many packets
 **   O = starting at this offset within the group
+**
+** Notes:
+**   1. The filter is compiled on every call. Use PktUtil_CompileFilter() and
+**      PktUtil_IsPacketFilteredCompiled() when a filter is applied to every
+**      packet of a stream.
 */
 bool PktUtil_IsPacketFiltered(const CFE_SB_Buffer_t* SbBufPtr, const PktUtil_Filter *Filter)
 {        
 
-   bool PacketIsFiltered = true;
-   CFE_TIME_SysTime_t      PacketTime;
-   CFE_MSG_SequenceCount_t SeqCnt;
-   uint16 FilterValue;
-   uint16 Seconds;
-   uint16 Subsecs;
+   PktUtil_CompiledFilter CompiledFilter;
+   
+   PktUtil_CompileFilter(&CompiledFilter, Filter);
+   
+   return PktUtil_IsPacketFilteredCompiled(SbBufPtr, &CompiledFilter);
 
-   if (Filter->Type == PKTUTIL_FILTER_ALWAYS) return true;
-   if (Filter->Type == PKTUTIL_FILTER_NEVER)  return false;
+} /* End of PktUtil_IsPacketFiltered() */
+
+
+/******************************************************************************
+** Function: PktUtil_CompileFilter
+**
+** Notes:
+**   1. Any invalid algorithm parameter or undefined filter type results in
+**      the packet always being filtered.
+**        X: Group size of zero will result in divide by zero
+**        N: Pass count of zero will result in zero packets, so must be non-zero
+**        N <= X: Pass count cannot exceed group size
+**        O <  X: Group offset must be less than group size
+*/
+bool PktUtil_CompileFilter(PktUtil_CompiledFilter *CompiledFilter, const PktUtil_Filter *Filter)
+{
+   
+   bool RetStatus = true;
+   
+   CFE_PSP_MemSet(CompiledFilter, 0, sizeof(PktUtil_CompiledFilter));
+   CompiledFilter->Type = PKTUTIL_FILTER_ALWAYS;
    
-   /* 
-   ** Default to packet being filtered so only need to check for valid algorithm
-   ** parameters. Any invalid algorithm parameter or undefined filter type results
-   ** in packet being filtered.
-   **  X: Group size of zero will result in divide by zero
-   **  N: Pass count of zero will result in zero packets, so must be non-zero
-   **  N <= X: Pass count cannot exceed group size
-   **  O <  X: Group offset must be less than group size
-   */ 
-   if ((Filter->Param.X != 0) && 
-       (Filter->Param.N != 0) && 
-       (Filter->Param.N <= Filter->Param.X) &&
-       (Filter->Param.O <  Filter->Param.X)) {
-
-      if (Filter->Type == PKTUTIL_FILTER_BY_SEQ_CNT) {
+   if ((Filter->Type == PKTUTIL_FILTER_ALWAYS) || (Filter->Type == PKTUTIL_FILTER_NEVER)) {
+   
+      CompiledFilter->Type = Filter->Type;
+   
+   }
+   else if (((Filter->Type == PKTUTIL_FILTER_BY_SEQ_CNT) || (Filter->Type == PKTUTIL_FILTER_BY_TIME)) &&
+            (Filter->Param.X != 0) && 
+            (Filter->Param.N != 0) && 
+            (Filter->Param.N <= Filter->Param.X) &&
+            (Filter->Param.O <  Filter->Param.X)) {
+   
+      CompiledFilter->Type = Filter->Type;
+      CompiledFilter->N    = Filter->Param.N;
+      CompiledFilter->X    = Filter->Param.X;
+      CompiledFilter->O    = Filter->Param.O;
+      
+      if ((Filter->Param.X & (Filter->Param.X - 1)) == 0) {
+         
+         CompiledFilter->XMask = Filter->Param.X - 1;
       
-         CFE_MSG_GetSequenceCount(&SbBufPtr->Msg, &SeqCnt);
-         FilterValue = (uint16)SeqCnt; 
-
       }
-      else if (Filter->Type == PKTUTIL_FILTER_BY_TIME) {
+      else {
          
-         CFE_MSG_GetMsgTime(&SbBufPtr->Msg, &PacketTime);  
+         CompiledFilter->XRecip = (UINT32_C(0xFFFFFFFF) / Filter->Param.X) + 1;
+      
+      }
    
-         Seconds = ((uint16)PacketTime.Seconds) & PKTUTIL_11_LSB_SECONDS_MASK;
-
-         Subsecs = (((uint16)PacketTime.Subseconds) >> PKTUTIL_16_MSB_SUBSECS_SHIFT) & PKTUTIL_4_MSB_SUBSECS_MASK;
+   } /* End if valid algorithm parameters */
+   else {
+      
+      RetStatus = false;
+   
+   }
+   
+   return RetStatus;
+   
+} /* End PktUtil_CompileFilter() */
 
-         /* Merge seconds and subseconds into a packet filter value */
-         Seconds = Seconds << PKTUTIL_11_LSB_SECONDS_SHIFT;
-         Subsecs = Subsecs >> PKTUTIL_4_MSB_SUBSECS_SHIFT;
 
-         FilterValue = Seconds | Subsecs;
-            
-      } /* End if filter by time */
+/******************************************************************************
+** Function: PktUtil_IsPacketFilteredCompiled
+**
+*/
+bool PktUtil_IsPacketFilteredCompiled(const CFE_SB_Buffer_t* SbBufPtr, const PktUtil_CompiledFilter *Filter)
+{
+   
+   if (Filter->Type == PKTUTIL_FILTER_ALWAYS) return true;
+   if (Filter->Type == PKTUTIL_FILTER_NEVER)  return false;
+   
+   return IsFilterValueFiltered(GetFilterValue(SbBufPtr, Filter->Type), Filter);
 
-      if (FilterValue >= Filter->Param.O) {
+} /* End PktUtil_IsPacketFilteredCompiled() */
 
-         if (((FilterValue - Filter->Param.O) % Filter->Param.X) < Filter->Param.N) {
 
-            PacketIsFiltered = false;
+/******************************************************************************
+** Function: PktUtil_FilterPacketBatch
+**
+** Notes:
+**   1. The ApId is read straight from the primary header, which has the same
+**      layout for every cFE message header option.
+*/
+uint32 PktUtil_FilterPacketBatch(CFE_SB_Buffer_t* const SbBufPtr[], uint32 SbBufCnt, 
+                                 const PktUtil_CompiledFilter *FilterTbl, uint16 FilterCnt, 
+                                 bool PktPassed[])
+{
+   
+   uint32 i;
+   uint32 PassedCnt = 0;
+   uint16 ApId;
+   const uint8* StreamId;
+   
+   for (i=0; i < SbBufCnt; i++) {
       
-         }
-      }
-        
-   } /* End if valid algorithm parameters */
-    
-   return PacketIsFiltered;
-
-} /* End of PktUtil_IsPacketFiltered() */
+      StreamId = SbBufPtr[i]->Msg.CCSDS.Pri.StreamId;
+      ApId = ((StreamId[0] << 8) | StreamId[1]) & PKTUTIL_APID_MASK;
+      
+      PktPassed[i] = (ApId < FilterCnt) && !PktUtil_IsPacketFilteredCompiled(SbBufPtr[i], &FilterTbl[ApId]);
+      PassedCnt += PktPassed[i];
+   
+   }
+   
+   return PassedCnt;
+   
+} /* End PktUtil_FilterPacketBatch() */
 
 
 /******************************************************************************
@@ -118,3 +192,78 @@ bool PktUtil_IsFilterTypeValid(uint16 FilterType) {
 } /* End PktUtil_IsFilterTypeValid() */
 
 
+/******************************************************************************
+** Function: GetFilterValue
+**
+** Notes:
+**   1. The sequence count is read straight from the primary header, which has
+**      the same layout for every cFE message header option. The time format
+**      depends on the secondary header so it uses the MSG accessor.
+*/
+static uint16 GetFilterValue(const CFE_SB_Buffer_t* SbBufPtr, uint16 FilterType)
+{
+   
+   CFE_TIME_SysTime_t PacketTime;
+   const uint8* Sequence;
+   uint16 FilterValue;
+   uint16 Seconds;
+   uint16 Subsecs;
+
+   if (FilterType == PKTUTIL_FILTER_BY_SEQ_CNT) {
+   
+      Sequence    = SbBufPtr->Msg.CCSDS.Pri.Sequence;
+      FilterValue = ((Sequence[0] << 8) | Sequence[1]) & PKTUTIL_SEQ_CNT_MASK; 
+
+   }
+   else {
+      
+      CFE_MSG_GetMsgTime(&SbBufPtr->Msg, &PacketTime);  
+
+      Seconds = ((uint16)PacketTime.Seconds) & PKTUTIL_11_LSB_SECONDS_MASK;
+
+      Subsecs = (((uint16)PacketTime.Subseconds) >> PKTUTIL_16_MSB_SUBSECS_SHIFT) & PKTUTIL_4_MSB_SUBSECS_MASK;
+
+      /* Merge seconds and subseconds into a packet filter value */
+      Seconds = Seconds << PKTUTIL_11_LSB_SECONDS_SHIFT;
+      Subsecs = Subsecs >> PKTUTIL_4_MSB_SUBSECS_SHIFT;
+
+      FilterValue = Seconds | Subsecs;
+   
+   } /* End if filter by time */
+
+   return FilterValue;
+   
+} /* End GetFilterValue() */
+
+
+/******************************************************************************
+** Function: IsFilterValueFiltered
+**
+** Notes:
+**   1. The reciprocal remainder is exact for every 16-bit value and group size.
+*/
+static bool IsFilterValueFiltered(uint16 FilterValue, const PktUtil_CompiledFilter *Filter)
+{
+   
+   uint32 GroupValue;
+   uint32 GroupRem;
+   
+   if (FilterValue < Filter->O) return true;
+   
+   GroupValue = FilterValue - Filter->O;
+   
+   if (Filter->XRecip == 0) {
+   
+      GroupRem = GroupValue & Filter->XMask;
+   
+   }
+   else {
+   
+      GroupRem = (uint32)(((uint64)(uint32)(Filter->XRecip * GroupValue) * Filter->X) >> 32);
+   
+   }
+   
+   return (GroupRem >= Filter->N);
+   
+} /* End IsFilterValueFiltered() */
+
@@ -38,19 +38,27 @@
 ** TFTP Application Macros
 */
 
-#define  TFTP_APP_RUNLOOP_DELAY       250  /* Delay in milliseconds for main loop        */
-#define  TFTP_APP_RUNLOOP_PKTS          8  /* Max number of packets to read per run loop */
+#define  TFTP_APP_RUNLOOP_DELAY       250  /* Max milliseconds main loop waits for a datagram */
+#define  TFTP_APP_RUNLOOP_PKTS         64  /* Max number of packets to read per run loop      */
  
 
 /******************************************************************************
 ** TFTP Object Macros
 **
 ** - FSW is connectionless server and ground system  is client
+** - TFTP_MAX_BLKSIZE caps the RFC 2348 blksize option. Use 1428 or less to
+**   avoid IP fragmentation on an Ethernet link.
+** - TFTP_MAX_WINDOWSIZE caps the RFC 7440 windowsize option.
 **
 */
 
 #define  TFTP_IP_ADDR_STR    "192.168.199.213"  /* cpu talking to */
 #define  TFTP_IN_PORT          69
-#define  TFTP_RECV_BUFF_LEN  1024
+#define  TFTP_MAX_BLKSIZE    8192
+#define  TFTP_MAX_WINDOWSIZE   16
+#define  TFTP_RECV_BUFF_LEN  (TFTP_MAX_BLKSIZE + 4)
+
+#define  TFTP_RETRANSMIT_MSEC  500  /* Time without a peer response before resending */
+#define  TFTP_MAX_RETRANSMIT     5  /* Consecutive resends before a transfer is aborted */
 
 #endif /* _tftp_platform_cfg_ */
@@ -35,10 +35,12 @@
 **
 ** 1.0 - Initial release
 ** 1.1 - Refactored for OSK 2.2
+** 1.2 - Added blksize and windowsize options, retransmission and
+**       event driven socket reads
 */
 
 #define  TFTP_MAJOR_VER   1
-#define  TFTP_MINOR_VER   1
+#define  TFTP_MINOR_VER   2
 
 
 #define  TFTP_CMD_PIPE_DEPTH    10
@@ -80,6 +80,44 @@ void NETIF_Destructor(void)
 } /* End NETIF_Destructor() */
 
 
+/******************************************************************************
+** Function: NETIF_WaitForMsg
+**
+** Replaces a fixed run loop delay so datagrams are processed as soon as they
+** arrive.
+*/
+boolean NETIF_WaitForMsg(uint32 Msec)
+{
+
+   fd_set  ReadSet;
+   struct  timeval Timeout;
+   int     Status = -1;
+
+   if (NetIf->SocketId >= 0) {
+
+      FD_ZERO(&ReadSet);
+      FD_SET(NetIf->SocketId, &ReadSet);
+
+      Timeout.tv_sec  = Msec / 1000;
+      Timeout.tv_usec = (Msec % 1000) * 1000;
+
+      Status = select(NetIf->SocketId + 1, &ReadSet, NULL, NULL, &Timeout);
+
+   } /* End if valid socket */
+
+   if ( (Status < 0) && (errno != EINTR) ) {
+
+      CFE_EVS_SendEvent(NETIF_DEBUG_EID,CFE_EVS_DEBUG,"NETIF_WaitForMsg() select failed on socket %d, errno %d",
+                        NetIf->SocketId, errno);
+      OS_TaskDelay(Msec);
+
+   }
+
+   return (Status > 0);
+
+} /* NETIF_WaitForMsg() */
+
+
 /******************************************************************************
 ** Function: NETIF_RcvFrom
 **
@@ -96,14 +134,14 @@ int32 NETIF_RcvFrom(const uint8 NetIFid, void *BufPtr, const uint16 BufSize, boo
      
       if (ServerListen) {
        
-         Status = recvfrom(NetIf->SocketId, BufPtr, TFTP_RECV_BUFF_LEN, MSG_DONTWAIT,
+         Status = recvfrom(NetIf->SocketId, BufPtr, BufSize, MSG_DONTWAIT,
                           (struct sockaddr *) &(NetIf->ServerSocketAddr), (socklen_t *)&AddrLen);
       }
       else {
 
          CFE_PSP_MemSet( &(NetIf->XferSocketAddr), 0, sizeof(NetIf->XferSocketAddr));  /* TODO - Is this needed? */
       
-         Status = recvfrom(NetIf->SocketId, BufPtr, TFTP_RECV_BUFF_LEN, MSG_DONTWAIT,
+         Status = recvfrom(NetIf->SocketId, BufPtr, BufSize, MSG_DONTWAIT,
                           (struct sockaddr *) &(NetIf->XferSocketAddr), (socklen_t *)&AddrLen);
                         
          CFE_EVS_SendEvent(NETIF_DEBUG_EID,CFE_EVS_DEBUG,"Recvfrom XferSocketAddr on port %d with Status %d, eerno %d",ntohs(NetIf->XferSocketAddr.sin_port),Status,errno);
@@ -240,6 +278,7 @@ static boolean InitSocket(const char* DefIpAddrStr, int16 DefServerPort)
 {
 
    boolean RetStatus = FALSE;
+   int     RcvBufLen = 2 * TFTP_MAX_WINDOWSIZE * TFTP_RECV_BUFF_LEN;
    
    strcpy(NetIf->IpAddrStr, DefIpAddrStr);  
 
@@ -261,6 +300,9 @@ static boolean InitSocket(const char* DefIpAddrStr, int16 DefServerPort)
             fcntl(NetIf->SocketId, F_SETFL, O_NONBLOCK);
          #endif
 
+         /* Room for a full window of the largest blocks. The OS may limit the size and that's not an error. */
+         setsockopt(NetIf->SocketId, SOL_SOCKET, SO_RCVBUF, &RcvBufLen, sizeof(RcvBufLen));
+
          FlushSocket(NetIf->SocketId);
          
 		   RetStatus = TRUE;
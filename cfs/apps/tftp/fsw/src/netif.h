@@ -23,6 +23,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <netdb.h>
+#include <sys/select.h>
 #include <time.h>
 #include <string.h>
 #include "common_types.h"
@@ -118,9 +119,24 @@ void NETIF_Destructor();
 void NETIF_ClearClient();
 
 
+/******************************************************************************
+** Function: NETIF_WaitForMsg
+**
+** Block until a datagram can be read from the socket or Msec milliseconds
+** elapse. Returns TRUE if a datagram is ready.
+**
+** Notes:
+**   1. If the socket can't be waited on the function delays for Msec so the
+**      caller's loop keeps its pace.
+**
+*/
+boolean NETIF_WaitForMsg(uint32 Msec);
+
+
 /******************************************************************************
 ** Function: NETIF_RcvFrom
 **
+** Read one datagram of up to BufSize bytes without blocking.
 **
 */
 int32 NETIF_RcvFrom(const uint8 NetIFid, void *BufPtr, const uint16 BufSize, 
@@ -9,6 +9,12 @@
 **      errors. Higher logic functions may still send an event message such as an aborted transaction and the low level
 **      message would provide details.
 **   3. Only one transfer at a time
+**   4. Transfers use a sliding window of WindowSize blocks (RFC 7440). A window
+**      size of one is the RFC 1350 lock-step protocol. The sender resends the
+**      window from the oldest unacknowledged block when a retransmit timer
+**      expires or the peer acknowledges part of a window. The receiver
+**      acknowledges every WindowSize blocks and acknowledges the last in-order
+**      block when it detects a gap.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -43,6 +49,20 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen);
 
 static void CompleteFileTransfer(void);
 
+static void AbortTransfer(uint16 ErrCode, char *ErrMsg);
+
+static void Retransmit(void);
+
+static uint32 MsecSinceXfer(void);
+
+static void SendWindow(void);
+
+static void RewindWindow(void);
+
+static void ProcessGetAck(uint16 AckBlockNum);
+
+static void ProcessPutData(uint8 *Data, uint16 DataLen);
+
 static int16 EncodePkt(const uint16 Opcode, uint16 BlockNum,
                        uint8 *DataPtr, uint16 DataLen);
 					   
@@ -59,6 +79,10 @@ static boolean DecodeErrorMsg(uint8 *Buf, uint16 BufLen, uint16 *ErrCode, char *
 
 static boolean DecodeRequestStrings(uint8 *Buf, uint16 BufLen, char  *Filename, char *Mode);
 
+static boolean DecodeRequestOptions(uint8 *Buf, uint16 BufLen);
+
+static char* DecodeString(uint8 *Buf, uint16 BufLen, uint16 *Index);
+
 static void SendDumpBufEvent(void);
 
 /******************************************************************************
@@ -74,8 +98,10 @@ void TFTP_Constructor(TFTP_Class*  TftpPtr) {
    CFE_PSP_MemSet((void*)TftpPtr, 0, sizeof(TFTP_Class));
    
    Tftp->State   = TFTP_STATE_IDLE;
-   Tftp->Timer = 0;
    Tftp->NetIFid = 0;
+   Tftp->FileHandle = -1;
+   Tftp->BlkSize    = TFTP_DEF_BLKSIZE;
+   Tftp->WindowSize = TFTP_DEF_WINDOWSIZE;
    
    strcpy(Tftp->SrcFilename, "Undefined");
    strcpy(Tftp->DestFilename, "Undefined");
@@ -101,38 +127,53 @@ void TFTP_ResetStatus() {
 
    Tftp->MsgCnt = 0;
    Tftp->MsgErrCnt = 0;
+   Tftp->RetransmitCnt = 0;
 
    Tftp->State = TFTP_STATE_IDLE;
-   Tftp->Timer = 0;
    Tftp->BlockNum = 0;
 
 } /* End TFTP_ResetStatus() */
 
 
+/******************************************************************************
+** Function: TFTP_WaitForMsg
+**
+** Shorten the wait so an active transfer's retransmit timer is serviced on
+** time.
+*/
+void TFTP_WaitForMsg(uint32 MaxWait) {
+
+   uint32 Elapsed;
+   uint32 Wait = MaxWait;
+
+   if (Tftp->State != TFTP_STATE_IDLE) {
+
+      Elapsed = MsecSinceXfer();
+      if (Elapsed >= TFTP_RETRANSMIT_MSEC)
+         Wait = 0;
+      else if ((TFTP_RETRANSMIT_MSEC - Elapsed) < Wait)
+         Wait = TFTP_RETRANSMIT_MSEC - Elapsed;
+
+   }
+
+   NETIF_WaitForMsg(Wait);
+
+} /* End TFTP_WaitForMsg() */
+
+
 /******************************************************************************
 ** Function: TFTP_Read
 **
 ** Each message processed as it is received so no need for more than one buffer.
+** The retransmit timer is checked after the messages have been read so a
+** response that arrived while waiting isn't treated as lost.
 */
 uint16 TFTP_Read(uint16 MaxMsgRead) {
 
    int i = 0;
-   int Status;
+   int Status = 0;
    boolean ServerListen = FALSE;
   
-   if (Tftp->State != TFTP_STATE_IDLE) {
-      Tftp->Timer++;
-   }
-   
-   /* TODO use timer to reset state machines */
-   if ( (Tftp->Timer > TFTP_STATE_TIMEOUT) && 
-        (Tftp->State  != TFTP_STATE_IDLE) ) {
-           
-	   CFE_EVS_SendEvent(TFTP_STATE_TIMEOUT_EID, CFE_EVS_INFORMATION, 
-                        "TFTP timed out on peer response State = %d, Timer = %d", Tftp->State, Tftp->Timer);
-	   CompleteFileTransfer();
-	}
-
 
    for (i = 0; i < MaxMsgRead; i++) {
       
@@ -158,6 +199,12 @@ uint16 TFTP_Read(uint16 MaxMsgRead) {
 
    } /* End receive loop */
 
+   if ( (Tftp->State != TFTP_STATE_IDLE) &&
+        (MsecSinceXfer() >= TFTP_RETRANSMIT_MSEC) ) {
+      
+      Retransmit();
+   }
+
    if (Status < 0)
       return(Status); /* return the error number */
    else
@@ -254,13 +301,254 @@ static void CompleteFileTransfer(void) {
       Tftp->FileHandle = -1;
    }
    Tftp->State = TFTP_STATE_IDLE;
-   Tftp->Timer = 0;
+   Tftp->RetryCnt = 0;
 
    NETIF_ClearClient();
    
 } /* End CompleteFileTransfer() */
 
 
+/******************************************************************************
+** Function: AbortTransfer
+**
+** Send an error packet to the peer and clean up the transfer.
+*/
+static void AbortTransfer(uint16 ErrCode, char *ErrMsg) {
+
+   SendPkt(TFTP_OPCODE_ERROR, ErrCode, (uint8 *)ErrMsg, 0);
+   CompleteFileTransfer();
+
+} /* End AbortTransfer() */
+
+
+/******************************************************************************
+** Function: MsecSinceXfer
+**
+** Milliseconds since the transfer last made progress or sent a packet.
+*/
+static uint32 MsecSinceXfer(void) {
+
+   CFE_TIME_SysTime_t  Elapsed;
+
+   Elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), Tftp->XferTime);
+
+   return (Elapsed.Seconds * 1000 + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds) / 1000);
+
+} /* End MsecSinceXfer() */
+
+
+/******************************************************************************
+** Function: Retransmit
+**
+** Called when the peer hasn't responded within TFTP_RETRANSMIT_MSEC. The
+** transfer is aborted after TFTP_MAX_RETRANSMIT consecutive attempts.
+**
+**   GET:      Resend the window starting at the oldest unacknowledged block
+**   GET_OACK: Resend the OACK
+**   PUT:      Acknowledge the last in-order block. Before any data has been
+**             received this is the OACK or the ACK of block 0.
+*/
+static void Retransmit(void) {
+
+   Tftp->RetryCnt++;
+   
+   if (Tftp->RetryCnt > TFTP_MAX_RETRANSMIT) {
+      
+      CFE_EVS_SendEvent(TFTP_STATE_TIMEOUT_EID, CFE_EVS_INFORMATION, 
+                        "TFTP timed out on peer response State = %d, BlockNum = %d", Tftp->State, Tftp->BlockNum);
+      CompleteFileTransfer();
+      return;
+   }
+
+   Tftp->RetransmitCnt++;
+   CFE_EVS_SendEvent(TFTP_RETRANSMIT_DBG_EID, CFE_EVS_DEBUG,
+                     "TFTP retransmit %d in state %d, BlockNum = %d", Tftp->RetryCnt, Tftp->State, Tftp->BlockNum);
+
+   switch (Tftp->State) {
+      
+      case TFTP_STATE_GET:
+      case TFTP_STATE_GET_FINI:
+         RewindWindow();
+         SendWindow();
+         break;
+         
+      case TFTP_STATE_GET_OACK:
+         SendPkt(TFTP_OPCODE_OACK, 0, NULL, 0);
+         break;
+         
+      case TFTP_STATE_PUT:
+         Tftp->WindowCnt = 0;
+         if ( (Tftp->BlockNum == 1) && (Tftp->FileOffset == 0) && (Tftp->OptionFlags != 0) )
+            SendPkt(TFTP_OPCODE_OACK, 0, NULL, 0);
+         else
+            SendPkt(TFTP_OPCODE_ACK, (uint16)(Tftp->BlockNum - 1), NULL, 0);
+         break;
+         
+      default:
+         CompleteFileTransfer();
+   
+   } /* End State switch */
+
+} /* End Retransmit() */
+
+
+/******************************************************************************
+** Function: SendWindow
+**
+** Read and send blocks until WindowSize blocks are unacknowledged or the
+** final block has been sent. A block shorter than BlkSize, including an
+** empty block when the file size is a multiple of BlkSize, ends the file.
+*/
+static void SendWindow(void) {
+
+   int32  ReadStatus;
+
+   while ( (Tftp->State == TFTP_STATE_GET) &&
+           ((uint16)(Tftp->NextBlockNum - Tftp->BlockNum) < Tftp->WindowSize) ) {
+
+      ReadStatus = OS_read(Tftp->FileHandle, Tftp->FileBuf, Tftp->BlkSize);
+
+      if (ReadStatus < 0) {
+         CFE_EVS_SendEvent(TFTP_FILE_IO_ERR_EID, CFE_EVS_ERROR,
+                           "TFTP error reading block %d from %s. Status = %d",
+                           Tftp->NextBlockNum, Tftp->SrcFilename, ReadStatus);
+         AbortTransfer(TFTP_ERR_NOT_DEFINED, "File read error");
+         break;
+      }
+
+      SendPkt(TFTP_OPCODE_DATA, Tftp->NextBlockNum, Tftp->FileBuf, ReadStatus);
+
+      if (ReadStatus < Tftp->BlkSize) {
+         Tftp->LastBlockNum = Tftp->NextBlockNum;
+         Tftp->State = TFTP_STATE_GET_FINI;
+      }
+      Tftp->NextBlockNum++;
+
+   } /* End while window open */
+
+} /* End SendWindow() */
+
+
+/******************************************************************************
+** Function: RewindWindow
+**
+** Position the file so the next block sent is the oldest unacknowledged block.
+*/
+static void RewindWindow(void) {
+
+   int32 Status;
+
+   Status = OS_lseek(Tftp->FileHandle, Tftp->FileOffset, OS_SEEK_SET);
+
+   if (Status >= 0) {
+      Tftp->NextBlockNum = Tftp->BlockNum;
+      Tftp->State = TFTP_STATE_GET;
+   }
+   else {
+      CFE_EVS_SendEvent(TFTP_FILE_IO_ERR_EID, CFE_EVS_ERROR,
+                        "TFTP error seeking to block %d in %s. Status = %d",
+                        Tftp->BlockNum, Tftp->SrcFilename, Status);
+      AbortTransfer(TFTP_ERR_NOT_DEFINED, "File seek error");
+   }
+
+} /* End RewindWindow() */
+
+
+/******************************************************************************
+** Function: ProcessGetAck
+**
+** An ACK acknowledges every block up to and including AckBlockNum. ACKs for
+** blocks outside of the window are duplicates and are ignored, which also
+** avoids the Sorcerer's Apprentice problem. An ACK for part of the window
+** means the peer detected a gap, so the window restarts after the ACK.
+*/
+static void ProcessGetAck(uint16 AckBlockNum) {
+
+   uint16 AckedCnt       = AckBlockNum - Tftp->BlockNum + 1;
+   uint16 OutstandingCnt = Tftp->NextBlockNum - Tftp->BlockNum;
+
+   if ( (AckedCnt >= 1) && (AckedCnt <= OutstandingCnt) ) {
+   
+      Tftp->BlockNum    = AckBlockNum + 1;
+      Tftp->FileOffset += (uint32)AckedCnt * Tftp->BlkSize;
+      Tftp->RetryCnt    = 0;
+      Tftp->XferTime    = CFE_TIME_GetTime();
+
+      if ( (Tftp->State == TFTP_STATE_GET_FINI) && (AckBlockNum == Tftp->LastBlockNum) ) {
+
+         Tftp->GetFileCnt++;
+         CFE_EVS_SendEvent(TFTP_GND_GET_COMPLETE_EID, CFE_EVS_INFORMATION,
+                           "TFTP successfully transferred a %d block file", Tftp->LastBlockNum);
+         CompleteFileTransfer();
+      }
+      else {
+         
+         if (AckedCnt < OutstandingCnt) {
+            RewindWindow();
+         }
+         SendWindow();
+      }
+
+   } /* End if ACK in window */
+   else {
+      CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_DEBUG,
+                        "TFTP ignored ack for block %d outside of window %d to %d",
+                        AckBlockNum, Tftp->BlockNum, (uint16)(Tftp->NextBlockNum - 1));
+   }
+
+} /* End ProcessGetAck() */
+
+
+/******************************************************************************
+** Function: ProcessPutData
+**
+** Write the next in-order block. The block is acknowledged when it completes
+** a window or ends the file.
+*/
+static void ProcessPutData(uint8 *Data, uint16 DataLen) {
+
+   int32 WriteStatus;
+
+   if (DataLen > 0) {
+      
+      WriteStatus = OS_write(Tftp->FileHandle, Data, DataLen);
+      if (WriteStatus != DataLen) {
+         CFE_EVS_SendEvent(TFTP_FILE_IO_ERR_EID, CFE_EVS_ERROR,
+                           "TFTP error writing block %d to %s. Status = %d",
+                           Tftp->BlockNum, Tftp->DestFilename, WriteStatus);
+         AbortTransfer(TFTP_ERR_DISK_FULL, "File write error");
+         return;
+      }
+      Tftp->FileOffset += DataLen;
+   }
+
+   Tftp->RetryCnt = 0;
+   Tftp->GapAcked = FALSE;
+   Tftp->XferTime = CFE_TIME_GetTime();
+   Tftp->WindowCnt++;
+
+   /* TODO - May want tlm to indicate last file transferred. Pass parameter to complete file transfer */
+   if (DataLen != Tftp->BlkSize) {
+
+      SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
+      Tftp->PutFileCnt++;
+      CompleteFileTransfer();
+      CFE_EVS_SendEvent(TFTP_GND_PUT_COMPLETE_EID, CFE_EVS_INFORMATION,
+                        "TFTP successfully received a %d block file", Tftp->BlockNum);
+   }
+   else {
+
+      if (Tftp->WindowCnt >= Tftp->WindowSize) {
+         SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
+         CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending ACK for block number = %d\n", Tftp->BlockNum);
+         Tftp->WindowCnt = 0;
+      }
+      Tftp->BlockNum++;
+   }
+
+} /* End ProcessPutData() */
+
+
 /******************************************************************************
 ** Function: SendPkt
 **
@@ -274,17 +562,17 @@ static boolean SendPkt(const uint16 Opcode, uint16 BlockNum,
 		                   uint8 *DataPtr, uint16 DataLen) {
 
    boolean PktSent = FALSE;
-   uint16  SendMsgLen;
+   int16   SendMsgLen;
    int32   Status = 0;
  
-   Tftp->Timer = 0;
+   Tftp->XferTime = CFE_TIME_GetTime();
    if ( (SendMsgLen = EncodePkt(Opcode, BlockNum, DataPtr, DataLen)) > 0) {
    
       Tftp->SendMsgLen = SendMsgLen;
     
       CFE_EVS_SendEvent(TFTP_SEND_PKT_DBG_EID, CFE_EVS_DEBUG, 
                         "TFTP sending data on Net IF %d, block number %d, Length %d\n", 
-                        Tftp->NetIFid, Tftp->BlockNum, Tftp->SendMsgLen);
+                        Tftp->NetIFid, BlockNum, Tftp->SendMsgLen);
 	  
       Status = NETIF_SendTo(Tftp->NetIFid, Tftp->SendMsgBuf, SendMsgLen);
 
@@ -417,6 +705,22 @@ static int16 EncodePkt(const uint16 Opcode, uint16 BlockNum,
          memcpy(MsgPtr, DataPtr, ErrStrLen);
          MsgPtr += ErrStrLen;
          break;
+
+      case TFTP_OPCODE_OACK:
+
+         /* Only options the peer requested are acknowledged */
+
+         if (Tftp->OptionFlags & TFTP_OPT_BLKSIZE) {
+            strcpy((char *)MsgPtr, TFTP_OPT_BLKSIZE_STR);
+            MsgPtr += sizeof(TFTP_OPT_BLKSIZE_STR);
+            MsgPtr += sprintf((char *)MsgPtr, "%d", Tftp->BlkSize) + 1;
+         }
+         if (Tftp->OptionFlags & TFTP_OPT_WINDOWSIZE) {
+            strcpy((char *)MsgPtr, TFTP_OPT_WINDOWSIZE_STR);
+            MsgPtr += sizeof(TFTP_OPT_WINDOWSIZE_STR);
+            MsgPtr += sprintf((char *)MsgPtr, "%d", Tftp->WindowSize) + 1;
+         }
+         break;
 	
    } /* End Opcode switch */
 
@@ -542,6 +846,107 @@ static boolean DecodeRequestStrings(uint8 *Buf, uint16 BufLen,
 } /* End DecodeRequestStrings() */
 
 
+/******************************************************************************
+** Function: DecodeRequestOptions
+**
+** Decode the RFC 2347 option name and value pairs that follow the mode string
+** of a RRQ/WRQ. Unknown options, such as tsize, are ignored and left out of
+** the OACK. Returns FALSE if a supported option has an invalid value.
+*/
+static boolean DecodeRequestOptions(uint8 *Buf, uint16 BufLen)
+{
+
+   uint16   Index = 2;
+   char    *OptName, *OptValue, *ValueEnd;
+   uint32   Value;
+   boolean  ValidOptions = TRUE;
+
+   Tftp->OptionFlags = 0;
+   Tftp->BlkSize     = TFTP_DEF_BLKSIZE;
+   Tftp->WindowSize  = TFTP_DEF_WINDOWSIZE;
+
+   /* Skip filename and mode */
+   if ( (DecodeString(Buf, BufLen, &Index) != NULL) &&
+        (DecodeString(Buf, BufLen, &Index) != NULL) ) {
+
+      while (ValidOptions && ((OptName = DecodeString(Buf, BufLen, &Index)) != NULL)) {
+
+         if ((OptValue = DecodeString(Buf, BufLen, &Index)) == NULL) {
+            CFE_EVS_SendEvent(TFTP_DECODE_OPTION_ERR_EID, CFE_EVS_ERROR,
+                              "TFTP decoding error: Option %s has no value", OptName);
+            ValidOptions = FALSE;
+            break;
+         }
+
+         Value = strtoul(OptValue, &ValueEnd, 10);
+         if ( (ValueEnd == OptValue) || (*ValueEnd != '\0') ) {
+            Value = 0; /* Out of range for every supported option */
+         }
+
+         if (strcasecmp(OptName, TFTP_OPT_BLKSIZE_STR) == 0) {
+
+            if ( (Value >= TFTP_OPT_BLKSIZE_MIN) && (Value <= TFTP_OPT_BLKSIZE_MAX) ) {
+               Tftp->BlkSize = (Value > TFTP_MAX_BLKSIZE) ? TFTP_MAX_BLKSIZE : Value;
+               Tftp->OptionFlags |= TFTP_OPT_BLKSIZE;
+            }
+            else {
+               ValidOptions = FALSE;
+            }
+         }
+         else if (strcasecmp(OptName, TFTP_OPT_WINDOWSIZE_STR) == 0) {
+
+            if ( (Value >= TFTP_OPT_WINDOWSIZE_MIN) && (Value <= TFTP_OPT_WINDOWSIZE_MAX) ) {
+               Tftp->WindowSize = (Value > TFTP_MAX_WINDOWSIZE) ? TFTP_MAX_WINDOWSIZE : Value;
+               Tftp->OptionFlags |= TFTP_OPT_WINDOWSIZE;
+            }
+            else {
+               ValidOptions = FALSE;
+            }
+         }
+
+         if (!ValidOptions) {
+            CFE_EVS_SendEvent(TFTP_DECODE_OPTION_ERR_EID, CFE_EVS_ERROR,
+                              "TFTP decoding error: Invalid %s option value %s", OptName, OptValue);
+         }
+
+      } /* End option loop */
+   } /* End if filename and mode */
+
+   CFE_EVS_SendEvent(TFTP_OPTION_DBG_EID, CFE_EVS_DEBUG,
+                     "TFTP request options 0x%02X: blksize %d, windowsize %d",
+                     Tftp->OptionFlags, Tftp->BlkSize, Tftp->WindowSize);
+
+   return ValidOptions;
+
+} /* End DecodeRequestOptions() */
+
+
+/******************************************************************************
+** Function: DecodeString
+**
+** Return the NUL-terminated string starting at Buf[*Index] and advance *Index
+** past it. Returns NULL if the string isn't terminated inside the buffer.
+*/
+static char* DecodeString(uint8 *Buf, uint16 BufLen, uint16 *Index)
+{
+
+   char   *Str = NULL;
+   uint8  *Nul;
+
+   if (*Index < BufLen) {
+
+      Nul = memchr(&Buf[*Index], '\0', BufLen - *Index);
+      if (Nul != NULL) {
+         Str = (char *)&Buf[*Index];
+         *Index = (Nul - Buf) + 1;
+      }
+   }
+
+   return Str;
+
+} /* End DecodeString() */
+
+
 /******************************************************************************
 ** Function: DecodeErrorMsg
 **
@@ -618,16 +1023,17 @@ static void SendDumpBufEvent()
 **
 ** Block number is managed so it is set to the expected value to be immediately 
 ** used when a packet is received and processed.  
-**   GND_GET: When ground ACK received block number is at expected value
-**   GND_PUT: After ACK of previous data received block number is at value for next block to be sent
+**   GND_GET: Block number is the oldest unacknowledged block in the window
+**   GND_PUT: Block number is the next in-order block expected from the ground
 **
+** A RRQ/WRQ with options is answered with an OACK. For a RRQ the ground
+** acknowledges the OACK with an ACK of block 0 before data is sent. For a
+** WRQ the OACK replaces the ACK of block 0.
 **
 */
 static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
 
-   uint8    FileBuf[TFTP_MAX_MSGSIZE];
    uint16   BlockNum, ErrCode;
-   uint32   ReadStatus;
    char    *ErrMsg;
    uint8   *Data;
    uint16   DataLen;
@@ -647,6 +1053,9 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
          if (DecodeErrorMsg(Buf, BufLen, &ErrCode, &ErrMsg)) {
             CFE_EVS_SendEvent(TFTP_DECODE_ERR_MSG_EID, CFE_EVS_ERROR, "TFTP error code %d, msg = %s\n", ErrCode, ErrMsg);
          }
+         if (Tftp->State != TFTP_STATE_IDLE) {
+            CompleteFileTransfer();
+         }
          MsgProcessed = FALSE;
 
       } /* End if Opcode error */
@@ -658,47 +1067,79 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
             switch (OpCode) {
 	         case TFTP_OPCODE_RRQ:
                /* 
-               ** Decode RRQ, Open file and send first data packet 
-               ** Don't increment block number so ACK will verify block number sent 
+               ** Decode RRQ, Open file and send the OACK or the first window
+               ** BlockNum is the first block the ground must acknowledge
                */
                if (DecodeRequestStrings(Buf, BufLen, Tftp->SrcFilename,Tftp->Mode)) {
                   
-                  Tftp->FileHandle = OS_open(Tftp->SrcFilename, OS_READ_ONLY, 0);
-                  if (Tftp->FileHandle >= 0) {
-                    
-                     Tftp->BlockNum = 1;
-                     ReadStatus = OS_read(Tftp->FileHandle, FileBuf, TFTP_MAX_DATA_LEN);
-                     SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, FileBuf, ReadStatus);
-                  }
+                  if (DecodeRequestOptions(Buf, BufLen)) {
+                     
+                     Tftp->FileHandle = OS_open(Tftp->SrcFilename, OS_READ_ONLY, 0);
+                     if (Tftp->FileHandle >= 0) {
+                       
+                        Tftp->BlockNum     = 1;
+                        Tftp->NextBlockNum = 1;
+                        Tftp->FileOffset   = 0;
+                        Tftp->RetryCnt     = 0;
+                        
+                        if (Tftp->OptionFlags != 0) {
+                           Tftp->State = TFTP_STATE_GET_OACK;
+                           SendPkt(TFTP_OPCODE_OACK, 0, NULL, 0);
+                        }
+                        else {
+                           Tftp->State = TFTP_STATE_GET;
+                           SendWindow();
+                        }
+                     }
+                     else {
+                        CFE_EVS_SendEvent(TFTP_RRQ_FILE_OPEN_ERR_EID, CFE_EVS_ERROR,
+                                          "TFTP error opening RRQ file %s. Status = 0x%4x",
+                                          Tftp->SrcFilename, Tftp->FileHandle);
+                        AbortTransfer(TFTP_ERR_NOT_FOUND, "File not found");
+                     }
+                  } /* End if decoded options */
                   else {
-                     CFE_EVS_SendEvent(TFTP_RRQ_FILE_OPEN_ERR_EID, CFE_EVS_ERROR,
-                                       "TFTP error opening RRQ file %s. Status = 0x%4x",
-                                       Tftp->SrcFilename, Tftp->FileHandle);
+                     AbortTransfer(TFTP_ERR_OPTION, "Invalid option value");
                   }
-
-                  Tftp->State = (ReadStatus == TFTP_MAX_DATA_LEN) ? TFTP_STATE_GET : TFTP_STATE_GET_FINI;
-
                } /* End if decoded request strings */
                break;
 			 
             case TFTP_OPCODE_WRQ:
-               /* Decode WRQ, Create file and send ack. Note block number is zero in this special case. */
+               /* Decode WRQ, Create file and send OACK or ack. Note block number is zero in the ack. */
                if (DecodeRequestStrings(Buf, BufLen, Tftp->DestFilename,Tftp->Mode)) {
-                  Tftp->FileHandle = OS_creat(Tftp->DestFilename, OS_WRITE_ONLY);
-                  if (Tftp->FileHandle >= 0) {
-                     Tftp->BlockNum = 0;
-                     CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending WRQ ack. Block number = %d\n", Tftp->BlockNum);
-                     SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
-                     CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sent WRQ ack. Block number = %d\n", Tftp->BlockNum);
-                     Tftp->BlockNum++;
-                  }
+                  
+                  if (DecodeRequestOptions(Buf, BufLen)) {
+                     
+                     Tftp->FileHandle = OS_creat(Tftp->DestFilename, OS_WRITE_ONLY);
+                     if (Tftp->FileHandle >= 0) {
+                        
+                        Tftp->BlockNum   = 0;
+                        Tftp->FileOffset = 0;
+                        Tftp->WindowCnt  = 0;
+                        Tftp->GapAcked   = FALSE;
+                        Tftp->RetryCnt   = 0;
+                        Tftp->State      = TFTP_STATE_PUT;
+                        
+                        if (Tftp->OptionFlags != 0) {
+                           SendPkt(TFTP_OPCODE_OACK, 0, NULL, 0);
+                        }
+                        else {
+                           CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending WRQ ack. Block number = %d\n", Tftp->BlockNum);
+                           SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
+                           CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sent WRQ ack. Block number = %d\n", Tftp->BlockNum);
+                        }
+                        Tftp->BlockNum++;
+                     }
+                     else {
+                        CFE_EVS_SendEvent(TFTP_WRQ_FILE_OPEN_ERR_EID, CFE_EVS_ERROR,
+                                          "TFTP error opening WRQ file %s Status = %d\n",
+                                          Tftp->DestFilename, Tftp->FileHandle);
+                        AbortTransfer(TFTP_ERR_ACCESS_DENIED, "Unable to create file");
+                     } /* End if file create error */
+                  } /* End if decoded options */
                   else {
-                     CFE_EVS_SendEvent(TFTP_WRQ_FILE_OPEN_ERR_EID, CFE_EVS_ERROR,
-                                       "TFTP error opening WRQ file %s Status = %d\n",
-                                       Tftp->DestFilename, Tftp->FileHandle);
-                  } /* End if fiel create error */
-
-                  Tftp->State = TFTP_STATE_PUT;
+                     AbortTransfer(TFTP_ERR_OPTION, "Invalid option value");
+                  }
                } /* End if decoded request strings */
                break;
             default:
@@ -706,36 +1147,18 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
             } /* End Opcode switch */
             break; /* End TFTP_STATE_IDLE */
 
-         case TFTP_STATE_GET:
-	    	    /* Verify Ack opcode, read data from file and send it */
+         case TFTP_STATE_GET_OACK:
+            /* Ground acknowledges the OACK with block 0 */
             if (OpCode == TFTP_OPCODE_ACK) {
-               /*  DecodeBlockNum() sends event if error */
                if (DecodeBlockNum(Buf, BufLen, &BlockNum)) {
-                  if (BlockNum == Tftp->BlockNum) {
-	
-                     ReadStatus = OS_read(Tftp->FileHandle, FileBuf, TFTP_MAX_DATA_LEN);
-                     Tftp->BlockNum++;
-
-                     if (ReadStatus > 0) {    /* More file data */
-                        SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, FileBuf, ReadStatus);
-                        if (ReadStatus < TFTP_MAX_DATA_LEN) {
-                           Tftp->State = TFTP_STATE_GET_FINI;
-                        }
-                        else {
-                           Tftp->State = TFTP_STATE_GET;
-                        } /* End if max data */
-                        Tftp->Timer = 0;
-                     }
-                     else { 
-                        /* Special case where file ends on block boundries */
-                        /* TODO handle read error < 0) */
-                        SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, FileBuf, 0);
-                        Tftp->State = TFTP_STATE_GET_FINI;
-                     }
-                  } /* End if valid block num */
+                  if (BlockNum == 0) {
+                     Tftp->State    = TFTP_STATE_GET;
+                     Tftp->RetryCnt = 0;
+                     SendWindow();
+                  }
                   else {
-                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected block number in ack packet. Expect %d, Received %d",Tftp->BlockNum, BlockNum);
-                  } /* End if invalid block num */
+                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected block number in OACK ack packet. Expect 0, Received %d", BlockNum);
+                  }
                } /* End if DecodeBlockNum() */
             } /* End if Ack Opcode */
             else {
@@ -743,47 +1166,40 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
                CompleteFileTransfer();
                MsgProcessed = FALSE;
             } /* Invalid Opcode */
-            break; /* End TFTP_STATE_GET */
+            break; /* End TFTP_STATE_GET_OACK */
 
+         case TFTP_STATE_GET:
          case TFTP_STATE_GET_FINI:
+	    	    /* Verify Ack opcode, slide the window and send the blocks it opens */
             if (OpCode == TFTP_OPCODE_ACK) {
-               Tftp->GetFileCnt++;
-               CFE_EVS_SendEvent(TFTP_GND_GET_COMPLETE_EID, CFE_EVS_INFORMATION,
-                                 "TFTP successfully transferred a %d block file", Tftp->BlockNum);
-            }
+               /*  DecodeBlockNum() sends event if error */
+               if (DecodeBlockNum(Buf, BufLen, &BlockNum)) {
+                  ProcessGetAck(BlockNum);
+               }
+            } /* End if Ack Opcode */
             else {
                CFE_EVS_SendEvent(TFTP_UNEXP_OPCODE_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected opcode %d when expecting an Ack", OpCode);
-            }		
-            CompleteFileTransfer();   
-            break;
+               CompleteFileTransfer();
+               MsgProcessed = FALSE;
+            } /* Invalid Opcode */
+            break; /* End TFTP_STATE_GET */
 	      
          case TFTP_STATE_PUT:
-	    	    /* Verify data opcode, write data to file and ack it */
+	    	    /* Verify data opcode, write in-order data to file and ack it */
             if (OpCode == TFTP_OPCODE_DATA) {
                if (DecodeBlockNum(Buf, BufLen, &BlockNum)) {
                   if (BlockNum == Tftp->BlockNum) {
                      if (DecodeData(Buf, BufLen, &Data, &DataLen)) {
-                        /* TODO - Verify file write, Fix buffers */
-                        if (DataLen > 0) { /* no more data */
-                           OS_write(Tftp->FileHandle,Data,DataLen);
-                        }
-                        SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
-                        CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending ACK for block number = %d\n", Tftp->BlockNum);
-                        /* TODO - May want tlm to indicate last file transferred. Pass parameter to complete file transfer */
-                        if (DataLen != TFTP_MAX_DATA_LEN) {
-                           Tftp->PutFileCnt++;
-                           CompleteFileTransfer();
-                           CFE_EVS_SendEvent(TFTP_GND_PUT_COMPLETE_EID, CFE_EVS_INFORMATION,
-                                             "TFTP successfully received a %d block file", Tftp->BlockNum);
-                        }
-                        else {
-                           Tftp->BlockNum++;
-                        }
-                     } /* End if DecodeData() */
+                        ProcessPutData(Data, DataLen);
+                     }
                   } /* End if valid block num */
-                  else {
-                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR,
+                  else if (!Tftp->GapAcked) {
+                     /* Lost, duplicate or reordered block. Ack the last in-order block once so the ground resends from there. */
+                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_DEBUG,
                                        "TFTP unexpected block number in data packet. Expect %d, Received %d",Tftp->BlockNum, BlockNum);
+                     Tftp->GapAcked  = TRUE;
+                     Tftp->WindowCnt = 0;
+                     SendPkt(TFTP_OPCODE_ACK, (uint16)(Tftp->BlockNum - 1), NULL, 0);
                   } /* End if invalid block num */
                } /* End if DecodeBlockNum() */
             } /* End if DATA OpCode */
@@ -803,6 +1219,11 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
          } /* End State switch */
       } /* End if TFTP_OPCODE_ERROR */ 
    } /* End if DecodeOpcode() */
+
+   /* A stray message received while idle must not become the next transfer's client */
+   if (Tftp->State == TFTP_STATE_IDLE) {
+      NETIF_ClearClient();
+   }
 	
    return MsgProcessed;
 
@@ -6,6 +6,8 @@
 **      In it's header it states "A TFTP (RFC 1350) over IPv4/IPv6 client. This code is intended to
 **      demonstrate (i) how to write encoding/decoding functions, (ii) how to implement a simple state
 **      machine, and (iii) how to use a select() main loop to implement timeouts and retransmissions.
+**   2. The blksize (RFC 2348) and windowsize (RFC 7440) options are negotiated using RFC 2347
+**      option acknowledgements. A transfer without options follows RFC 1350.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -28,6 +30,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <fcntl.h>
 
@@ -42,7 +45,7 @@
 /***********************/
 
 /*
-** See RFC 1350 section 5 and the appendix.
+** See RFC 1350 section 5 and the appendix. OACK is defined by RFC 2347.
 */
 
 #define TFTP_OPCODE_RRQ		1
@@ -50,12 +53,27 @@
 #define TFTP_OPCODE_DATA	3
 #define TFTP_OPCODE_ACK		4
 #define TFTP_OPCODE_ERROR	5
+#define TFTP_OPCODE_OACK	6
 
-#define TFTP_STATE_TIMEOUT    40  /* Length pepends on TFTP_APP_RUNLOOP_DELAY in tftp_platform_cfg.h */
-#define TFTP_DEF_TIMEOUT_SEC  0
-#define TFTP_DEF_TIMEOUT_USEC 50000
-#define TFTP_MAX_DATA_LEN     512
-#define TFTP_MAX_MSGSIZE      (4 + TFTP_MAX_DATA_LEN)
+#define TFTP_DEF_BLKSIZE      512   /* RFC 1350 block size used when blksize isn't negotiated */
+#define TFTP_DEF_WINDOWSIZE   1     /* Lock-step transfer used when windowsize isn't negotiated */
+#define TFTP_MAX_MSGSIZE      (4 + TFTP_MAX_BLKSIZE)
+
+/*
+** Option names and the value ranges from RFC 2348 and RFC 7440. Values
+** above the platform maximums are accepted and reduced in the OACK.
+*/
+
+#define TFTP_OPT_BLKSIZE_STR     "blksize"
+#define TFTP_OPT_WINDOWSIZE_STR  "windowsize"
+
+#define TFTP_OPT_BLKSIZE_MIN     8
+#define TFTP_OPT_BLKSIZE_MAX     65464
+#define TFTP_OPT_WINDOWSIZE_MIN  1
+#define TFTP_OPT_WINDOWSIZE_MAX  65535
+
+#define TFTP_OPT_BLKSIZE         0x01  /* OptionFlags bits for options to acknowledge */
+#define TFTP_OPT_WINDOWSIZE      0x02
 
 #define TFTP_MODE_OCTET    "octet"
 #define TFTP_MODE_NETASCII "netascii"
@@ -69,6 +87,7 @@
 #define TFTP_ERR_ILLEGAL_OP    5
 #define TFTP_ERR_FILE_EXISTS   6
 #define TFTP_ERR_NO_SUCH_USER  7
+#define TFTP_ERR_OPTION        8
 
 
 #define TFTP_STATE_IDLE      10
@@ -77,6 +96,7 @@
 #define TFTP_STATE_PUT_FINI  12
 #define TFTP_STATE_GET       13
 #define TFTP_STATE_GET_FINI  14
+#define TFTP_STATE_GET_OACK  15  /* OACK sent for a RRQ, waiting for ACK of block 0 */
 
 #define TFTP_MAX_MODE_LEN    10
 #define TFTP_IP_ADDR_STR_LEN 32
@@ -116,8 +136,12 @@
 #define TFTP_GND_GET_COMPLETE_EID       (TFTP_BASE_EID + 24)
 #define TFTP_GND_PUT_COMPLETE_EID       (TFTP_BASE_EID + 25)
 #define TFTP_STATE_TIMEOUT_EID          (TFTP_BASE_EID + 26)
+#define TFTP_DECODE_OPTION_ERR_EID      (TFTP_BASE_EID + 27)
+#define TFTP_OPTION_DBG_EID             (TFTP_BASE_EID + 28)
+#define TFTP_RETRANSMIT_DBG_EID         (TFTP_BASE_EID + 29)
+#define TFTP_FILE_IO_ERR_EID            (TFTP_BASE_EID + 30)
 
-#define TFTP_TOTAL_EID  27
+#define TFTP_TOTAL_EID  31
 
 /**********************/
 /** Type Definitions **/
@@ -187,10 +211,12 @@ typedef struct {
 
    uint32  MsgCnt;
    uint32  MsgErrCnt;
+   uint32  RetransmitCnt;
    uint8   MsgBuf[TFTP_MAX_MSGSIZE];     /* Recv buffer     */
    uint16  MsgLen;                       /* Recv buffer len */
    uint8   SendMsgBuf[TFTP_MAX_MSGSIZE]; /* Send buffer     */
    uint16  SendMsgLen;                   /* Send buffer len */
+   uint8   FileBuf[TFTP_MAX_BLKSIZE];    /* File data for one block */
 
    uint8   NetIFid;
    uint8   Pad0;
@@ -211,8 +237,25 @@ typedef struct {
 
    char     Mode[TFTP_MAX_MODE_LEN];  /* TFTP transfer mode              */
    int	    State;                    /* State of the TFTP state machine */
-   uint16   Timer;                    /* Iimer for timeout logic         */
-   uint16   BlockNum;                 /* Current block number            */
+   uint16   BlockNum;                 /* Get: Oldest unacknowledged block, Put: Next expected block */
+
+   /*
+   ** Sliding window
+   ** - Block numbers are 16 bits and wrap so window arithmetic is done in uint16
+   ** - Get re-reads a window from the file starting at FileOffset when a
+   **   block is lost
+   */
+
+   uint8    OptionFlags;              /* TFTP_OPT_xxx options to acknowledge */
+   uint8    RetryCnt;                 /* Consecutive resends without progress */
+   uint16   BlkSize;                  /* Negotiated data bytes per block      */
+   uint16   WindowSize;               /* Negotiated blocks per window         */
+   uint16   NextBlockNum;             /* Get: Next block to send              */
+   uint16   LastBlockNum;             /* Get: Final block, valid in GET_FINI  */
+   uint16   WindowCnt;                /* Put: In-order blocks since last ACK  */
+   boolean  GapAcked;                 /* Put: ACK sent for the current gap    */
+   uint32   FileOffset;               /* Get: Offset of BlockNum, Put: Bytes written */
+   CFE_TIME_SysTime_t  XferTime;      /* Time of last progress or transmission       */
 
    /*
    ** Telemetry Packets
@@ -239,11 +282,22 @@ typedef struct {
 void TFTP_Constructor(TFTP_Class*  TftpPtr);
 
 
+/******************************************************************************
+** Function: TFTP_WaitForMsg
+**
+** Block until a message arrives, the active transfer's retransmit timer
+** expires, or MaxWait milliseconds elapse.
+**
+*/
+void TFTP_WaitForMsg(uint32 MaxWait);
+
+
 /******************************************************************************
 ** Function: TFTP_Read
 **
 ** Read up to MaxMsgRead messages and return the number of messages read. Each
-** message is processed as it it read.
+** message is processed as it it read. Expired retransmit timers are also
+** serviced.
 **
 */
 uint16 TFTP_Read(uint16 MaxMsgRead);
@@ -9,6 +9,9 @@
 **   2. Event message filters are not used since this is for test environments.
 **      This may be reconsidered if event flooding ever becomes a problem.
 **   3. Performance traces are not included.
+**   4. The main loop blocks on the TFTP socket instead of a fixed delay so
+**      transfers are driven by datagram arrival. Commands are polled each
+**      time the loop wakes so they wait at most TFTP_APP_RUNLOOP_DELAY.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -82,7 +85,7 @@ void TFTP_AppMain(void)
    */
    while (CFE_ES_RunLoop(&RunStatus)) {
 
-      OS_TaskDelay(TFTP_APP_RUNLOOP_DELAY);
+      TFTP_WaitForMsg(TFTP_APP_RUNLOOP_DELAY);
 
       TFTP_Read(TFTP_APP_RUNLOOP_PKTS);
       ProcessCommands();
@@ -161,6 +164,8 @@ static void SendHousekeepingPkt(void)
 
    TftpApp.HkPkt.State      = TftpApp.Tftp.State;
    TftpApp.HkPkt.BlockNum   = TftpApp.Tftp.BlockNum;
+   TftpApp.HkPkt.BlkSize    = TftpApp.Tftp.BlkSize;
+   TftpApp.HkPkt.WindowSize = TftpApp.Tftp.WindowSize;
 
    strncpy(TftpApp.HkPkt.SrcFilename,  TftpApp.Tftp.SrcFilename,  TFTP_FILENAME_LEN);
    strncpy(TftpApp.HkPkt.DestFilename, TftpApp.Tftp.DestFilename, TFTP_FILENAME_LEN);
@@ -171,6 +176,7 @@ static void SendHousekeepingPkt(void)
 
    TftpApp.HkPkt.RecvMsgCnt      = TftpApp.Tftp.MsgCnt;
    TftpApp.HkPkt.RecvMsgErrCnt   = TftpApp.Tftp.MsgErrCnt;
+   TftpApp.HkPkt.RetransmitCnt   = TftpApp.Tftp.RetransmitCnt;
 
    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &TftpApp.HkPkt);
    CFE_SB_SendMsg((CFE_SB_Msg_t *) &TftpApp.HkPkt);
@@ -63,6 +63,8 @@ typedef struct {
    uint16  GetFileCnt;
    uint16  PutFileCnt;
    uint16  BlockNum;
+   uint16  BlkSize;     /* Negotiated options of the current or last transfer */
+   uint16  WindowSize;
 
    char    SrcFilename[TFTP_FILENAME_LEN];
    char    DestFilename[TFTP_FILENAME_LEN];
@@ -76,6 +78,7 @@ typedef struct {
    
    uint32   RecvMsgCnt;
    uint32   RecvMsgErrCnt;
+   uint32   RetransmitCnt;
 
 } OS_PACK TFTP_APP_HkPkt;
 #define TFTP_APP_TLM_HK_LEN sizeof (TFTP_APP_HkPkt)
@@ -117,6 +117,20 @@
 */
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Maximum Number of messages returned by a single batch receive
+**
+**  \par Description:
+**       Dictates the maximum number of messages that a single call to
+**       #CFE_SB_ReceiveBufferBatch can return.  Each pipe reserves space to track
+**       this many buffers on behalf of the receiving application.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_BATCH 16
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -154,6 +168,53 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Depth of the SB buffer cache for each block size
+**
+**  \par Description:
+**       Message buffers released by the SB are kept in a cache for each
+**       block size (see #CFE_PLATFORM_SB_MEM_BLOCK_SIZE_01) and reused by the
+**       next allocation of that size instead of being returned to the SB
+**       memory pool. This parameter is the maximum number of buffers cached
+**       for each block size. Cached buffers are not counted as in use in the
+**       SB statistics and are returned to the pool if an allocation fails.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 64.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_CACHE_DEPTH 4
+
+/**
+**  \cfesbcfg Maximum number of SB publish rings
+**
+**  \par Description:
+**       A publish ring is a set of message buffers that an application
+**       preallocates for one Message ID (see CFE_SB_CreatePublishRing()) and
+**       reuses for every transmit of that message. This parameter is the
+**       maximum number of publish rings that may exist at one time.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 1024.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_PUBLISH_RINGS 16
+
+/**
+**  \cfesbcfg Maximum number of buffers in one SB publish ring
+**
+**  \par Description:
+**       Upper limit of the buffer count an application may request for a
+**       single publish ring.  A buffer is reused only after all subscribers
+**       have released it, so the depth should cover the number of messages
+**       that subscribers may hold at one time.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 64.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH 8
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -760,6 +821,21 @@
 */
 #define CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN 4
 
+/**
+**  \cfeescfg Enable Lock-Free Memory Pools
+**
+**  \par Description:
+**       When true, memory pools created with #CFE_ES_USE_MUTEX manage their
+**       free lists with atomic compare-and-swap operations instead of an OSAL
+**       mutex, so get and put calls from different cores do not serialize.
+**       Pools fall back to the mutex if the compiler lacks atomic builtins.
+**       The Critical Data Store pool always uses its lock.
+**
+**  \par Limits
+**       Must be true or false.  Lock-free pools are limited to 4 GBytes.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_LOCK_FREE false
+
 /**
 **  \cfeescfg ES Nonvolatile Startup Filename
 **
@@ -929,6 +1005,26 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Number of Performance Data Capture Shards
+**
+**  \par Description:
+**       The performance data buffer is split into this many rings of equal size.
+**       Each task writes its markers into the ring selected by its OSAL task
+**       index and reserves a slot with an atomic operation instead of taking the
+**       performance data mutex.  The rings are merged by time stamp when the log
+**       is written to a file, so the file format is the same for any setting.
+**
+**       Each ring wraps on its own.  If a single task produces most of the
+**       markers, its ring may overwrite its oldest entries before the whole
+**       buffer is full.  Set to 1 to have all tasks share a single ring.
+**
+**  \par Limits
+**       There is a lower limit of 1.  CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE must be
+**       an exact multiple of this value.
+*/
+#define CFE_PLATFORM_ES_PERF_LOG_SHARDS 4
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
@@ -1339,6 +1435,34 @@
 */
 #define CFE_PLATFORM_EVS_MAX_EVENT_FILTERS 8
 
+/**
+**  \cfeevscfg Define Deferred Event Queue Depth per Application
+**
+**  \par Description:
+**       Number of events each application may have queued for formatting by the
+**       EVS task after enabling deferred formatting with CFE_EVS_SetDeferredFormat.
+**       Events sent while an application's queue is full are formatted in the
+**       sender's context instead.
+**
+**  \par Limits
+**       Must be a power of two and at least 2.  Each queued event reserves roughly
+**       twice #CFE_MISSION_EVS_MAX_MESSAGE_LENGTH bytes for every one of the
+**       #CFE_PLATFORM_ES_MAX_APPLICATIONS applications.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH 8
+
+/**
+**  \cfeevscfg Define Deferred Event Drain Period
+**
+**  \par Description:
+**       Longest time, in milliseconds, the EVS task waits on its command pipe
+**       before sending events queued by applications using deferred formatting.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_DRAIN_MSEC 100
+
 /**
 **  \cfeevscfg Default Event Log Filename
 **
@@ -260,11 +260,10 @@
 
 /** \name Checksum/CRC algorithm identifiers */
 /** \{ */
-#define CFE_MISSION_ES_CRC_8  1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
-#define CFE_MISSION_ES_CRC_16 2 /**< \brief CRC (16 bit additive - returns 32 bit total) */
-#define CFE_MISSION_ES_CRC_32                                                              \
-    3 /**< \brief CRC (32 bit additive - returns 32 bit total) (Currently not implemented) \
-       */
+#define CFE_MISSION_ES_CRC_8   1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
+#define CFE_MISSION_ES_CRC_16  2 /**< \brief CRC (16 bit additive - returns 32 bit total) */
+#define CFE_MISSION_ES_CRC_32  3 /**< \brief CRC-32 (IEEE 802.3, as used by zlib) */
+#define CFE_MISSION_ES_CRC_32C 4 /**< \brief CRC-32C (Castagnoli, as used by iSCSI) */
 /** \} */
 
 /**
@@ -276,7 +275,9 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_MISSION_ES_CRC_16 is supported (see #CFE_MISSION_ES_CRC_16)
+**      Must be one of #CFE_MISSION_ES_CRC_16, #CFE_MISSION_ES_CRC_32 or #CFE_MISSION_ES_CRC_32C.
+**      Changing it invalidates any table images and CDS contents saved with the
+**      previous algorithm.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_MISSION_ES_CRC_16
 
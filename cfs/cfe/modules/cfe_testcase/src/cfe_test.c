@@ -38,6 +38,10 @@
  */
 int32 CFE_Test_Init(int32 LibId)
 {
+    ESCRCTestSetup(LibId);
     ESInfoTestSetup(LibId);
+    EVSFilterTestSetup(LibId);
+    MSGChecksumTestSetup(LibId);
+    TIMEFastTestSetup(LibId);
     return CFE_SUCCESS;
 }
@@ -53,6 +53,10 @@
     UtAssert_True(!CFE_RESOURCEID_TEST_DEFINED(id), "%s (%lu) not defined", #id, CFE_RESOURCEID_TO_ULONG(id))
 
 int32 CFE_Test_Init(int32 LibId);
+int32 ESCRCTestSetup(int32 LibId);
 int32 ESInfoTestSetup(int32 LibId);
+int32 EVSFilterTestSetup(int32 LibId);
+int32 MSGChecksumTestSetup(int32 LibId);
+int32 TIMEFastTestSetup(int32 LibId);
 
 #endif /* CFE_TEST_H */
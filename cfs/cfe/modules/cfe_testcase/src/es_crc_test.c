@@ -0,0 +1,122 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: es_crc_test.c
+**
+** Purpose:
+**   Functional test and throughput of CFE_ES_CalculateCRC
+**
+**   Checks that computing each CRC in two pieces agrees with a single pass
+**   and reports the throughput of every algorithm for buffers from 1 KiB
+**   to 16 MiB.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define ES_CRC_TEST_MIN_SIZE    1024
+#define ES_CRC_TEST_MAX_SIZE    (16 * 1024 * 1024)
+#define ES_CRC_TEST_BYTE_BUDGET (64 * 1024 * 1024)
+
+static uint8 EsCrcTestBuf[ES_CRC_TEST_MAX_SIZE];
+
+static const struct
+{
+    uint32      TypeCRC;
+    const char *Name;
+} ES_CRC_TEST_TYPES[] = {
+    {CFE_MISSION_ES_CRC_16, "CRC-16"},
+    {CFE_MISSION_ES_CRC_32, "CRC-32"},
+    {CFE_MISSION_ES_CRC_32C, "CRC-32C"},
+};
+
+static void EsCrcTestRun(size_t Size, uint32 TypeCRC, const char *Name)
+{
+    uint32    Iterations;
+    uint32    i;
+    uint32    Crc;
+    uint32    Split;
+    OS_time_t Start;
+    OS_time_t End;
+    int64     ElapsedNs;
+
+    /* Continuing from an odd split point must agree with a single pass */
+    Split = (Size / 3) | 1;
+    Crc   = CFE_ES_CalculateCRC(EsCrcTestBuf, Split, 0, TypeCRC);
+    Crc   = CFE_ES_CalculateCRC(&EsCrcTestBuf[Split], Size - Split, Crc, TypeCRC);
+    UtAssert_UINT32_EQ(Crc, CFE_ES_CalculateCRC(EsCrcTestBuf, Size, 0, TypeCRC));
+
+    /* Scale the iteration count so every size covers roughly the same number of bytes */
+    Iterations = ES_CRC_TEST_BYTE_BUDGET / Size;
+
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < Iterations; i++)
+    {
+        Crc = CFE_ES_CalculateCRC(EsCrcTestBuf, Size, Crc, TypeCRC);
+    }
+    OS_GetLocalTime(&End);
+    ElapsedNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start));
+
+    if (ElapsedNs <= 0)
+    {
+        ElapsedNs = 1;
+    }
+
+    UtPrintf("ES %s size=%lu: %ld ns/call, %ld MB/s (%08lx)", Name, (unsigned long)Size,
+             (long)(ElapsedNs / Iterations), (long)(((int64)Iterations * Size * 1000) / ElapsedNs),
+             (unsigned long)Crc);
+}
+
+void TestESCalculateCRCTiming(void)
+{
+    size_t Size;
+    uint32 i;
+    uint32 t;
+
+    UtPrintf("Testing: CFE_ES_CalculateCRC throughput");
+
+    for (i = 0; i < sizeof(EsCrcTestBuf); i++)
+    {
+        EsCrcTestBuf[i] = (uint8)((i * 131) + 7);
+    }
+
+    /* Standard check values */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
+
+    for (t = 0; t < sizeof(ES_CRC_TEST_TYPES) / sizeof(ES_CRC_TEST_TYPES[0]); t++)
+    {
+        for (Size = ES_CRC_TEST_MIN_SIZE; Size <= ES_CRC_TEST_MAX_SIZE; Size *= 4)
+        {
+            EsCrcTestRun(Size, ES_CRC_TEST_TYPES[t].TypeCRC, ES_CRC_TEST_TYPES[t].Name);
+        }
+    }
+}
+
+int32 ESCRCTestSetup(int32 LibId)
+{
+    UtTest_Add(TestESCalculateCRCTiming, NULL, NULL, "Test ES CRC Throughput");
+
+    return CFE_SUCCESS;
+}
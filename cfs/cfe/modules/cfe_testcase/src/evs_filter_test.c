@@ -0,0 +1,107 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: evs_filter_test.c
+**
+** Purpose:
+**   Functional test and timing of EVS binary event filtering
+**
+**   Registers the test runner with a set of binary filters and reports the
+**   average cost of CFE_EVS_SendEvent() for filtered and unfiltered events.
+**   EVS truncates the filter table to CFE_PLATFORM_EVS_MAX_EVENT_FILTERS, so
+**   the larger filter counts only take effect on platforms configured for them.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define EVS_FILTER_TEST_MAX_FILTERS       64
+#define EVS_FILTER_TEST_FILTERED_ITERS    10000
+#define EVS_FILTER_TEST_UNFILTERED_ITERS  100
+#define EVS_FILTER_TEST_UNFILTERED_EVENT  (EVS_FILTER_TEST_MAX_FILTERS + 1)
+
+static CFE_EVS_BinFilter_t EvsFilterTestFilters[EVS_FILTER_TEST_MAX_FILTERS];
+
+static int64 EvsFilterTestTimeSend(uint16 EventID, uint32 Iterations)
+{
+    OS_time_t Start;
+    OS_time_t End;
+    uint32    i;
+
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < Iterations; i++)
+    {
+        CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_INFORMATION, "EVS filter timing event %u", (unsigned int)i);
+    }
+    OS_GetLocalTime(&End);
+
+    return OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / Iterations;
+}
+
+static void EvsFilterTestRun(uint16 NumFilters)
+{
+    uint16 i;
+    int64  FilteredNs;
+    int64  UnfilteredNs;
+
+    /* Each event passes once and is filtered from then on */
+    for (i = 0; i < NumFilters; i++)
+    {
+        EvsFilterTestFilters[i].EventID = i + 1;
+        EvsFilterTestFilters[i].Mask    = CFE_EVS_FIRST_ONE_STOP;
+    }
+
+    UtAssert_INT32_EQ(CFE_EVS_Register(EvsFilterTestFilters, NumFilters, CFE_EVS_EventFilter_BINARY), CFE_SUCCESS);
+
+    /* The last registered event ID is the worst case for a linear filter scan */
+    UtAssert_INT32_EQ(CFE_EVS_SendEvent(NumFilters, CFE_EVS_EventType_INFORMATION, "EVS filter timing start"),
+                      CFE_SUCCESS);
+    FilteredNs = EvsFilterTestTimeSend(NumFilters, EVS_FILTER_TEST_FILTERED_ITERS);
+
+    /* An event ID with no filter misses the lookup and is sent every time */
+    UnfilteredNs = EvsFilterTestTimeSend(EVS_FILTER_TEST_UNFILTERED_EVENT, EVS_FILTER_TEST_UNFILTERED_ITERS);
+
+    UtAssert_INT32_EQ(CFE_EVS_ResetAllFilters(), CFE_SUCCESS);
+
+    UtPrintf("EVS filters=%u: filtered send %ld ns/call, unfiltered send %ld ns/call", (unsigned int)NumFilters,
+             (long)FilteredNs, (long)UnfilteredNs);
+}
+
+void TestEvsFilterTiming(void)
+{
+    UtPrintf("Testing: CFE_EVS_SendEvent filter timing");
+
+    EvsFilterTestRun(8);
+    EvsFilterTestRun(EVS_FILTER_TEST_MAX_FILTERS);
+
+    /* Return the test runner to an unfiltered registration */
+    UtAssert_INT32_EQ(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY), CFE_SUCCESS);
+}
+
+int32 EVSFilterTestSetup(int32 LibId)
+{
+    UtTest_Add(TestEvsFilterTiming, NULL, NULL, "Test EVS Filter Timing");
+
+    return CFE_SUCCESS;
+}
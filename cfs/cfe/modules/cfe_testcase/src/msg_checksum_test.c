@@ -0,0 +1,125 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: msg_checksum_test.c
+**
+** Purpose:
+**   Functional test and timing of the command secondary header checksum
+**
+**   Checks that CFE_MSG_GenerateChecksum() agrees with a plain byte loop and
+**   reports the average cost of both for message sizes from 16 bytes to 64 KiB.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define MSG_CHECKSUM_TEST_MAX_SIZE   65536
+#define MSG_CHECKSUM_TEST_BYTE_BUDGET (4 * 1024 * 1024)
+
+/* uint64 backing keeps the message aligned the way SB buffers are */
+static uint64 MsgChecksumTestBuf[MSG_CHECKSUM_TEST_MAX_SIZE / sizeof(uint64)];
+
+static uint8 MsgChecksumTestByteLoop(const uint8 *BytePtr, size_t Len)
+{
+    uint8 Chksum = 0xFF;
+
+    while (Len--)
+    {
+        Chksum ^= *(BytePtr++);
+    }
+
+    return Chksum;
+}
+
+static void MsgChecksumTestRun(size_t Size)
+{
+    CFE_MSG_Message_t *MsgPtr = (CFE_MSG_Message_t *)MsgChecksumTestBuf;
+    uint32             Iterations;
+    uint32             i;
+    bool               IsValid = false;
+    volatile uint8     Sink    = 0;
+    OS_time_t          Start;
+    OS_time_t          End;
+    int64              FastNs;
+    int64              ByteNs;
+
+    CFE_MSG_SetType(MsgPtr, CFE_MSG_Type_Cmd);
+    CFE_MSG_SetHasSecondaryHeader(MsgPtr, true);
+    UtAssert_INT32_EQ(CFE_MSG_SetSize(MsgPtr, Size), CFE_SUCCESS);
+
+    /* Generated checksum must zero the byte loop over the whole message */
+    UtAssert_INT32_EQ(CFE_MSG_GenerateChecksum(MsgPtr), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(MsgChecksumTestByteLoop(MsgPtr->Byte, Size), 0);
+    UtAssert_INT32_EQ(CFE_MSG_ValidateChecksum(MsgPtr, &IsValid), CFE_SUCCESS);
+    UtAssert_True(IsValid, "Generated checksum validates");
+
+    /* Scale the iteration count so every size checksums roughly the same number of bytes */
+    Iterations = MSG_CHECKSUM_TEST_BYTE_BUDGET / Size;
+
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < Iterations; i++)
+    {
+        CFE_MSG_ValidateChecksum(MsgPtr, &IsValid);
+        Sink ^= IsValid;
+    }
+    OS_GetLocalTime(&End);
+    FastNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / Iterations;
+
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < Iterations; i++)
+    {
+        Sink ^= MsgChecksumTestByteLoop(MsgPtr->Byte, Size);
+    }
+    OS_GetLocalTime(&End);
+    ByteNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / Iterations;
+
+    UtPrintf("MSG checksum size=%lu: CFE_MSG_ValidateChecksum %ld ns/call, byte loop %ld ns/call (%u)",
+             (unsigned long)Size, (long)FastNs, (long)ByteNs, (unsigned int)Sink);
+}
+
+void TestMsgChecksumTiming(void)
+{
+    size_t Size;
+    uint32 i;
+    uint8 *BytePtr = (uint8 *)MsgChecksumTestBuf;
+
+    UtPrintf("Testing: CFE_MSG_ValidateChecksum timing");
+
+    for (i = 0; i < sizeof(MsgChecksumTestBuf); i++)
+    {
+        BytePtr[i] = (uint8)((i * 131) + 7);
+    }
+
+    for (Size = 16; Size <= MSG_CHECKSUM_TEST_MAX_SIZE; Size *= 4)
+    {
+        MsgChecksumTestRun(Size);
+    }
+}
+
+int32 MSGChecksumTestSetup(int32 LibId)
+{
+    UtTest_Add(TestMsgChecksumTiming, NULL, NULL, "Test MSG Checksum Timing");
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: time_fast_test.c
+**
+** Purpose:
+**   Functional test and timing of the cached spacecraft time
+**
+**   Reports the average cost of CFE_TIME_GetTime() and CFE_TIME_GetTimeFast()
+**   and the largest amount the fast time falls outside the interval bracketed
+**   by two full CFE_TIME_GetTime() calls.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define TIME_FAST_TEST_ITERS       100000
+#define TIME_FAST_TEST_ERROR_ITERS 10000
+
+/* Allowed rounding difference between the two paths, in subseconds */
+#define TIME_FAST_TEST_MAX_ERROR 2
+
+static int64 TimeFastTestTimeCalls(CFE_TIME_SysTime_t (*GetTimeFunc)(void))
+{
+    OS_time_t          Start;
+    OS_time_t          End;
+    CFE_TIME_SysTime_t Sink;
+    uint32             i;
+
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < TIME_FAST_TEST_ITERS; i++)
+    {
+        Sink = GetTimeFunc();
+    }
+    OS_GetLocalTime(&End);
+
+    (void)Sink;
+
+    return OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / TIME_FAST_TEST_ITERS;
+}
+
+static uint32 TimeFastTestDistance(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t TimeB)
+{
+    CFE_TIME_SysTime_t Diff = CFE_TIME_Subtract(TimeA, TimeB);
+
+    /* Anything a whole second or more out saturates */
+    return (Diff.Seconds != 0) ? 0xFFFFFFFF : Diff.Subseconds;
+}
+
+void TestTimeFastAccuracy(void)
+{
+    CFE_TIME_SysTime_t Before;
+    CFE_TIME_SysTime_t Fast;
+    CFE_TIME_SysTime_t After;
+    uint32             Error;
+    uint32             MaxError = 0;
+    uint32             i;
+    int64              FullNs;
+    int64              FastNs;
+
+    UtPrintf("Testing: CFE_TIME_GetTimeFast accuracy and timing");
+
+    for (i = 0; i < TIME_FAST_TEST_ERROR_ITERS; i++)
+    {
+        Before = CFE_TIME_GetTime();
+        Fast   = CFE_TIME_GetTimeFast();
+        After  = CFE_TIME_GetTime();
+
+        Error = 0;
+        if (CFE_TIME_Compare(Fast, Before) == CFE_TIME_A_LT_B)
+        {
+            Error = TimeFastTestDistance(Before, Fast);
+        }
+        else if (CFE_TIME_Compare(Fast, After) == CFE_TIME_A_GT_B)
+        {
+            Error = TimeFastTestDistance(Fast, After);
+        }
+
+        if (Error > MaxError)
+        {
+            MaxError = Error;
+        }
+    }
+
+    UtPrintf("CFE_TIME_GetTimeFast max error outside CFE_TIME_GetTime bracket: %lu subseconds (%lu ns)",
+             (unsigned long)MaxError, (unsigned long)(((uint64)MaxError * 1000000000) >> 32));
+    UtAssert_True(MaxError <= TIME_FAST_TEST_MAX_ERROR, "Max error %lu <= %lu subseconds", (unsigned long)MaxError,
+                  (unsigned long)TIME_FAST_TEST_MAX_ERROR);
+
+    FullNs = TimeFastTestTimeCalls(CFE_TIME_GetTime);
+    FastNs = TimeFastTestTimeCalls(CFE_TIME_GetTimeFast);
+
+    UtPrintf("CFE_TIME_GetTime %ld ns/call, CFE_TIME_GetTimeFast %ld ns/call", (long)FullNs, (long)FastNs);
+}
+
+int32 TIMEFastTestSetup(int32 LibId)
+{
+    UtTest_Add(TestTimeFastAccuracy, NULL, NULL, "Test TIME Fast Accuracy");
+
+    return CFE_SUCCESS;
+}
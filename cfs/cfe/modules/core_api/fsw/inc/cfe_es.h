@@ -974,6 +974,8 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 ** \param[in]   InputCRC    A starting value for use in the CRC calculation.  This parameter
 **                          allows the user to calculate the CRC of non-contiguous blocks as
 **                          a single value.  Nominally, the user should set this value to zero.
+**                          For the 32 bit algorithms the initialization and final XOR are
+**                          applied internally, so passing the previous result continues the CRC.
 **
 ** \param[in]   TypeCRC     One of the following CRC algorithm selections:
 **                          \arg \c CFE_MISSION_ES_CRC_8 -  (Not currently implemented)
@@ -982,7 +984,16 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 **                                  Initialization: 0x0000 <BR>
 **                                  Reflect Input/Output: true <BR>
 **                                  XorOut: 0x0000
-**                          \arg \c CFE_MISSION_ES_CRC_32 - (not currently implemented)
+**                          \arg \c CFE_MISSION_ES_CRC_32 - CRC-32/ISO-HDLC (as used by zlib) <BR>
+**                                  Polynomial: 0x04C11DB7 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
+**                          \arg \c CFE_MISSION_ES_CRC_32C - CRC-32C/Castagnoli <BR>
+**                                  Polynomial: 0x1EDC6F41 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
 **
 ** \return The result of the CRC calculation on the specified memory block, or error code \ref CFEReturnCodes
 **
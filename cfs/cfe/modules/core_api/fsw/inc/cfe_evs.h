@@ -278,6 +278,37 @@ CFE_Status_t CFE_EVS_SendEventWithAppID(uint16 EventID, uint16 EventType, CFE_ES
 **/
 CFE_Status_t CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType, const char *Spec, ...)
     OS_PRINTF(4, 5);
+
+/**
+** \brief Selects whether the calling application's events are formatted by the EVS task
+**
+** \par Description
+**          With deferred formatting enabled, #CFE_EVS_SendEvent, #CFE_EVS_SendEventWithAppID and
+**          #CFE_EVS_SendTimedEvent do not expand the message text in the caller's context.  Once
+**          filtering passes, the event ID, type, time stamp, format string pointer and arguments
+**          are queued and the EVS task expands, logs and sends the event shortly afterwards.  This
+**          removes string formatting from time-critical loops.
+**
+** \par Assumptions, External Events, and Notes:
+**          The format string must remain valid until the application exits; string literals meet
+**          this.  String arguments are copied when the event is queued.  Events whose format uses
+**          a \c * width or precision, \c %n, wide characters or \c long \c double, or that have
+**          too many arguments, and events sent while the application's queue is full, are formatted
+**          immediately as if deferred formatting were disabled.  Registering with #CFE_EVS_Register
+**          disables deferred formatting.
+**
+** \param[in] Enable             true to queue events for the EVS task, false to format them immediately.
+**
+** \return Execution status below or from #CFE_ES_GetAppID, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                \copybrief CFE_SUCCESS
+** \retval #CFE_EVS_APP_NOT_REGISTERED \copybrief CFE_EVS_APP_NOT_REGISTERED
+** \retval #CFE_EVS_APP_ILLEGAL_APP_ID \copybrief CFE_EVS_APP_ILLEGAL_APP_ID
+** \retval #CFE_EVS_NOT_IMPLEMENTED    \copybrief CFE_EVS_NOT_IMPLEMENTED
+**
+** \sa #CFE_EVS_SendEvent, #CFE_EVS_SendEventWithAppID, #CFE_EVS_SendTimedEvent
+**
+**/
+CFE_Status_t CFE_EVS_SetDeferredFormat(bool Enable);
 /**@}*/
 
 /** @defgroup CFEAPIEVSResetFilter cFE Reset Event Filter APIs
@@ -90,6 +90,50 @@
 **/
 CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName);
 
+/*****************************************************************************/
+/**
+** \brief Creates a new software bus pipe with options.
+**
+** \par Description
+**          This routine is the same as #CFE_SB_CreatePipe, except that pipe options
+**          are applied as the pipe is created.  This is required for options that
+**          can only be chosen at creation time, such as #CFE_SB_PIPEOPTS_POLLABLE.
+**
+** \par Assumptions, External Events, and Notes:
+**          A pollable pipe has an OSAL stream, obtained with #CFE_SB_GetPipePollId,
+**          which may be waited on with OS_SelectSingle, OS_SelectMultiple or an OSAL
+**          poll set along with the application's sockets.  The stream becomes readable
+**          when a message is delivered to an empty pipe, and is cleared by the receive
+**          that empties the pipe, so the owner should receive with #CFE_SB_POLL until
+**          #CFE_SB_NO_MESSAGE after each wakeup.  Occasional spurious wakeups are possible.
+**
+**          Pollable pipes are not available on platforms where OSAL does not implement
+**          OS_SelectEventCreate.
+**
+** \param[in, out]  PipeIdPtr    A pointer to a variable of type #CFE_SB_PipeId_t,
+**                          which will be filled in with the pipe ID information
+**                          by the #CFE_SB_CreatePipeEx routine. *PipeIdPtr is the identifier for the created pipe.
+**
+** \param[in]  Depth        The maximum number of messages that will be allowed on
+**                          this pipe at one time.
+**
+** \param[in]  PipeName     A string to be used to identify this pipe in error messages
+**                          and routing information telemetry.  The string must be no
+**                          longer than #OS_MAX_API_NAME (including terminator).
+**                          Longer strings will be truncated.
+**
+** \param[in]  Opts         A bit field of options.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MAX_PIPES_MET \copybrief CFE_SB_MAX_PIPES_MET
+** \retval #CFE_SB_PIPE_CR_ERR   \copybrief CFE_SB_PIPE_CR_ERR
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_GetPipePollId #CFE_SB_PIPEOPTS_POLLABLE
+**/
+CFE_Status_t CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName, uint8 Opts);
+
 /*****************************************************************************/
 /**
 ** \brief Delete a software bus pipe.
@@ -160,6 +204,9 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx);
 ** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
 ** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
 **
+** \note #CFE_SB_PIPEOPTS_POLLABLE can only be chosen when the pipe is created, with
+**       #CFE_SB_CreatePipeEx, and is left unchanged by this routine.
+**
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_GetPipeIdByName #CFE_SB_PIPEOPTS_IGNOREMINE
 **/
 CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts);
@@ -183,6 +230,29 @@ CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts);
 **/
 CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptPtr);
 
+/*****************************************************************************/
+/**
+** \brief Get the OSAL stream that signals a pollable pipe.
+**
+** \par Description
+**          This routine gets the OSAL stream ID of a pipe created with
+**          #CFE_SB_PIPEOPTS_POLLABLE.  The stream is readable while messages may
+**          be waiting on the pipe, and can be added to OS_SelectMultiple sets or
+**          OSAL poll sets.  It is owned by SB and must not be closed or read by
+**          the application; it is released when the pipe is deleted.
+**
+** \param[in]  PipeId       The pipe ID of the pollable pipe.
+**
+** \param[out] *PollIdPtr   The OSAL stream ID.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipeEx #CFE_SB_PIPEOPTS_POLLABLE
+**/
+CFE_Status_t CFE_SB_GetPipePollId(CFE_SB_PipeId_t PipeId, osal_id_t *PollIdPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Get the pipe name for a given id.
@@ -463,6 +533,55 @@ CFE_Status_t CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenc
 ** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a batch of messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to MaxCount messages from the specified pipe
+**          in a single call.  If the pipe is empty, this routine will block until
+**          either a new message comes in or the timeout value is reached.  Once at
+**          least one message is available, any further messages already waiting on
+**          the pipe are returned as well, without blocking, up to MaxCount.
+**
+**          Compared to calling #CFE_SB_ReceiveBuffer in a loop, the pipe is validated
+**          and the SB internal data is locked once per batch rather than once per message.
+**
+** \par Assumptions, External Events, and Notes:
+**          - All buffers returned by this call are valid until the next call to
+**            CFE_SB_ReceiveBufferBatch or CFE_SB_ReceiveBuffer for the same pipe,
+**            at which point they are all released together.
+**          - MaxCount values larger than #CFE_PLATFORM_SB_MAX_RECEIVE_BATCH are limited
+**            to that value.
+**          - If an error occurs in this API, *CountPtr will be zero and the
+**            BufPtrArray content should not be used.
+**
+** \param[out] BufPtrArray  An array of at least MaxCount pointers.  After a successful call
+**                          the first *CountPtr entries point to the received software bus
+**                          buffers, in the order they were received.  These should be
+**                          used as read-only pointers.
+**
+** \param[in]  MaxCount     The maximum number of messages to return (size of BufPtrArray).
+**
+** \param[out] CountPtr     The number of messages returned in BufPtrArray.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut);
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -551,6 +670,9 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **             or writing) after a successful call to #CFE_SB_TransmitBuffer.
 **          -# This function will increment and apply the internally tracked
 **             sequence counter if set to do so.
+**          -# A buffer obtained from #CFE_SB_GetPublishBuffer is not consumed; it
+**             stays in its publish ring and is handed out again by
+**             #CFE_SB_GetPublishBuffer once all recipients have released it.
 **
 ** \param[in] BufPtr                 A pointer to the buffer to be sent.
 ** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
@@ -564,6 +686,75 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount);
 
+/*****************************************************************************/
+/**
+** \brief Create a ring of persistent "zero copy" publish buffers
+**
+** \par Description
+**          This routine preallocates \c Depth SB message buffers for one message ID
+**          and assigns them to the calling application.  Each buffer is cleared and
+**          its header initialized once with \c MsgId and \c MsgSize.  The application
+**          then fills a buffer from #CFE_SB_GetPublishBuffer in place and sends it
+**          with #CFE_SB_TransmitBuffer.  Buffers are never returned to the SB memory
+**          pool while the ring exists, so a steady publish cycle does no allocation
+**          and no copy of the message content.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only one ring may exist for a message ID.
+**          -# The ring is deleted with #CFE_SB_DeletePublishRing, or automatically
+**             when the owning application is deleted.
+**
+** \param[in]  MsgId    The message ID the buffers are published under.
+** \param[in]  MsgSize  The size of each message buffer, including the header.
+** \param[in]  Depth    Number of buffers, at most #CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_CreatePublishRing(CFE_SB_MsgId_t MsgId, size_t MsgSize, uint16 Depth);
+
+/*****************************************************************************/
+/**
+** \brief Get the next free buffer of a publish ring
+**
+** \par Description
+**          This routine returns the next buffer of the ring for \c MsgId that is
+**          not referenced by any recipient.  The header fields set at creation are
+**          preserved from the previous use of the buffer, so typically only the
+**          payload and time stamp need to be written before #CFE_SB_TransmitBuffer.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Buffers are handed out in ring order.  A buffer that was obtained but
+**             not transmitted is handed out again on a later call.
+**          -# Applications must not write to a buffer after transmitting it until it
+**             is returned by this function again.
+**
+** \param[in]  MsgId  The message ID of the ring.
+**
+** \return A pointer to a memory buffer for use with CFE_SB_TransmitBuffer(), or
+**         NULL if there is no ring for \c MsgId or all its buffers are in use.
+**/
+CFE_SB_Buffer_t *CFE_SB_GetPublishBuffer(CFE_SB_MsgId_t MsgId);
+
+/*****************************************************************************/
+/**
+** \brief Delete a publish ring
+**
+** \par Description
+**          This routine deletes the ring for \c MsgId created by the calling
+**          application.  Buffers not held by any recipient are returned to the SB
+**          memory pool immediately, the others when their last recipient releases them.
+**
+** \param[in]  MsgId  The message ID of the ring.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**/
+CFE_Status_t CFE_SB_DeletePublishRing(CFE_SB_MsgId_t MsgId);
+
 /** @} */
 
 /** @defgroup CFEAPISBSetMessage cFE Setting Message Characteristics APIs
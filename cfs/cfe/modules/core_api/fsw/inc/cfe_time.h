@@ -85,6 +85,30 @@
 ******************************************************************************/
 CFE_TIME_SysTime_t CFE_TIME_GetTime(void);
 
+/*****************************************************************************/
+/**
+** \brief Get the current spacecraft time from the cached time at tone
+**
+** \par Description
+**        Returns the same time as #CFE_TIME_GetTime, for callers such as packet
+**        stamping that need it at high rates.  TIME precomputes the default time
+**        at the tone whenever its reference data changes, so this routine only
+**        latches the local clock and adds the elapsed time to the cached value.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The result may differ from #CFE_TIME_GetTime by the rounding of
+**             the local clock to subseconds (one or two subseconds).
+**          -# Falls back to #CFE_TIME_GetTime before the first reference update,
+**             after a local clock rollover, or if the cache keeps changing while
+**             it is read.
+**
+** \return The current spacecraft time in default format
+**
+** \sa #CFE_TIME_GetTime, #CFE_TIME_GetTAI, #CFE_TIME_GetUTC
+**
+******************************************************************************/
+CFE_TIME_SysTime_t CFE_TIME_GetTimeFast(void);
+
 /*****************************************************************************/
 /**
 ** \brief Get the current TAI (MET + SCTF) time
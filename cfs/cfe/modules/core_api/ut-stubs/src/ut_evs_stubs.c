@@ -303,6 +303,17 @@ int32 CFE_EVS_ResetFilter(int16 EventID)
     return status;
 }
 
+int32 CFE_EVS_SetDeferredFormat(bool Enable)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_EVS_SetDeferredFormat), Enable);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_EVS_SetDeferredFormat);
+
+    return status;
+}
+
 int32 CFE_EVS_Unregister(void)
 {
     int32 status;
@@ -154,6 +154,40 @@ int32 CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *Pi
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_CreatePipeEx stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_CreatePipeEx.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName, uint8 Opts)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_CreatePipeEx), PipeIdPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeEx), Depth);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_CreatePipeEx), PipeName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePipeEx), Opts);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_CreatePipeEx);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_CreatePipeEx), (uint8 *)PipeIdPtr, sizeof(*PipeIdPtr));
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_DeletePipe stub function
@@ -321,6 +355,53 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_ReceiveBufferBatch stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_ReceiveBufferBatch.  On success, buffer pointers are copied from
+**        the test buffer until it is exhausted or MaxCount is reached, and the
+**        count reflects how many were copied.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns CFE_SUCCESS or overridden unit test value
+**
+******************************************************************************/
+int32 CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_ReceiveBufferBatch), BufPtrArray);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ReceiveBufferBatch), MaxCount);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_ReceiveBufferBatch), CountPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ReceiveBufferBatch), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_ReceiveBufferBatch), TimeOut);
+
+    int32  status;
+    uint32 Count;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_ReceiveBufferBatch);
+    Count  = 0;
+
+    if (status >= 0)
+    {
+        while (Count < MaxCount &&
+               UT_Stub_CopyToLocal(UT_KEY(CFE_SB_ReceiveBufferBatch), (uint8 *)&BufPtrArray[Count],
+                                   sizeof(BufPtrArray[Count])) == sizeof(BufPtrArray[Count]))
+        {
+            ++Count;
+        }
+    }
+
+    *CountPtr = Count;
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_TransmitMsg stub function
@@ -675,6 +756,23 @@ int32 CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptPtr)
     return status;
 }
 
+int32 CFE_SB_GetPipePollId(CFE_SB_PipeId_t PipeId, osal_id_t *PollIdPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_GetPipePollId), PipeId);
+    UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetPipePollId), PollIdPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_GetPipePollId);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_GetPipePollId), PollIdPtr, sizeof(*PollIdPtr));
+    }
+
+    return status;
+}
+
 size_t CFE_SB_GetUserDataLength(const CFE_MSG_Message_t *MsgPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(CFE_SB_GetUserDataLength), MsgPtr);
@@ -772,3 +870,44 @@ int32 CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
 
     return status;
 }
+
+int32 CFE_SB_CreatePublishRing(CFE_SB_MsgId_t MsgId, size_t MsgSize, uint16 Depth)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePublishRing), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePublishRing), MsgSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_CreatePublishRing), Depth);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_CreatePublishRing);
+
+    return status;
+}
+
+CFE_SB_Buffer_t *CFE_SB_GetPublishBuffer(CFE_SB_MsgId_t MsgId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_GetPublishBuffer), MsgId);
+
+    int32            status;
+    CFE_SB_Buffer_t *SBBufPtr = NULL;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_GetPublishBuffer);
+
+    if (status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_SB_GetPublishBuffer), &SBBufPtr, sizeof(SBBufPtr));
+    }
+
+    return SBBufPtr;
+}
+
+int32 CFE_SB_DeletePublishRing(CFE_SB_MsgId_t MsgId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_DeletePublishRing), MsgId);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_DeletePublishRing);
+
+    return status;
+}
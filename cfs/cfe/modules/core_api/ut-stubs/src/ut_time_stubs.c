@@ -148,6 +148,43 @@ CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
     return Result;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_TIME_GetTimeFast stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE TIME function
+**        CFE_TIME_GetTimeFast.  It increments the time structure values each
+**        time it's called to provide a non-static time value for the unit tests.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns the time structure.
+**
+******************************************************************************/
+CFE_TIME_SysTime_t CFE_TIME_GetTimeFast(void)
+{
+    static CFE_TIME_SysTime_t SimTime = {0};
+    CFE_TIME_SysTime_t        Result  = {0};
+    int32                     status;
+
+    status = UT_DEFAULT_IMPL(CFE_TIME_GetTimeFast);
+
+    if (status >= 0)
+    {
+        if (UT_Stub_CopyToLocal(UT_KEY(CFE_TIME_GetTimeFast), (uint8 *)&Result, sizeof(Result)) < sizeof(Result))
+        {
+            SimTime.Seconds++;
+            SimTime.Subseconds++;
+            Result = SimTime;
+        }
+    }
+
+    return Result;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_TIME_CleanUpApp stub function
@@ -33,6 +33,12 @@
 
 #define CFE_ES_PERF_32BIT_WORDS_IN_MASK ((CFE_MISSION_ES_PERF_MAX_IDS) / 32)
 
+/* Number of entries in the slice of the data buffer owned by each capture shard */
+#define CFE_ES_PERF_SHARD_SIZE ((CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) / (CFE_PLATFORM_ES_PERF_LOG_SHARDS))
+
+/* Flag set in a shard head once the log is stopped, no further entries are reserved in the shard */
+#define CFE_ES_PERF_SHARD_CLOSED 0x80000000
+
 typedef struct
 {
     uint32 Data;
@@ -66,9 +72,27 @@ typedef struct
     uint32          TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
 } CFE_ES_PerfMetaData_t;
 
+/*
+ * Write position of one capture shard.
+ *
+ * Head counts the entries reserved in the shard up to CFE_ES_PERF_SHARD_SIZE.
+ * Once the shard is full it stays in the range [CFE_ES_PERF_SHARD_SIZE, 2 * CFE_ES_PERF_SHARD_SIZE)
+ * so that (Head % CFE_ES_PERF_SHARD_SIZE) is always the next slot to write and, when full,
+ * also the oldest entry.  CFE_ES_PERF_SHARD_CLOSED is or'ed into the head when the log
+ * is stopped so that the dump reads a head that no writer can move any more.  The
+ * spare words keep each head on its own cache line so that tasks writing to different
+ * shards do not contend.
+ */
+typedef struct
+{
+    volatile uint32 Head;
+    uint32          Spare[15];
+} CFE_ES_PerfShard_t;
+
 typedef struct
 {
     CFE_ES_PerfMetaData_t  MetaData;
+    CFE_ES_PerfShard_t     Shard[CFE_PLATFORM_ES_PERF_LOG_SHARDS];
     CFE_ES_PerfDataEntry_t DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
 } CFE_ES_PerfData_t;
 
@@ -0,0 +1,81 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ * Purpose: CRC engine used by CFE_ES_CalculateCRC()
+ *
+ * Design Notes:
+ *   All routines operate on the raw, reflected CRC register.  Any
+ *   initial value and final XOR is applied by the caller, which keeps
+ *   the routines usable for continuing a CRC across multiple buffers.
+ *
+ */
+
+#ifndef CFE_ES_CRC_H
+#define CFE_ES_CRC_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Update a CRC-16/ARC register over a block of memory
+ *
+ * @param[in] Crc     Current register value (only the low 16 bits are used)
+ * @param[in] BufPtr  Pointer to the data
+ * @param[in] Len     Number of bytes of data
+ *
+ * @returns Updated register value, always in the range 0-0xFFFF
+ */
+uint32 CFE_ES_Crc16Update(uint32 Crc, const uint8 *BufPtr, size_t Len);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Update a CRC-32 (IEEE 802.3) register over a block of memory
+ *
+ * Uses the ARMv8 CRC32 instructions when the target provides them.
+ *
+ * @param[in] Crc     Current register value
+ * @param[in] BufPtr  Pointer to the data
+ * @param[in] Len     Number of bytes of data
+ *
+ * @returns Updated register value
+ */
+uint32 CFE_ES_Crc32Update(uint32 Crc, const uint8 *BufPtr, size_t Len);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Update a CRC-32C (Castagnoli) register over a block of memory
+ *
+ * Uses the ARMv8 CRC32C or x86 SSE4.2 instructions when the target provides them.
+ *
+ * @param[in] Crc     Current register value
+ * @param[in] BufPtr  Pointer to the data
+ * @param[in] Len     Number of bytes of data
+ *
+ * @returns Updated register value
+ */
+uint32 CFE_ES_Crc32cUpdate(uint32 Crc, const uint8 *BufPtr, size_t Len);
+
+#endif /* CFE_ES_CRC_H */
@@ -40,11 +40,79 @@
 #include <string.h>
 #include <stdlib.h>
 
+/*
+ * Lock-free mode relies on the GCC/Clang atomic builtins.  Other compilers
+ * always use the locked path.
+ */
+#if defined(__GNUC__) && defined(__ATOMIC_ACQ_REL)
+#define CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+#endif
+
+/*
+ * Layout of the tagged free stack top used in lock-free mode.
+ * The lower 32 bits hold the block offset and the upper 32 bits hold a
+ * tag which changes on every update, so a stale top cannot be swapped
+ * back in after the same block was popped and pushed again (ABA).
+ */
+#define CFE_ES_GENPOOL_STACK_OFFSET_MASK   ((uint64)0xFFFFFFFF)
+#define CFE_ES_GENPOOL_STACK_TAG_INCREMENT ((uint64)0x100000000)
+
 /*****************************************************************************/
 /*
 ** Functions
 */
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolSizeClass
+**
+**   Local helper function to get the power-of-two size class of a block size,
+**   which is the number of bits needed to represent (Size - 1).
+**---------------------------------------------------------------------------------------
+*/
+static inline uint16 CFE_ES_GenPoolSizeClass(size_t Size)
+{
+    uint16 Bits;
+
+    Bits = 0;
+    if (Size > 1)
+    {
+        --Size;
+#if defined(__GNUC__)
+        Bits = (sizeof(unsigned long long) * 8) - __builtin_clzll(Size);
+#else
+        while (Size != 0)
+        {
+            ++Bits;
+            Size >>= 1;
+        }
+#endif
+    }
+
+    return Bits;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolIncrementCounter
+**
+**   Local helper function to increment a statistics counter, atomically if the
+**   pool is in lock-free mode.
+**---------------------------------------------------------------------------------------
+*/
+static inline void CFE_ES_GenPoolIncrementCounter(const CFE_ES_GenPoolRecord_t *PoolRecPtr, uint32 *CounterPtr)
+{
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+    if (PoolRecPtr->LockFree)
+    {
+        __atomic_fetch_add(CounterPtr, 1, __ATOMIC_RELAXED);
+        return;
+    }
+#endif
+
+    ++(*CounterPtr);
+}
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GenPoolFindBucket
@@ -56,13 +124,16 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start at the first bucket that can hold the smallest request in the
+     * same size class.  If all block sizes are powers of two this is always
+     * the answer; otherwise only buckets within the same power-of-two range
+     * need to be skipped.
+     */
+    Index = PoolRecPtr->SizeClassBucket[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        ++Index;
     }
 
     /*
@@ -92,6 +163,172 @@ CFE_ES_GenPoolBucket_t *CFE_ES_GenPoolGetBucketState(CFE_ES_GenPoolRecord_t *Poo
     return &PoolRecPtr->Buckets[Index];
 }
 
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolRecycleLockFree
+**
+**   Local helper function to pop a previously returned block from the
+**   bucket free stack, lock-free variant of CFE_ES_GenPoolRecyclePoolBlock
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolRecycleLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                    size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                  DescOffset;
+    size_t                  BlockOffset;
+    uint64                  StackTop;
+    uint64                  NewStackTop;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    uint16                  RecycleBucketId;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL)
+    {
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    StackTop = __atomic_load_n(&BucketPtr->FreeStackTop, __ATOMIC_ACQUIRE);
+    do
+    {
+        BlockOffset = (size_t)(StackTop & CFE_ES_GENPOOL_STACK_OFFSET_MASK);
+        if (BlockOffset == 0)
+        {
+            /* no buffers in pool to recycle */
+            return CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+
+        DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        /*
+         * The next offset may be stale if another task popped this block in
+         * the meantime, but then the tag has changed and the exchange fails.
+         */
+        NewStackTop = (StackTop & ~CFE_ES_GENPOOL_STACK_OFFSET_MASK) + CFE_ES_GENPOOL_STACK_TAG_INCREMENT;
+        NewStackTop |= __atomic_load_n(&BdPtr->NextOffset, __ATOMIC_RELAXED) & CFE_ES_GENPOOL_STACK_OFFSET_MASK;
+    } while (!__atomic_compare_exchange_n(&BucketPtr->FreeStackTop, &StackTop, NewStackTop, true, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_ACQUIRE));
+
+    /* The block is now exclusively owned by this caller */
+    RecycleBucketId = BdPtr->Allocated - CFE_ES_MEMORY_DEALLOCATED;
+    if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || RecycleBucketId != BucketId)
+    {
+        /* sanity check failed - possible pool corruption? */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+    BdPtr->ActualSize = NewSize;
+    BdPtr->NextOffset = 0;
+
+    Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        *BlockOffsetPtr = BlockOffset;
+        CFE_ES_GenPoolIncrementCounter(PoolRecPtr, &BucketPtr->RecycleCount);
+    }
+
+    return Status;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolCreateLockFree
+**
+**   Local helper function to carve a new block from the pool tail,
+**   lock-free variant of CFE_ES_GenPoolCreatePoolBlock
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolCreateLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                   size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                  DescOffset;
+    size_t                  BlockOffset;
+    size_t                  TailPosition;
+    size_t                  NextTailPosition;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL)
+    {
+        /* no buffers in pool to create */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    /*
+     * Reserve the space first by advancing the tail, so concurrent
+     * callers always receive disjoint blocks.
+     */
+    TailPosition = __atomic_load_n(&PoolRecPtr->TailPosition, __ATOMIC_RELAXED);
+    do
+    {
+        BlockOffset = TailPosition + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        BlockOffset += PoolRecPtr->AlignMask;
+        BlockOffset &= ~PoolRecPtr->AlignMask;
+
+        NextTailPosition = BlockOffset + BucketPtr->BlockSize;
+        if (NextTailPosition > PoolRecPtr->PoolMaxOffset)
+        {
+            /* can't fit in remaining mem */
+            return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        }
+    } while (!__atomic_compare_exchange_n(&PoolRecPtr->TailPosition, &TailPosition, NextTailPosition, true,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+        BdPtr->ActualSize = NewSize;
+        BdPtr->NextOffset = 0;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_ES_GenPoolIncrementCounter(PoolRecPtr, &BucketPtr->AllocationCount);
+            CFE_ES_GenPoolIncrementCounter(PoolRecPtr, &PoolRecPtr->AllocationCount);
+
+            *BlockOffsetPtr = BlockOffset;
+        }
+    }
+
+    return Status;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolPushLockFree
+**
+**   Local helper function to push a released block onto the bucket free stack
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_GenPoolPushLockFree(CFE_ES_GenPoolBucket_t *BucketPtr, CFE_ES_GenPoolBD_t *BdPtr, size_t BlockOffset)
+{
+    uint64 StackTop;
+    uint64 NewStackTop;
+
+    StackTop = __atomic_load_n(&BucketPtr->FreeStackTop, __ATOMIC_RELAXED);
+    do
+    {
+        __atomic_store_n(&BdPtr->NextOffset, (size_t)(StackTop & CFE_ES_GENPOOL_STACK_OFFSET_MASK), __ATOMIC_RELAXED);
+        NewStackTop = (StackTop & ~CFE_ES_GENPOOL_STACK_OFFSET_MASK) + CFE_ES_GENPOOL_STACK_TAG_INCREMENT;
+        NewStackTop |= (uint64)BlockOffset;
+    } while (!__atomic_compare_exchange_n(&BucketPtr->FreeStackTop, &StackTop, NewStackTop, true, __ATOMIC_RELEASE,
+                                          __ATOMIC_RELAXED));
+}
+#endif
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GenPoolRecyclePoolBlock
@@ -110,6 +347,13 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
     uint16                  RecycleBucketId;
     int32                   Status;
 
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+    if (PoolRecPtr->LockFree)
+    {
+        return CFE_ES_GenPoolRecycleLockFree(PoolRecPtr, BucketId, NewSize, BlockOffsetPtr);
+    }
+#endif
+
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
     if (BucketPtr == NULL || BucketPtr->RecycleCount == BucketPtr->ReleaseCount || BucketPtr->FirstOffset == 0)
     {
@@ -169,6 +413,13 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
     CFE_ES_GenPoolBD_t *    BdPtr;
     int32                   Status;
 
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+    if (PoolRecPtr->LockFree)
+    {
+        return CFE_ES_GenPoolCreateLockFree(PoolRecPtr, BucketId, NewSize, BlockOffsetPtr);
+    }
+#endif
+
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
     if (BucketPtr == NULL)
     {
@@ -315,7 +566,46 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class lookup table - for each class, store the first
+     * bucket that can hold the smallest request size in that class, which
+     * is the first bucket whose own size class is not lower.
+     */
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++i)
+    {
+        while (j < NumBlockSizes && CFE_ES_GenPoolSizeClass(PoolRecPtr->Buckets[j].BlockSize) < i)
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassBucket[i] = j;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolEnableLockFree
+**
+**   ES Internal API - See Prototype for full API description
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+    /* block offsets must fit in the lower half of the tagged stack top */
+    if ((uint64)PoolRecPtr->PoolMaxOffset > CFE_ES_GENPOOL_STACK_OFFSET_MASK)
+    {
+        return CFE_ES_NOT_IMPLEMENTED;
+    }
+
+    PoolRecPtr->LockFree = true;
+
     return CFE_SUCCESS;
+#else
+    return CFE_ES_NOT_IMPLEMENTED;
+#endif
 }
 
 /*
@@ -439,6 +729,9 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
     CFE_ES_GenPoolBD_t *    BdPtr;
     int32                   Status;
     uint16                  BucketId;
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+    uint16                  AllocatedFlag;
+#endif
 
     if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
     {
@@ -458,9 +751,34 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
             BucketPtr->BlockSize < BdPtr->ActualSize)
         {
             /* This does not appear to be a valid data buffer */
-            ++PoolRecPtr->ValidationErrorCount;
+            CFE_ES_GenPoolIncrementCounter(PoolRecPtr, &PoolRecPtr->ValidationErrorCount);
             Status = CFE_ES_POOL_BLOCK_INVALID;
         }
+#ifdef CFE_ES_GENPOOL_LOCK_FREE_AVAILABLE
+        else if (PoolRecPtr->LockFree)
+        {
+            /*
+             * Only one release of the block may clear the flag.  Another release
+             * of the same block that got there first makes this a double free,
+             * reported as an invalid block like the locked path does.
+             */
+            AllocatedFlag = CFE_ES_MEMORY_ALLOCATED + BucketId;
+            if (!__atomic_compare_exchange_n(&BdPtr->Allocated, &AllocatedFlag, CFE_ES_MEMORY_DEALLOCATED + BucketId,
+                                             false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+            {
+                CFE_ES_GenPoolIncrementCounter(PoolRecPtr, &PoolRecPtr->ValidationErrorCount);
+                Status = CFE_ES_POOL_BLOCK_INVALID;
+            }
+            else
+            {
+                *BlockSizePtr = BdPtr->ActualSize;
+
+                /* count the release first so the free count never reads negative */
+                CFE_ES_GenPoolIncrementCounter(PoolRecPtr, &BucketPtr->ReleaseCount);
+                CFE_ES_GenPoolPushLockFree(BucketPtr, BdPtr, BlockOffset);
+            }
+        }
+#endif
         else
         {
             BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
@@ -51,6 +51,12 @@
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of power-of-two size classes in the bucket lookup table.
+ * Class N covers request sizes in the range (2^(N-1), 2^N], class 0 covers sizes 0 and 1.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES ((sizeof(size_t) * 8) + 1)
+
 /*
 ** Type Definitions
 */
@@ -70,6 +76,7 @@ typedef struct CFE_ES_GenPoolBucket
     uint32 AllocationCount; /**< Total number of buffers of this block size that exist (initial get) */
     uint32 ReleaseCount;    /**< Total number of buffers that have been released (put back) */
     uint32 RecycleCount;    /**< Total number of buffers that have been recycled (get after put) */
+    uint64 FreeStackTop;    /**< Lock-free mode only: top of the free stack, ABA tag in the upper 32 bits */
 } CFE_ES_GenPoolBucket_t;
 
 /*
@@ -114,6 +121,10 @@ struct CFE_ES_GenPoolRecord
     uint32 AllocationCount;      /**< Total number of block allocations of any size */
     uint32 ValidationErrorCount; /**< Count of validation errors */
 
+    bool LockFree; /**< Free stacks and tail position are updated with atomic operations, no lock required */
+
+    uint8 SizeClassBucket[CFE_ES_GENERIC_POOL_SIZE_CLASSES]; /**< First bucket index to check for each size class */
+
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
 };
@@ -144,6 +155,40 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/**
+ * \brief Find the bucket for a requested block size
+ *
+ * Uses the size class table built by CFE_ES_GenPoolInitialize() to locate
+ * the smallest bucket that can hold the request.
+ *
+ * \param[in] PoolRecPtr     Pointer to pool structure
+ * \param[in] ReqSize        Size of block requested
+ *
+ * \return Nonzero bucket ID, or 0 if the request is larger than every bucket
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
+/**
+ * \brief Switch a generic pool to lock-free operation
+ *
+ * After this call the get and put operations on the pool may be invoked
+ * concurrently from multiple tasks without any external lock.  Each bucket
+ * free list becomes a tagged Treiber stack and new blocks are carved from
+ * the pool tail with a compare-and-swap.
+ *
+ * This must be called immediately after CFE_ES_GenPoolInitialize(), before
+ * any blocks are allocated.  It is only valid for memory mapped pools, where
+ * the retrieve function outputs a direct pointer into the pool storage and
+ * the commit function is a no-op.  Pools that use CFE_ES_GenPoolRebuild()
+ * must keep the locked path.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ *
+ * \return #CFE_SUCCESS, or #CFE_ES_NOT_IMPLEMENTED if the compiler or pool
+ * size does not permit lock-free operation
+ */
+int32 CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr);
+
 /**
  * \brief Gets a block from the pool
  *
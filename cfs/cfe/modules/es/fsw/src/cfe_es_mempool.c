@@ -249,6 +249,16 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, uint8 *MemPtr, size_t Size
     Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
                                       CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
 
+    /*
+     * Memory mapped pools may use lock-free free lists in place of the mutex,
+     * if the platform enables it and the compiler supports it.
+     */
+    if (Status == CFE_SUCCESS && UseMutex == CFE_ES_USE_MUTEX && CFE_PLATFORM_ES_MEMPOOL_LOCK_FREE &&
+        CFE_ES_GenPoolEnableLockFree(&PoolRecPtr->Pool) == CFE_SUCCESS)
+    {
+        UseMutex = CFE_ES_NO_MUTEX;
+    }
+
     /*
      * If successful, complete the process.
      */
@@ -53,5 +53,6 @@
 #include "cfe_es_task.h"
 #include "cfe_es_resource.h"
 #include "cfe_es_log.h"
+#include "cfe_es_crc.h"
 
 #endif /* CFE_ES_MODULE_ALL_H */
@@ -33,6 +33,176 @@
 
 #include <string.h>
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfAtomicIncrement                                              */
+/*                                                                               */
+/* Purpose: Increment a performance log counter and return the new value.       */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*  Uses the compiler atomic builtins where available so that recording an      */
+/*  entry never blocks.  Other compilers fall back to the perf data mutex.       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfAtomicIncrement(uint32 *Counter)
+{
+#if defined(__GNUC__)
+    return __atomic_add_fetch(Counter, 1, __ATOMIC_RELAXED);
+#else
+    uint32 Value;
+
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    Value    = *Counter + 1;
+    *Counter = Value;
+    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+    return Value;
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfReserveSlot                                                  */
+/*                                                                               */
+/* Purpose: Reserve the next entry of a capture shard and get its position      */
+/*          within the shard.                                                    */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*  See CFE_ES_PerfShard_t for the range kept by the head.  Returns false,       */
+/*  without reserving anything, once the shard has been closed.                  */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CFE_ES_PerfReserveSlot(CFE_ES_PerfShard_t *Shard, uint32 *Slot)
+{
+    uint32 Head;
+    uint32 NextHead;
+
+#if defined(__GNUC__)
+    Head = __atomic_load_n(&Shard->Head, __ATOMIC_RELAXED);
+    do
+    {
+        if (Head & CFE_ES_PERF_SHARD_CLOSED)
+        {
+            return false;
+        }
+        NextHead = Head + 1;
+        if (NextHead >= (2 * CFE_ES_PERF_SHARD_SIZE))
+        {
+            NextHead = CFE_ES_PERF_SHARD_SIZE;
+        }
+    } while (!__atomic_compare_exchange_n(&Shard->Head, &Head, NextHead, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    Head = Shard->Head;
+    if (Head & CFE_ES_PERF_SHARD_CLOSED)
+    {
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+        return false;
+    }
+    NextHead = Head + 1;
+    if (NextHead >= (2 * CFE_ES_PERF_SHARD_SIZE))
+    {
+        NextHead = CFE_ES_PERF_SHARD_SIZE;
+    }
+    Shard->Head = NextHead;
+    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+#endif
+
+    *Slot = Head % CFE_ES_PERF_SHARD_SIZE;
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfCloseShards                                                  */
+/*                                                                               */
+/* Purpose: Close all capture shards so that no further entries are reserved.   */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*  Writers that reserved a slot just before the close may still be copying     */
+/*  their entry; the dump gives them a delay cycle before reading the log.      */
+/*  The shards are opened again by resetting the heads on start.                */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfCloseShards(CFE_ES_PerfData_t *Perf)
+{
+    uint32 i;
+
+#if defined(__GNUC__)
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+    {
+        __atomic_fetch_or(&Perf->Shard[i].Head, CFE_ES_PERF_SHARD_CLOSED, __ATOMIC_SEQ_CST);
+    }
+#else
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+    {
+        Perf->Shard[i].Head |= CFE_ES_PERF_SHARD_CLOSED;
+    }
+    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+#endif
+}
+
+#if defined(__GNUC__)
+/* Shard of the calling task plus one, zero until the task first records an entry */
+static __thread uint32 CFE_ES_PerfTaskShard;
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfGetShard                                                     */
+/*                                                                               */
+/* Purpose: Select the capture shard used by the calling task.                   */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*  Callers that are not OSAL tasks all share the first shard.  Where thread    */
+/*  local storage is available the shard is looked up once per task.            */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfGetShard(void)
+{
+    osal_index_t TaskIndex;
+    uint32       Shard;
+
+    if (CFE_PLATFORM_ES_PERF_LOG_SHARDS == 1)
+    {
+        return 0;
+    }
+
+#if defined(__GNUC__)
+    if (CFE_ES_PerfTaskShard != 0)
+    {
+        return CFE_ES_PerfTaskShard - 1;
+    }
+#endif
+
+    Shard = 0;
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OS_TaskGetId(), &TaskIndex) == OS_SUCCESS)
+    {
+        Shard = (uint32)TaskIndex % CFE_PLATFORM_ES_PERF_LOG_SHARDS;
+    }
+
+#if defined(__GNUC__)
+    CFE_ES_PerfTaskShard = Shard + 1;
+#endif
+
+    return Shard;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfShardCount                                                   */
+/*                                                                               */
+/* Purpose: Get the number of entries held by a capture shard.                   */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfShardCount(const CFE_ES_PerfShard_t *Shard)
+{
+    uint32 Head = Shard->Head & ~CFE_ES_PERF_SHARD_CLOSED;
+
+    if (Head > CFE_ES_PERF_SHARD_SIZE)
+    {
+        Head = CFE_ES_PERF_SHARD_SIZE;
+    }
+
+    return Head;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /* Name: CFE_ES_SetupPerfVariables                                               */
 /*                                                                               */
@@ -89,6 +259,11 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         Perf->MetaData.InvalidMarkerReported = false;
         Perf->MetaData.FilterTriggerMaskSize = CFE_ES_PERF_32BIT_WORDS_IN_MASK;
 
+        for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+        {
+            Perf->Shard[i].Head = 0;
+        }
+
         for (i = 0; i < CFE_ES_PERF_32BIT_WORDS_IN_MASK; i++)
         {
             Perf->MetaData.FilterMask[i]  = CFE_PLATFORM_ES_PERF_FILTMASK_INIT;
@@ -141,6 +316,34 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                               */
+/* CFE_ES_UpdatePerfLogCounts() --                                               */
+/* Refresh the metadata counters from the capture shards                         */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_UpdatePerfLogCounts(void)
+{
+    CFE_ES_PerfData_t *Perf;
+    uint32             DataCount;
+    uint32             i;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    DataCount = 0;
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+    {
+        DataCount += CFE_ES_PerfShardCount(&Perf->Shard[i]);
+    }
+
+    Perf->MetaData.DataStart = 0;
+    Perf->MetaData.DataEnd   = DataCount % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataCount = DataCount;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                               */
 /* CFE_ES_StartPerfDataCmd() --                                                  */
@@ -151,6 +354,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
     const CFE_ES_StartPerfCmd_Payload_t *CmdPtr        = &data->Payload;
     CFE_ES_PerfDumpGlobal_t *            PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
     CFE_ES_PerfData_t *                  Perf;
+    uint32                               i;
 
     /*
     ** Set the pointer to the data area
@@ -169,15 +373,21 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             CFE_ES_Global.TaskData.CommandCounter++;
 
             /* Taking lock here as this might be changing states from one active mode to another.
-             * In that case, need to make sure that the log is not written to while resetting the counters. */
+             * Writers do not take the lock, so also set the state to idle while resetting
+             * the counters to keep new entries out of the log until the reset is complete. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            Perf->MetaData.State                 = CFE_ES_PERF_IDLE;
             Perf->MetaData.Mode                  = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount          = 0;
             Perf->MetaData.DataStart             = 0;
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+            {
+                Perf->Shard[i].Head = 0;
+            }
+            Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -225,7 +435,10 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
         PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
     {
+        /* close the shards so the heads read by the dump can no longer move */
         Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        CFE_ES_PerfCloseShards(Perf);
+        CFE_ES_UpdatePerfLogCounts();
 
         /* Copy out the string, using default if unspecified */
         Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName, CmdPtr->DataFileName,
@@ -265,6 +478,43 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     return CFE_SUCCESS;
 } /* End of CFE_ES_StopPerfDataCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfDumpNextShard                                                */
+/*                                                                               */
+/* Purpose: Find the shard holding the oldest entry that is still to be written */
+/*          to the dump file.                                                    */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*  Entries are compared by time base (TimerUpper32 then TimerLower32).  Returns */
+/*  CFE_PLATFORM_ES_PERF_LOG_SHARDS if all of the shards have been written.      */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfDumpNextShard(const CFE_ES_PerfDumpGlobal_t *State, const CFE_ES_PerfData_t *Perf)
+{
+    const CFE_ES_PerfDataEntry_t *Entry;
+    const CFE_ES_PerfDataEntry_t *Oldest;
+    uint32                        Result;
+    uint32                        i;
+
+    Result = CFE_PLATFORM_ES_PERF_LOG_SHARDS;
+    Oldest = NULL;
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+    {
+        if (State->ShardLeft[i] != 0)
+        {
+            Entry = &Perf->DataBuffer[(i * CFE_ES_PERF_SHARD_SIZE) + State->ShardPos[i]];
+            if (Oldest == NULL || Entry->TimerUpper32 < Oldest->TimerUpper32 ||
+                (Entry->TimerUpper32 == Oldest->TimerUpper32 && Entry->TimerLower32 < Oldest->TimerLower32))
+            {
+                Oldest = Entry;
+                Result = i;
+            }
+        }
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*  Function:  CFE_ES_RunPerfLogDump()                                           */
 /*                                                                               */
@@ -285,6 +535,8 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     CFE_FS_Header_t          FileHdr;
     size_t                   BlockSize;
     CFE_ES_PerfData_t *      Perf;
+    uint32                   Shard;
+    uint32                   i;
 
     /*
     ** Set the pointer to the data area
@@ -355,6 +607,9 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
                 case CFE_ES_PerfDumpState_LOCK_DATA:
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+                    /* entries may have been added until the delay state, recount before writing the metadata */
+                    CFE_ES_UpdatePerfLogCounts();
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
@@ -363,8 +618,17 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    State->DataPos      = Perf->MetaData.DataStart;
-                    State->StateCounter = Perf->MetaData.DataCount;
+                    for (i = 0; i < CFE_PLATFORM_ES_PERF_LOG_SHARDS; i++)
+                    {
+                        State->ShardLeft[i] = CFE_ES_PerfShardCount(&Perf->Shard[i]);
+                        State->ShardPos[i]  = (Perf->Shard[i].Head & ~CFE_ES_PERF_SHARD_CLOSED) % CFE_ES_PERF_SHARD_SIZE;
+                        if (State->ShardLeft[i] < CFE_ES_PERF_SHARD_SIZE)
+                        {
+                            /* shard has not wrapped, oldest entry is the first one */
+                            State->ShardPos[i] = 0;
+                        }
+                        State->StateCounter += State->ShardLeft[i];
+                    }
                     break;
 
                 case CFE_ES_PerfDumpState_UNLOCK_DATA:
@@ -454,13 +718,21 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
-                    Status    = OS_write(State->FileDesc, &Perf->DataBuffer[State->DataPos], BlockSize);
-
-                    ++State->DataPos;
-                    if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+                    /* merge the shards, always writing the oldest remaining entry next */
+                    Shard = CFE_ES_PerfDumpNextShard(State, Perf);
+                    if (Shard < CFE_PLATFORM_ES_PERF_LOG_SHARDS)
                     {
-                        State->DataPos = 0;
+                        BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
+                        Status    = OS_write(State->FileDesc,
+                                          &Perf->DataBuffer[(Shard * CFE_ES_PERF_SHARD_SIZE) + State->ShardPos[Shard]],
+                                          BlockSize);
+
+                        --State->ShardLeft[Shard];
+                        ++State->ShardPos[Shard];
+                        if (State->ShardPos[Shard] >= CFE_ES_PERF_SHARD_SIZE)
+                        {
+                            State->ShardPos[Shard] = 0;
+                        }
                     }
                     break;
 
@@ -579,11 +851,11 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 /*                                                                               */
 /* Assumptions and Notes:                                                        */
 /*                                                                               */
-/*  This function implements a circular buffer using an array.                   */
-/*      DataStart points to first stored entry                                   */
-/*      DataEnd points to next available entry                                   */
-/*      if DataStart == DataEnd then the buffer is either empty or full          */
-/*      depending on the value of the DataCount                                  */
+/*  The data buffer is split into CFE_PLATFORM_ES_PERF_LOG_SHARDS circular      */
+/*  buffers.  Each task writes to the shard selected by its task index, and      */
+/*  reserves its slot with an atomic update of the shard head rather than       */
+/*  taking the perf data mutex.  The shards are merged by time stamp when the   */
+/*  log is written to a file.                                                    */
 /*                                                                               */
 /*  Time is stored as 2 32 bit integers, (TimerLower32, TimerUpper32):           */
 /*      TimerLower32 is the curent value of the hardware timer register.         */
@@ -598,7 +870,10 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
     CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
+    uint32                 Shard;
+    uint32                 Slot;
+    uint32                 TriggerCount;
+    bool                   Triggered;
     CFE_ES_PerfData_t *    Perf;
 
     /*
@@ -607,7 +882,7 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
     /*
-     * If the global state is idle, exit immediately without locking or doing anything
+     * If the global state is idle, exit immediately without doing anything
      */
     if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
     {
@@ -630,95 +905,63 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
     /*
      * check if this ID is filtered.
-     * This is also done outside the lock -
      * normally masks should NOT be changed while perf log is active / non-idle,
-     * so although this is reading a global it should be constant, and this avoids
-     * locking (and potential task switch) if the data is ultimately not going to
-     * be written to the log.
+     * so although this is reading a global it should be constant.
      */
     if (!CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker))
     {
         return;
     }
 
-    /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
-     */
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
     CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
 
-    /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
-     */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    Shard     = CFE_ES_PerfGetShard();
+    Triggered = (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED);
 
-    /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
-     */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
+    /* waiting for trigger */
+    if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
     {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
-
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
         {
-            DataEnd = 0;
+            Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+            Triggered            = true;
         }
-        Perf->MetaData.DataEnd = DataEnd;
+    }
 
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            Perf->MetaData.DataCount++;
-        }
-        else
-        {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
-        }
+    /*
+     * Reserve a slot in the shard of this task and copy the data to it.
+     * No lock is taken here; the shards are closed when the log is stopped and
+     * the background dump gives writes already started time to finish.
+     */
+    if (!CFE_ES_PerfReserveSlot(&Perf->Shard[Shard], &Slot))
+    {
+        return;
+    }
+    Perf->DataBuffer[(Shard * CFE_ES_PERF_SHARD_SIZE) + Slot] = EntryData;
 
-        /* waiting for trigger */
-        if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
+    /* triggered */
+    if (Triggered)
+    {
+        TriggerCount = CFE_ES_PerfAtomicIncrement(&Perf->MetaData.TriggerCount);
+        if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START)
         {
-            if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+            if (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
             {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+                Perf->MetaData.State = CFE_ES_PERF_IDLE;
             }
         }
-
-        /* triggered */
-        if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+        else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER)
         {
-            Perf->MetaData.TriggerCount++;
-            if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)
+            if (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
             {
                 Perf->MetaData.State = CFE_ES_PERF_IDLE;
             }
         }
+        else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)
+        {
+            Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        }
     }
 
-    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
-
 } /* end CFE_ES_PerfLogAdd */
@@ -38,6 +38,7 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_platform_cfg.h"
 
 /*
 **  Defines
@@ -108,7 +109,8 @@ typedef struct
     osal_id_t FileDesc;                      /* file descriptor for writing */
     uint32    WorkCredit;                    /* accumulator based on the passage of time */
     uint32    StateCounter;                  /* number of blocks/items left in current state */
-    uint32    DataPos;                       /* last position within the Perf Log */
+    uint32    ShardPos[CFE_PLATFORM_ES_PERF_LOG_SHARDS];  /* next entry to write from each shard */
+    uint32    ShardLeft[CFE_PLATFORM_ES_PERF_LOG_SHARDS]; /* number of entries left to write from each shard */
     size_t    FileSize;                      /* Total file size, for progress reporing in telemetry */
 } CFE_ES_PerfDumpGlobal_t;
 
@@ -126,6 +128,17 @@ typedef struct
  */
 uint32 CFE_ES_GetPerfLogDumpRemaining(void);
 
+/*
+ * Update the DataStart, DataEnd and DataCount members of the
+ * performance log metadata from the write positions of the
+ * capture shards.
+ *
+ * The shards are merged into a single linear log when written to
+ * a file, so the metadata describes that merged log: it starts at
+ * entry 0 and holds the sum of the entries in all shards.
+ */
+void CFE_ES_UpdatePerfLogCounts(void);
+
 /*
  * Implementation of the background state machine for writing
  * performance log data.
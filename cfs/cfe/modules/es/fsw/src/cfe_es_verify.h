@@ -142,6 +142,15 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Performance data capture shards
+*/
+#if CFE_PLATFORM_ES_PERF_LOG_SHARDS < 1
+#error CFE_PLATFORM_ES_PERF_LOG_SHARDS cannot be less than 1!
+#elif (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE % CFE_PLATFORM_ES_PERF_LOG_SHARDS) != 0
+#error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE must be a multiple of CFE_PLATFORM_ES_PERF_LOG_SHARDS!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -165,6 +174,13 @@
 #error CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN must be a power of 2!
 #endif
 
+/*
+**  Pool size class table stores bucket indices as uint8
+*/
+#if CFE_PLATFORM_ES_POOL_MAX_BUCKETS > 255
+#error CFE_PLATFORM_ES_POOL_MAX_BUCKETS cannot be greater than 255!
+#endif
+
 /*
 **  Intermediate ES Memory Pool Block Sizes
 */
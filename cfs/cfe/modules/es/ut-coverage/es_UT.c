@@ -593,9 +593,11 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
     UT_ADD_TEST(TestAPI);
+    UT_ADD_TEST(TestCRC);
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestGenericPool);
+    UT_ADD_TEST(TestGenericPoolLockFree);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
     UT_ADD_TEST(TestSysLog);
@@ -2162,6 +2164,110 @@ void TestGenericPool(void)
     UtAssert_True(!CFE_ES_GenPoolValidateState(&Pool1), "Validate Corrupt handle");
 }
 
+void TestGenericPoolLockFree(void)
+{
+    CFE_ES_GenPoolRecord_t Pool1;
+    size_t                 Offset1;
+    size_t                 Offset2;
+    size_t                 Offset3;
+    size_t                 Offset4;
+    size_t                 OffsetEnd;
+    size_t                 BlockSize;
+    size_t                 ReqSize;
+    uint16                 Expected;
+    uint16                 NumBlocks;
+    uint32                 CountBuf;
+    uint32                 ErrBuf;
+    CFE_ES_BlockStats_t    BlockStats;
+    static const size_t    UT_POOL_BLOCK_SIZES[] = {100, 8, 24, 256, 12, 64, 1000, 32};
+
+    ES_ResetUnitTest();
+
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    OffsetEnd = sizeof(UT_MemPoolDirectBuffer.Data);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 16, 8, UT_POOL_BLOCK_SIZES,
+                                               ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit),
+                      CFE_SUCCESS);
+
+    /* The size class lookup must agree with a linear scan for every request size */
+    for (ReqSize = 0; ReqSize <= 1001; ++ReqSize)
+    {
+        Expected = 0;
+        while (Expected < Pool1.NumBuckets && ReqSize > Pool1.Buckets[Expected].BlockSize)
+        {
+            ++Expected;
+        }
+        Expected = Pool1.NumBuckets - Expected;
+
+        if (CFE_ES_GenPoolFindBucket(&Pool1, ReqSize) != Expected)
+        {
+            UtAssert_Failed("FindBucket(%lu) != %u", (unsigned long)ReqSize, (unsigned int)Expected);
+            break;
+        }
+    }
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 1000), 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 1001), 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 1), 8);
+
+    /* Test switching to lock-free mode, nominal get/put/recycle */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolEnableLockFree(&Pool1), CFE_SUCCESS);
+    UtAssert_True(Pool1.LockFree, "Pool is lock-free");
+
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 24), CFE_SUCCESS);
+    UtAssert_True(Offset2 > Offset1, "Offset(%lu) > Offset(%lu)", (unsigned long)Offset2, (unsigned long)Offset1);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(BlockSize, 20);
+
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(BlockSize, 20);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(BlockSize, 24);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, CFE_ES_GenPoolFindBucket(&Pool1, 24), &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 2);
+
+    /* double put is rejected */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* recycled in LIFO order */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset3, 17), CFE_SUCCESS);
+    UtAssert_True(Offset3 == Offset2, "Offset(%lu) match", (unsigned long)Offset3);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 18), CFE_SUCCESS);
+    UtAssert_True(Offset4 == Offset1, "Offset(%lu) match", (unsigned long)Offset4);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, CFE_ES_GenPoolFindBucket(&Pool1, 24), &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 0);
+
+    CFE_ES_GenPoolGetCounts(&Pool1, &NumBlocks, &CountBuf, &ErrBuf);
+    UtAssert_UINT32_EQ(NumBlocks, 8);
+    UtAssert_UINT32_EQ(CountBuf, 2);
+    UtAssert_UINT32_EQ(ErrBuf, 1);
+
+    /* A corrupted free block is not recycled, a new one is created instead */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset3), CFE_SUCCESS);
+    memset(&UT_MemPoolDirectBuffer.Data[Offset3 - sizeof(CFE_ES_GenPoolBD_t)], 0xee, sizeof(uint16));
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 24), CFE_SUCCESS);
+    UtAssert_True(Offset2 > Offset1 && Offset2 != Offset3, "Offset(%lu) is new", (unsigned long)Offset2);
+
+    /* Exhaust the pool */
+    while (CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 64) == CFE_SUCCESS)
+    {
+        /* keep allocating */
+    }
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 64), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_True(CFE_ES_GenPoolValidateState(&Pool1), "Nominal Handle validation");
+
+    /* Offsets must fit in the tagged free stack word */
+    if (sizeof(size_t) > sizeof(uint32))
+    {
+        Pool1.LockFree      = false;
+        Pool1.PoolMaxOffset = ~((size_t)0);
+        UtAssert_INT32_EQ(CFE_ES_GenPoolEnableLockFree(&Pool1), CFE_ES_NOT_IMPLEMENTED);
+        UtAssert_True(!Pool1.LockFree, "Pool is not lock-free");
+    }
+}
+
 void TestTask(void)
 {
     uint32    ResetType;
@@ -3240,10 +3346,13 @@ void TestPerf(void)
         CFE_ES_SetPerfFilterMaskCmd_t  PerfSetFilterMaskCmd;
         CFE_ES_SetPerfTriggerMaskCmd_t PerfSetTrigMaskCmd;
     } CmdBuf;
+    CFE_ES_PerfDataEntry_t DumpEntries[4];
 
     UtPrintf("Begin Test Performance Log");
 
     CFE_ES_PerfData_t *Perf;
+    uint32             UtShard;
+    uint32             UtShardBase;
 
     /*
     ** Set the pointer to the data area
@@ -3338,6 +3447,7 @@ void TestPerf(void)
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd), UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
     UT_Report(__FILE__, __LINE__, UT_EventIsInHistory(CFE_ES_PERF_STOPCMD_EID), "CFE_ES_StopPerfDataCmd",
               "Stop collecting performance data");
+    UtAssert_True((Perf->Shard[0].Head & CFE_ES_PERF_SHARD_CLOSED) != 0, "Shard closed by stop");
 
     /* Test performance data collection stop with a file name validation issue */
     ES_ResetUnitTest();
@@ -3432,6 +3542,7 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     Perf->MetaData.InvalidMarkerReported = true;
     Perf->MetaData.Mode                  = CFE_ES_PERF_TRIGGER_START;
     Perf->MetaData.DataCount             = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
@@ -3445,6 +3556,7 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode         = CFE_ES_PERF_TRIGGER_CENTER;
     Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1;
@@ -3457,6 +3569,7 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode  = CFE_ES_PERF_TRIGGER_END;
     CFE_ES_PerfLogAdd(1, 0);
@@ -3478,22 +3591,83 @@ void TestPerf(void)
      * is not in the filter mask
      */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.FilterMask[0] = 0x0;
-    Perf->MetaData.DataEnd       = 0;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UT_Report(__FILE__, __LINE__, Perf->MetaData.DataEnd == 0, "CFE_ES_PerfLogAdd", "Marker not in filter mask");
+    CFE_ES_UpdatePerfLogCounts();
+    UT_Report(__FILE__, __LINE__, Perf->MetaData.DataCount == 0, "CFE_ES_PerfLogAdd", "Marker not in filter mask");
 
     /* Test addition of a new entry to the performance log with the data count
      * below the maximum allowed
      */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.DataCount     = 0;
     Perf->MetaData.FilterMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_UpdatePerfLogCounts();
     UT_Report(__FILE__, __LINE__, Perf->MetaData.DataCount == 1, "CFE_ES_PerfLogAdd", "Data count below maximum");
 
+    /* The shard of this task is looked up once, find it for the tests below */
+    for (UtShard = 0; UtShard < CFE_PLATFORM_ES_PERF_LOG_SHARDS - 1 && Perf->Shard[UtShard].Head == 0; UtShard++)
+    {
+    }
+    UtAssert_UINT32_EQ(Perf->Shard[UtShard].Head, 1);
+    UtShardBase = UtShard * CFE_ES_PERF_SHARD_SIZE;
+
+    /* Test that the shard of a task is not looked up again */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.TriggerMask[0] = 0;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->Shard[UtShard].Head, 2);
+    UtAssert_STUB_COUNT(OS_ObjectIdToArrayIndex, 0);
+
+    /* Test addition of a new entry to a full shard, which overwrites the oldest
+     * entry of that shard and keeps the shard count at its maximum
+     */
+    ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
+    Perf->Shard[UtShard].Head                                       = 2 * CFE_ES_PERF_SHARD_SIZE - 1;
+    Perf->MetaData.State                                            = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]                                    = 0xffff;
+    Perf->MetaData.TriggerMask[0]                                   = 0;
+    Perf->DataBuffer[UtShardBase + CFE_ES_PERF_SHARD_SIZE - 1].Data = 0;
+    CFE_ES_PerfLogAdd(0x2, 0);
+    UtAssert_UINT32_EQ(Perf->Shard[UtShard].Head, CFE_ES_PERF_SHARD_SIZE);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[UtShardBase + CFE_ES_PERF_SHARD_SIZE - 1].Data, 0x2);
+    CFE_ES_UpdatePerfLogCounts();
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_ES_PERF_SHARD_SIZE);
+
+    /* Test addition of a new entry to a full shard after the trigger; the
+     * trigger window is counted over the whole log, so a busy task keeps
+     * recording until the log reaches the trigger limit
+     */
+    ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
+    Perf->Shard[UtShard].Head    = CFE_ES_PERF_SHARD_SIZE;
+    Perf->MetaData.TriggerCount  = CFE_ES_PERF_SHARD_SIZE;
+    Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode          = CFE_ES_PERF_TRIGGER_START;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->Shard[UtShard].Head, CFE_ES_PERF_SHARD_SIZE + 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, CFE_ES_PERF_SHARD_SIZE + 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+
+    /* Test addition of a new entry to a closed shard */
+    ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
+    Perf->Shard[UtShard].Head     = 1 | CFE_ES_PERF_SHARD_CLOSED;
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->Shard[UtShard].Head, 1 | CFE_ES_PERF_SHARD_CLOSED);
+    CFE_ES_UpdatePerfLogCounts();
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
      */
@@ -3508,6 +3682,7 @@ void TestPerf(void)
      * trigger mode and the trigger count is less the buffer size
      */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     Perf->MetaData.TriggerCount   = 0;
     Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode           = CFE_ES_PERF_TRIGGER_START;
@@ -3566,6 +3741,7 @@ void TestPerf(void)
     /* Test perf log dump state machine */
     /* Nominal call 1 - should go through up to the DELAY state */
     ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
     CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
@@ -3624,18 +3800,67 @@ void TestPerf(void)
     OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
-    CFE_ES_Global.BackgroundPerfDumpState.DataPos      = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2;
+    CFE_ES_Global.BackgroundPerfDumpState.ShardPos[0]  = CFE_ES_PERF_SHARD_SIZE - 2;
+    CFE_ES_Global.BackgroundPerfDumpState.ShardLeft[0] = 4;
     CFE_ES_Global.BackgroundPerfDumpState.StateCounter = 4;
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
     /* check that the wraparound occurred */
-    UtAssert_True(CFE_ES_Global.BackgroundPerfDumpState.DataPos == 2,
-                  "CFE_ES_RunPerfLogDump - wraparound, DataPos (%u) == 2",
-                  (unsigned int)CFE_ES_Global.BackgroundPerfDumpState.DataPos);
+    UtAssert_True(CFE_ES_Global.BackgroundPerfDumpState.ShardPos[0] == 2,
+                  "CFE_ES_RunPerfLogDump - wraparound, ShardPos[0] (%u) == 2",
+                  (unsigned int)CFE_ES_Global.BackgroundPerfDumpState.ShardPos[0]);
     /* should have written 4 entries to the log */
     UtAssert_True(CFE_ES_Global.BackgroundPerfDumpState.FileSize == sizeof(CFE_ES_PerfDataEntry_t) * 4,
                   "CFE_ES_RunPerfLogDump - wraparound, FileSize (%u) == sizeof(CFE_ES_PerfDataEntry_t) * 4",
                   (unsigned int)CFE_ES_Global.BackgroundPerfDumpState.FileSize);
 
+    /* Test that the file writer merges the shards in time base order */
+    ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
+    memset(DumpEntries, 0, sizeof(DumpEntries));
+    Perf->Shard[0].Head              = 2;
+    Perf->DataBuffer[0].Data         = 1;
+    Perf->DataBuffer[0].TimerUpper32 = 1;
+    Perf->DataBuffer[0].TimerLower32 = 10;
+    Perf->DataBuffer[1].Data         = 3;
+    Perf->DataBuffer[1].TimerUpper32 = 2;
+    Perf->DataBuffer[1].TimerLower32 = 0;
+    Perf->Shard[CFE_PLATFORM_ES_PERF_LOG_SHARDS - 1].Head = 1;
+    Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - CFE_ES_PERF_SHARD_SIZE].Data         = 2;
+    Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - CFE_ES_PERF_SHARD_SIZE].TimerUpper32 = 1;
+    Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - CFE_ES_PERF_SHARD_SIZE].TimerLower32 = 20;
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_METADATA;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    UT_SetDataBuffer(UT_KEY(OS_write), DumpEntries, sizeof(DumpEntries), false);
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    if (CFE_PLATFORM_ES_PERF_LOG_SHARDS > 1)
+    {
+        UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize, sizeof(CFE_ES_PerfDataEntry_t) * 3);
+        UtAssert_UINT32_EQ(DumpEntries[0].Data, 1);
+        UtAssert_UINT32_EQ(DumpEntries[1].Data, 2);
+        UtAssert_UINT32_EQ(DumpEntries[2].Data, 3);
+    }
+
+    /* Test that writing a shard which has wrapped starts at its oldest entry */
+    ES_ResetUnitTest();
+    memset(Perf->Shard, 0, sizeof(Perf->Shard));
+    memset(DumpEntries, 0, sizeof(DumpEntries));
+    Perf->Shard[0].Head      = CFE_ES_PERF_SHARD_SIZE + 1;
+    Perf->DataBuffer[1].Data = 11;
+    Perf->DataBuffer[2].Data = 12;
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_METADATA;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    UT_SetDataBuffer(UT_KEY(OS_write), DumpEntries, sizeof(DumpEntries), false);
+    /* an elapsed time of 1ms gives enough work credit for 2 entries */
+    CFE_ES_RunPerfLogDump(1, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.ShardPos[0], 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.ShardLeft[0], CFE_ES_PERF_SHARD_SIZE - 2);
+    UtAssert_UINT32_EQ(DumpEntries[0].Data, 11);
+    UtAssert_UINT32_EQ(DumpEntries[1].Data, 12);
+
     /* Confirm that the "CFE_ES_GetPerfLogDumpRemaining" function works.
      * This requires that the state is not idle, in order to get nonzero results.
      */
@@ -4073,12 +4298,10 @@ void TestAPI(void)
      * which has no failure path.
      */
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
     ES_ResetUnitTest();
-    UT_Report(__FILE__, __LINE__, CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32) == 0,
-              "CFE_ES_CalculateCRC", "*Not implemented* CRC-32 algorithm");
+    UT_Report(__FILE__, __LINE__, CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32) == 0x4E5B937F,
+              "CFE_ES_CalculateCRC", "CRC-32 algorithm");
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -4194,6 +4417,113 @@ void TestAPI(void)
     UtAssert_INT32_EQ(CFE_ES_GetTaskIDByName(&TaskId, "Nonexistent"), CFE_ES_ERR_NAME_NOT_FOUND);
 }
 
+/*
+ * Reference byte-at-a-time CRC-16/ARC, the algorithm CFE_ES_CalculateCRC used
+ * before the table driven engine, including the int16 result conversion
+ */
+static uint32 ES_UT_ReferenceCrc16(const uint8 *BufPtr, size_t Len, uint32 InputCRC)
+{
+    int16  Crc = (int16)(0xFFFF & InputCRC);
+    uint32 Bit;
+
+    while (Len > 0)
+    {
+        Crc ^= *BufPtr;
+        for (Bit = 0; Bit < 8; ++Bit)
+        {
+            if (Crc & 1)
+            {
+                Crc = ((Crc >> 1) & 0x7FFF) ^ (int16)0xA001;
+            }
+            else
+            {
+                Crc = (Crc >> 1) & 0x7FFF;
+            }
+        }
+        ++BufPtr;
+        --Len;
+    }
+
+    return Crc;
+}
+
+void TestCRC(void)
+{
+    static const char CheckString[] = "123456789";
+    uint8             Buf[1031];
+    size_t            i;
+    size_t            Len;
+    size_t            Split;
+    uint32            Crc;
+    uint32            Mismatches;
+
+    ES_ResetUnitTest();
+
+    /* Standard check values of each algorithm */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckString, 9, 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckString, 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckString, 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
+
+    /* Continuing from a previous result must match a single pass */
+    Crc = CFE_ES_CalculateCRC(CheckString, 4, 0, CFE_MISSION_ES_CRC_32);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CheckString[4], 5, Crc, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+    Crc = CFE_ES_CalculateCRC(CheckString, 7, 0, CFE_MISSION_ES_CRC_32C);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CheckString[7], 2, Crc, CFE_MISSION_ES_CRC_32C), 0xE3069283);
+
+    /* Zero length returns the input unchanged for every algorithm */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CheckString, 0, 0x12345678, CFE_MISSION_ES_CRC_32), 0x12345678);
+
+    for (i = 0; i < sizeof(Buf); ++i)
+    {
+        Buf[i] = (uint8)((i * 167) ^ (i >> 3));
+    }
+
+    /*
+     * CRC-16 must be bit exact with the original byte-at-a-time algorithm for
+     * every length and starting alignment, including sign extension of the result
+     */
+    Mismatches = 0;
+    for (Len = 1; Len < 64; ++Len)
+    {
+        for (i = 0; i < 8; ++i)
+        {
+            if (CFE_ES_CalculateCRC(&Buf[i], Len, 345353, CFE_MISSION_ES_CRC_16) !=
+                ES_UT_ReferenceCrc16(&Buf[i], Len, 345353))
+            {
+                ++Mismatches;
+            }
+        }
+    }
+    UtAssert_UINT32_EQ(Mismatches, 0);
+
+    /* Splitting a larger buffer anywhere gives the same result for all algorithms */
+    Mismatches = 0;
+    for (Split = 0; Split <= sizeof(Buf); Split += 103)
+    {
+        Crc = CFE_ES_CalculateCRC(Buf, Split, 0, CFE_MISSION_ES_CRC_16);
+        Crc = CFE_ES_CalculateCRC(&Buf[Split], sizeof(Buf) - Split, Crc, CFE_MISSION_ES_CRC_16);
+        if (Crc != ES_UT_ReferenceCrc16(Buf, sizeof(Buf), 0))
+        {
+            ++Mismatches;
+        }
+
+        Crc = CFE_ES_CalculateCRC(Buf, Split, 0, CFE_MISSION_ES_CRC_32);
+        Crc = CFE_ES_CalculateCRC(&Buf[Split], sizeof(Buf) - Split, Crc, CFE_MISSION_ES_CRC_32);
+        if (Crc != CFE_ES_CalculateCRC(Buf, sizeof(Buf), 0, CFE_MISSION_ES_CRC_32))
+        {
+            ++Mismatches;
+        }
+
+        Crc = CFE_ES_CalculateCRC(Buf, Split, 0, CFE_MISSION_ES_CRC_32C);
+        Crc = CFE_ES_CalculateCRC(&Buf[Split], sizeof(Buf) - Split, Crc, CFE_MISSION_ES_CRC_32C);
+        if (Crc != CFE_ES_CalculateCRC(Buf, sizeof(Buf), 0, CFE_MISSION_ES_CRC_32C))
+        {
+            ++Mismatches;
+        }
+    }
+    UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
 void TestGenericCounterAPI(void)
 {
     char               CounterName[11];
@@ -249,6 +249,8 @@ void TestSysLog(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
 void TestGenericPool(void);
+void TestGenericPoolLockFree(void);
+void TestCRC(void);
 void TestLibs(void);
 
 #endif /* ES_UT_H */
@@ -107,6 +107,8 @@ int32 CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 Filte
                 AppDataPtr->BinFilters[i].Count   = 0;
             }
 
+            EVS_BuildFilterIndex(AppDataPtr);
+
             EVS_AppDataSetUsed(AppDataPtr, AppID);
         }
     }
@@ -128,6 +130,7 @@ int32 CFE_EVS_Unregister(void)
     Status = EVS_GetCurrentContext(&AppDataPtr, &AppID);
     if (Status == CFE_SUCCESS && EVS_AppDataIsMatch(AppDataPtr, AppID))
     {
+        EVS_FlushDeferredEvents(AppDataPtr);
         EVS_AppDataSetFree(AppDataPtr);
     }
 
@@ -167,7 +170,10 @@ int32 CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
 
             /* Send the event packets */
             va_start(Ptr, Spec);
-            EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            if (EVS_DeferEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr) == false)
+            {
+                EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            }
             va_end(Ptr);
         }
     }
@@ -208,7 +214,10 @@ int32 CFE_EVS_SendEventWithAppID(uint16 EventID, uint16 EventType, CFE_ES_AppId_
 
         /* Send the event packets */
         va_start(Ptr, Spec);
-        EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+        if (EVS_DeferEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr) == false)
+        {
+            EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+        }
         va_end(Ptr);
     }
 
@@ -244,7 +253,10 @@ int32 CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uint16 Eve
         {
             /* Send the event packets */
             va_start(Ptr, Spec);
-            EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            if (EVS_DeferEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr) == false)
+            {
+                EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            }
             va_end(Ptr);
         }
     }
@@ -321,4 +333,36 @@ int32 CFE_EVS_ResetAllFilters(void)
 
 } /* End CFE_EVS_ResetAllFilters */
 
+/*
+** Function: CFE_EVS_SetDeferredFormat - See API and header file for details
+*/
+int32 CFE_EVS_SetDeferredFormat(bool Enable)
+{
+    int32          Status;
+    CFE_ES_AppId_t AppID;
+    EVS_AppData_t *AppDataPtr;
+
+    /* Query and verify the caller's AppID */
+    Status = EVS_GetCurrentContext(&AppDataPtr, &AppID);
+    if (Status == CFE_SUCCESS)
+    {
+        if (!EVS_AppDataIsMatch(AppDataPtr, AppID))
+        {
+            Status = CFE_EVS_APP_NOT_REGISTERED;
+        }
+        else
+        {
+#if defined(__GNUC__)
+            AppDataPtr->DeferredFormat = Enable;
+#else
+            /* The deferred event rings need compiler atomics */
+            Status = CFE_EVS_NOT_IMPLEMENTED;
+#endif
+        }
+    }
+
+    return (Status);
+
+} /* End CFE_EVS_SetDeferredFormat */
+
 /* End CFE_EVS.C */
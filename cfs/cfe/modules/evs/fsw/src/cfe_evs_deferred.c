@@ -0,0 +1,643 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File: cfe_evs_deferred.c
+**
+**  Title: Event Services API - Deferred Event Formatting
+**
+**  Purpose: Apps that enable deferred formatting do not format their events
+**           in their own context.  The event ID, type, time stamp, format
+**           pointer and raw arguments are captured into a per-app ring and
+**           the EVS task formats, logs and sends the event later.
+**
+**           Each ring slot carries a sequence word: a slot at lap L of the
+**           ring is free when the word is 2L and holds an event when it is
+**           2L + 1.  Producers claim a position with a compare-and-swap on the
+**           ring head and publish by storing the sequence word last, so any
+**           number of tasks of the same app can queue events without a lock.
+**           The EVS task is the normal consumer; other consumers (cleanup of
+**           a deleted app) are serialized with it by EVS_DeferredMutexID.
+**
+*/
+
+/* Include Files */
+#include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+
+#include <stdio.h>
+#include <string.h>
+
+/* Sequence word of a free slot at the lap containing ring position Pos */
+#define EVS_DEFERRED_FREE_SEQ(Pos) (2 * ((uint32)(Pos) / CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH))
+
+/* Type of argument consumed by one conversion specification */
+typedef enum
+{
+    EVS_DEFARG_NONE, /* "%%" consumes no argument */
+    EVS_DEFARG_INT,
+    EVS_DEFARG_UINT,
+    EVS_DEFARG_LONG,
+    EVS_DEFARG_ULONG,
+    EVS_DEFARG_LLONG,
+    EVS_DEFARG_ULLONG,
+    EVS_DEFARG_SIZE,
+    EVS_DEFARG_INTMAX,
+    EVS_DEFARG_PTRDIFF,
+    EVS_DEFARG_DOUBLE,
+    EVS_DEFARG_PTR,
+    EVS_DEFARG_STRING
+} EVS_DeferredArgType_t;
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_ParseConversion
+**
+** Purpose:  This routine parses the conversion specification starting at the '%'
+**           pointed to by Spec, returning its length and the type of argument it
+**           consumes.
+**
+** Assumptions and Notes:  Returns 0 for conversions that cannot be deferred: a '*'
+**           width or precision, %n, wide characters, long double, or a
+**           specification longer than CFE_EVS_DEFERRED_MAX_SPEC_LEN - 1.
+**
+*/
+static size_t EVS_ParseConversion(const char *Spec, EVS_DeferredArgType_t *ArgType)
+{
+    size_t Len       = 1;
+    char   LengthMod = 0; /* 'q' stands for "ll" */
+    bool   IsSigned  = false;
+
+    /* Flags, field width and precision */
+    while (Spec[Len] != '\0' && strchr("-+ #0123456789.", Spec[Len]) != NULL)
+    {
+        Len++;
+    }
+
+    /* Length modifier; "hh" and "h" arguments are promoted to int */
+    switch (Spec[Len])
+    {
+        case 'h':
+            LengthMod = 'h';
+            Len++;
+            if (Spec[Len] == 'h')
+            {
+                Len++;
+            }
+            break;
+
+        case 'l':
+            LengthMod = 'l';
+            Len++;
+            if (Spec[Len] == 'l')
+            {
+                LengthMod = 'q';
+                Len++;
+            }
+            break;
+
+        case 'z':
+        case 'j':
+        case 't':
+            LengthMod = Spec[Len];
+            Len++;
+            break;
+
+        default:
+            break;
+    }
+
+    switch (Spec[Len])
+    {
+        case '%':
+            *ArgType = EVS_DEFARG_NONE;
+            break;
+
+        case 'd':
+        case 'i':
+            IsSigned = true;
+            /* fall through */
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            switch (LengthMod)
+            {
+                case 'l':
+                    *ArgType = IsSigned ? EVS_DEFARG_LONG : EVS_DEFARG_ULONG;
+                    break;
+                case 'q':
+                    *ArgType = IsSigned ? EVS_DEFARG_LLONG : EVS_DEFARG_ULLONG;
+                    break;
+                case 'z':
+                    *ArgType = EVS_DEFARG_SIZE;
+                    break;
+                case 'j':
+                    *ArgType = EVS_DEFARG_INTMAX;
+                    break;
+                case 't':
+                    *ArgType = EVS_DEFARG_PTRDIFF;
+                    break;
+                default:
+                    *ArgType = IsSigned ? EVS_DEFARG_INT : EVS_DEFARG_UINT;
+                    break;
+            }
+            break;
+
+        case 'c':
+            if (LengthMod != 0)
+            {
+                return 0;
+            }
+            *ArgType = EVS_DEFARG_INT;
+            break;
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (LengthMod != 0 && LengthMod != 'l')
+            {
+                return 0;
+            }
+            *ArgType = EVS_DEFARG_DOUBLE;
+            break;
+
+        case 's':
+        case 'p':
+            if (LengthMod != 0)
+            {
+                return 0;
+            }
+            *ArgType = (Spec[Len] == 's') ? EVS_DEFARG_STRING : EVS_DEFARG_PTR;
+            break;
+
+        default:
+            return 0;
+    }
+
+    Len++;
+
+    if (Len >= CFE_EVS_DEFERRED_MAX_SPEC_LEN)
+    {
+        return 0;
+    }
+
+    return Len;
+
+} /* End EVS_ParseConversion */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_CaptureDeferredArgs
+**
+** Purpose:  This routine walks the format string and copies each argument into
+**           the deferred event.  Strings are copied, since the caller's buffer
+**           may not outlive the call.
+**
+** Assumptions and Notes:  Returns false if the format cannot be deferred, in which
+**           case the caller formats the event immediately.  String arguments that
+**           do not fit in CFE_EVS_DEFERRED_STRING_SPACE are truncated.
+**
+*/
+static bool EVS_CaptureDeferredArgs(EVS_DeferredEvent_t *Event, const char *MsgSpec, va_list ArgPtr)
+{
+    const char *          Ptr;
+    const char *          Str;
+    EVS_DeferredArg_t *   Arg;
+    EVS_DeferredArgType_t ArgType;
+    size_t                ConvLen;
+    uint32                ArgCount   = 0;
+    size_t                StringUsed = 0;
+
+    for (Ptr = MsgSpec; *Ptr != '\0'; ++Ptr)
+    {
+        if (*Ptr != '%')
+        {
+            continue;
+        }
+
+        ConvLen = EVS_ParseConversion(Ptr, &ArgType);
+        if (ConvLen == 0)
+        {
+            return false;
+        }
+
+        Ptr += ConvLen - 1;
+
+        if (ArgType == EVS_DEFARG_NONE)
+        {
+            continue;
+        }
+
+        if (ArgCount >= CFE_EVS_DEFERRED_MAX_ARGS)
+        {
+            return false;
+        }
+
+        Arg = &Event->Args[ArgCount];
+        ++ArgCount;
+
+        switch (ArgType)
+        {
+            case EVS_DEFARG_INT:
+                Arg->IntVal = va_arg(ArgPtr, int);
+                break;
+            case EVS_DEFARG_UINT:
+                Arg->UIntVal = va_arg(ArgPtr, unsigned int);
+                break;
+            case EVS_DEFARG_LONG:
+                Arg->LongVal = va_arg(ArgPtr, long);
+                break;
+            case EVS_DEFARG_ULONG:
+                Arg->ULongVal = va_arg(ArgPtr, unsigned long);
+                break;
+            case EVS_DEFARG_LLONG:
+                Arg->LLongVal = va_arg(ArgPtr, long long);
+                break;
+            case EVS_DEFARG_ULLONG:
+                Arg->ULLongVal = va_arg(ArgPtr, unsigned long long);
+                break;
+            case EVS_DEFARG_SIZE:
+                Arg->SizeVal = va_arg(ArgPtr, size_t);
+                break;
+            case EVS_DEFARG_INTMAX:
+                Arg->IntMaxVal = va_arg(ArgPtr, intmax_t);
+                break;
+            case EVS_DEFARG_PTRDIFF:
+                Arg->PtrDiffVal = va_arg(ArgPtr, ptrdiff_t);
+                break;
+            case EVS_DEFARG_DOUBLE:
+                Arg->DoubleVal = va_arg(ArgPtr, double);
+                break;
+            case EVS_DEFARG_PTR:
+                Arg->PtrVal = va_arg(ArgPtr, void *);
+                break;
+            default: /* EVS_DEFARG_STRING */
+                Str = va_arg(ArgPtr, const char *);
+                if (Str == NULL)
+                {
+                    Str = "(null)";
+                }
+
+                /* Once the space is used up, further strings share the final terminator */
+                if (StringUsed >= sizeof(Event->StringData))
+                {
+                    StringUsed = sizeof(Event->StringData) - 1;
+                }
+
+                Arg->StringOffset = (uint16)StringUsed;
+                while (StringUsed < (sizeof(Event->StringData) - 1) && *Str != '\0')
+                {
+                    Event->StringData[StringUsed] = *Str;
+                    ++StringUsed;
+                    ++Str;
+                }
+                Event->StringData[StringUsed] = '\0';
+                ++StringUsed;
+                break;
+        }
+    }
+
+    return true;
+
+} /* End EVS_CaptureDeferredArgs */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_FormatDeferredEvent
+**
+** Purpose:  This routine expands a deferred event's format string and captured
+**           arguments into the given buffer.
+**
+** Assumptions and Notes:  Behaves like vsnprintf(): the output is always terminated
+**           and the return value is the full expanded length.  The format string
+**           was already validated when the arguments were captured.
+**
+*/
+static int EVS_FormatDeferredEvent(const EVS_DeferredEvent_t *Event, char *Buffer, size_t BufSize)
+{
+    const char *             Ptr;
+    const EVS_DeferredArg_t *Arg = Event->Args;
+    EVS_DeferredArgType_t    ArgType;
+    size_t                   ConvLen;
+    size_t                   Total = 0;
+    size_t                   Room;
+    char *                   Out;
+    int                      Len;
+    char                     ConvSpec[CFE_EVS_DEFERRED_MAX_SPEC_LEN];
+
+    Ptr = Event->Spec;
+    while (*Ptr != '\0')
+    {
+        ConvLen = 0;
+        ArgType = EVS_DEFARG_NONE;
+        if (*Ptr == '%')
+        {
+            ConvLen = EVS_ParseConversion(Ptr, &ArgType);
+        }
+
+        if (ConvLen == 0 || ArgType == EVS_DEFARG_NONE)
+        {
+            /* Literal character, or the '%' of "%%" */
+            if (Total < BufSize - 1)
+            {
+                Buffer[Total] = *Ptr;
+            }
+            ++Total;
+            Ptr += (ConvLen == 0) ? 1 : ConvLen;
+            continue;
+        }
+
+        memcpy(ConvSpec, Ptr, ConvLen);
+        ConvSpec[ConvLen] = '\0';
+        Ptr += ConvLen;
+
+        if (Total < BufSize)
+        {
+            Out  = &Buffer[Total];
+            Room = BufSize - Total;
+        }
+        else
+        {
+            Out  = NULL;
+            Room = 0;
+        }
+
+        switch (ArgType)
+        {
+            case EVS_DEFARG_INT:
+                Len = snprintf(Out, Room, ConvSpec, Arg->IntVal);
+                break;
+            case EVS_DEFARG_UINT:
+                Len = snprintf(Out, Room, ConvSpec, Arg->UIntVal);
+                break;
+            case EVS_DEFARG_LONG:
+                Len = snprintf(Out, Room, ConvSpec, Arg->LongVal);
+                break;
+            case EVS_DEFARG_ULONG:
+                Len = snprintf(Out, Room, ConvSpec, Arg->ULongVal);
+                break;
+            case EVS_DEFARG_LLONG:
+                Len = snprintf(Out, Room, ConvSpec, Arg->LLongVal);
+                break;
+            case EVS_DEFARG_ULLONG:
+                Len = snprintf(Out, Room, ConvSpec, Arg->ULLongVal);
+                break;
+            case EVS_DEFARG_SIZE:
+                Len = snprintf(Out, Room, ConvSpec, Arg->SizeVal);
+                break;
+            case EVS_DEFARG_INTMAX:
+                Len = snprintf(Out, Room, ConvSpec, Arg->IntMaxVal);
+                break;
+            case EVS_DEFARG_PTRDIFF:
+                Len = snprintf(Out, Room, ConvSpec, Arg->PtrDiffVal);
+                break;
+            case EVS_DEFARG_DOUBLE:
+                Len = snprintf(Out, Room, ConvSpec, Arg->DoubleVal);
+                break;
+            case EVS_DEFARG_PTR:
+                Len = snprintf(Out, Room, ConvSpec, Arg->PtrVal);
+                break;
+            default: /* EVS_DEFARG_STRING */
+                Len = snprintf(Out, Room, ConvSpec, &Event->StringData[Arg->StringOffset]);
+                break;
+        }
+
+        if (Len > 0)
+        {
+            Total += Len;
+        }
+        ++Arg;
+    }
+
+    Buffer[(Total < BufSize) ? Total : (BufSize - 1)] = '\0';
+
+    return (int)Total;
+
+} /* End EVS_FormatDeferredEvent */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_PublishDeferredEvent
+**
+** Purpose:  This routine formats a deferred event and sends it out the software
+**           bus, the event log and all enabled output ports.
+**
+** Assumptions and Notes:
+**
+*/
+static void EVS_PublishDeferredEvent(EVS_AppData_t *AppDataPtr, const EVS_DeferredEvent_t *Event)
+{
+    CFE_EVS_LongEventTlm_t LongEventTlm;
+    int                    ExpandedLength;
+
+    /* Initialize EVS event packet */
+    CFE_MSG_Init(&LongEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), sizeof(LongEventTlm));
+    LongEventTlm.Payload.PacketID.EventID   = Event->EventID;
+    LongEventTlm.Payload.PacketID.EventType = Event->EventType;
+
+    ExpandedLength =
+        EVS_FormatDeferredEvent(Event, (char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message));
+
+    EVS_PublishEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, &Event->Time);
+
+} /* End EVS_PublishDeferredEvent */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_DrainDeferredRing
+**
+** Purpose:  This routine formats and sends every event queued in the deferred
+**           ring of the given application.
+**
+** Assumptions and Notes:  The caller must hold EVS_DeferredMutexID.  Events queued
+**           under an app record that has since been freed or reused are dropped,
+**           as their format strings may no longer be valid.
+**
+*/
+static void EVS_DrainDeferredRing(EVS_AppData_t *AppDataPtr, EVS_DeferredRing_t *Ring)
+{
+#if defined(__GNUC__)
+    EVS_DeferredEvent_t *Slot;
+    uint32               Pos;
+
+    for (Pos = Ring->Tail;; ++Pos)
+    {
+        Slot = &Ring->Slots[Pos & (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH - 1)];
+        if (__atomic_load_n(&Slot->Seq, __ATOMIC_ACQUIRE) != EVS_DEFERRED_FREE_SEQ(Pos) + 1)
+        {
+            break;
+        }
+
+        if (Slot->Spec != NULL && EVS_AppDataIsMatch(AppDataPtr, Slot->AppID))
+        {
+            EVS_PublishDeferredEvent(AppDataPtr, Slot);
+        }
+
+        __atomic_store_n(&Slot->Seq, EVS_DEFERRED_FREE_SEQ(Pos + CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH),
+                         __ATOMIC_RELEASE);
+    }
+
+    Ring->Tail = Pos;
+#endif
+
+} /* End EVS_DrainDeferredRing */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_DeferEventTelemetry
+**
+** Purpose:  This routine queues an event for formatting by the EVS task if the
+**           application has enabled deferred formatting.
+**
+** Assumptions and Notes:  Returns false if the event was not queued (deferral not
+**           enabled, ring full, or a format the capture does not support); the
+**           caller must then format the event itself.  In the latter two cases the
+**           ring is flushed first, so that the event is not sent ahead of those
+**           the app already queued.  ArgPtr is left unconsumed.
+**           The format string must remain valid until the app is deleted, which
+**           holds for the string literals events normally use.
+**
+*/
+bool EVS_DeferEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                             const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+#if defined(__GNUC__)
+    EVS_DeferredRing_t * Ring;
+    EVS_DeferredEvent_t *Slot;
+    uint32               Pos;
+    uint32               Seq;
+    va_list              ArgCopy;
+    bool                 Captured;
+
+    if (!AppDataPtr->DeferredFormat)
+    {
+        return false;
+    }
+
+    Ring = &CFE_EVS_Global.DeferredRings[AppDataPtr - CFE_EVS_Global.AppData];
+
+    /* Claim the next position; a slot still holding last lap's event means the ring is full */
+    Pos = __atomic_load_n(&Ring->Head, __ATOMIC_RELAXED);
+    for (;;)
+    {
+        Slot = &Ring->Slots[Pos & (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH - 1)];
+        Seq  = __atomic_load_n(&Slot->Seq, __ATOMIC_ACQUIRE);
+
+        if (Seq == EVS_DEFERRED_FREE_SEQ(Pos))
+        {
+            if (__atomic_compare_exchange_n(&Ring->Head, &Pos, Pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if ((int32)(Seq - EVS_DEFERRED_FREE_SEQ(Pos)) < 0)
+        {
+            EVS_FlushDeferredEvents(AppDataPtr);
+            return false;
+        }
+        else
+        {
+            Pos = __atomic_load_n(&Ring->Head, __ATOMIC_RELAXED);
+        }
+    }
+
+    Slot->AppID     = EVS_AppDataGetID(AppDataPtr);
+    Slot->EventID   = EventID;
+    Slot->EventType = EventType;
+    Slot->Time      = *TimeStamp;
+
+    va_copy(ArgCopy, ArgPtr);
+    Captured = EVS_CaptureDeferredArgs(Slot, MsgSpec, ArgCopy);
+    va_end(ArgCopy);
+
+    /* The position is already claimed, so an uncapturable event still publishes an empty slot */
+    Slot->Spec = Captured ? MsgSpec : NULL;
+
+    __atomic_store_n(&Slot->Seq, EVS_DEFERRED_FREE_SEQ(Pos) + 1, __ATOMIC_RELEASE);
+
+    if (!Captured)
+    {
+        EVS_FlushDeferredEvents(AppDataPtr);
+    }
+
+    return Captured;
+#else
+    return false;
+#endif
+
+} /* End EVS_DeferEventTelemetry */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_ProcessDeferredEvents
+**
+** Purpose:  This routine formats and sends the queued events of all applications.
+**
+** Assumptions and Notes:  Called by the EVS task after each command and whenever
+**           its command pipe receive times out.
+**
+*/
+void EVS_ProcessDeferredEvents(void)
+{
+    uint32 i;
+
+    OS_MutSemTake(CFE_EVS_Global.EVS_DeferredMutexID);
+
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++)
+    {
+        EVS_DrainDeferredRing(&CFE_EVS_Global.AppData[i], &CFE_EVS_Global.DeferredRings[i]);
+    }
+
+    OS_MutSemGive(CFE_EVS_Global.EVS_DeferredMutexID);
+
+} /* End EVS_ProcessDeferredEvents */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_FlushDeferredEvents
+**
+** Purpose:  This routine formats and sends the queued events of one application.
+**
+** Assumptions and Notes:  Called before an app record is freed, so that events the
+**           app queued are sent while their format strings are still valid.
+**
+*/
+void EVS_FlushDeferredEvents(EVS_AppData_t *AppDataPtr)
+{
+    OS_MutSemTake(CFE_EVS_Global.EVS_DeferredMutexID);
+
+    EVS_DrainDeferredRing(AppDataPtr, &CFE_EVS_Global.DeferredRings[AppDataPtr - CFE_EVS_Global.AppData]);
+
+    OS_MutSemGive(CFE_EVS_Global.EVS_DeferredMutexID);
+
+} /* End EVS_FlushDeferredEvents */
@@ -0,0 +1,63 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ *  Title:    Event Services Deferred Event Formatting.
+ *
+ *  Purpose:
+ *            Unit specification for capturing events in the sending app's context
+ *            and formatting them later in the EVS task.
+ *
+ *  Contents:
+ *       I.  macro and constant type definitions
+ *      II.  EVS deferred internal structures
+ *     III.  function prototypes
+ *
+ *  Design Notes:
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *
+ *  Notes:
+ */
+
+#ifndef CFE_EVS_DEFERRED_H
+#define CFE_EVS_DEFERRED_H
+
+/********************* Include Files  ************************/
+
+#include <stdarg.h>
+
+#include "cfe_evs_task.h" /* EVS internal definitions */
+
+/* ==============   Section I: Macro and Constant Type Definitions   =========== */
+
+/* ==============   Section II: Internal Structures ============ */
+
+/* ==============   Section III: Function Prototypes =========== */
+
+bool EVS_DeferEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                             const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr);
+void EVS_ProcessDeferredEvents(void);
+void EVS_FlushDeferredEvents(EVS_AppData_t *AppDataPtr);
+
+#endif /* CFE_EVS_DEFERRED_H */
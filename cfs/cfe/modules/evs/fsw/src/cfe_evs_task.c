@@ -117,6 +117,12 @@ int32 CFE_EVS_EarlyInit(void)
         /* Create semaphore to serialize access to event log */
         Status = OS_MutSemCreate(&CFE_EVS_Global.EVS_SharedDataMutexID, "CFE_EVS_DataMutex", 0);
 
+        if (Status == OS_SUCCESS)
+        {
+            /* Create semaphore to serialize consumers of the deferred event rings */
+            Status = OS_MutSemCreate(&CFE_EVS_Global.EVS_DeferredMutexID, "CFE_EVS_DeferMutex", 0);
+        }
+
         if (Status != OS_SUCCESS)
         {
             CFE_ES_WriteToSysLog("EVS call to OS_MutSemCreate failed, RC=0x%08x\n", (unsigned int)Status);
@@ -191,6 +197,7 @@ int32 CFE_EVS_CleanUpApp(CFE_ES_AppId_t AppID)
     else if (EVS_AppDataIsMatch(AppDataPtr, AppID))
     {
         /* Same cleanup as CFE_EVS_Unregister() */
+        EVS_FlushDeferredEvents(AppDataPtr);
         EVS_AppDataSetFree(AppDataPtr);
     }
 
@@ -240,8 +247,8 @@ void CFE_EVS_TaskMain(void)
 
         CFE_ES_PerfLogExit(CFE_MISSION_EVS_MAIN_PERF_ID);
 
-        /* Pend on receipt of packet */
-        Status = CFE_SB_ReceiveBuffer(&SBBufPtr, CFE_EVS_Global.EVS_CommandPipe, CFE_SB_PEND_FOREVER);
+        /* Pend on receipt of packet, waking periodically to send deferred events */
+        Status = CFE_SB_ReceiveBuffer(&SBBufPtr, CFE_EVS_Global.EVS_CommandPipe, CFE_PLATFORM_EVS_DEFERRED_DRAIN_MSEC);
 
         CFE_ES_PerfLogEntry(CFE_MISSION_EVS_MAIN_PERF_ID);
 
@@ -250,11 +257,18 @@ void CFE_EVS_TaskMain(void)
             /* Process cmd pipe msg */
             CFE_EVS_ProcessCommandPacket(SBBufPtr);
         }
+        else if (Status == CFE_SB_TIME_OUT)
+        {
+            Status = CFE_SUCCESS;
+        }
         else
         {
             CFE_ES_WriteToSysLog("EVS:Error reading cmd pipe,RC=0x%08X\n", (unsigned int)Status);
         } /* end if */
 
+        /* Format and send events queued by apps using deferred formatting */
+        EVS_ProcessDeferredEvents();
+
     } /* end while */
 
     /* while loop exits only if CFE_SB_ReceiveBuffer returns error */
@@ -1541,6 +1555,8 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
                 FilterPtr->Mask    = CmdPtr->Mask;
                 FilterPtr->Count   = 0;
 
+                EVS_BuildFilterIndex(AppDataPtr);
+
                 EVS_SendEvent(CFE_EVS_ADDFILTER_EID, CFE_EVS_EventType_DEBUG,
                               "Add Filter Command Received with AppName = %s, EventID = 0x%08x, Mask = 0x%04x",
                               LocalName, (unsigned int)CmdPtr->EventID, (unsigned int)CmdPtr->Mask);
@@ -1617,6 +1633,8 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
             FilterPtr->Mask    = CFE_EVS_NO_MASK;
             FilterPtr->Count   = 0;
 
+            EVS_BuildFilterIndex(AppDataPtr);
+
             EVS_SendEvent(CFE_EVS_DELFILTER_EID, CFE_EVS_EventType_DEBUG,
                           "Delete Filter Command Received with AppName = %s, EventID = 0x%08x", LocalName,
                           (unsigned int)CmdPtr->EventID);
@@ -49,6 +49,7 @@
 #include "cfe_evs_api_typedefs.h"
 #include "cfe_evs_log_typedef.h"
 #include "cfe_sb_api_typedefs.h"
+#include "cfe_time_api_typedefs.h"
 #include "cfe_evs_events.h"
 
 /*********************  Macro and Constant Type Definitions   ***************************/
@@ -70,6 +71,24 @@
 #error CFE_EVS_MAX_PORT_MSG_LENGTH cannot be greater than OS_BUFFER_SIZE!
 #endif
 
+/* Each application keeps an open-addressed hash index of its binary filters keyed
+ * by event ID, so that the filter check on the send path does not have to scan
+ * every filter slot.  The index is the smallest power of two that is at least twice
+ * CFE_PLATFORM_EVS_MAX_EVENT_FILTERS, keeping it at most half full.  Entries hold
+ * the filter slot number plus one, so a zeroed index means "no filters".
+ */
+#define CFE_EVS_FILTER_INDEX_SMEAR0 (2 * CFE_PLATFORM_EVS_MAX_EVENT_FILTERS - 1)
+#define CFE_EVS_FILTER_INDEX_SMEAR1 (CFE_EVS_FILTER_INDEX_SMEAR0 | (CFE_EVS_FILTER_INDEX_SMEAR0 >> 1))
+#define CFE_EVS_FILTER_INDEX_SMEAR2 (CFE_EVS_FILTER_INDEX_SMEAR1 | (CFE_EVS_FILTER_INDEX_SMEAR1 >> 2))
+#define CFE_EVS_FILTER_INDEX_SMEAR3 (CFE_EVS_FILTER_INDEX_SMEAR2 | (CFE_EVS_FILTER_INDEX_SMEAR2 >> 4))
+#define CFE_EVS_FILTER_INDEX_MASK   (CFE_EVS_FILTER_INDEX_SMEAR3 | (CFE_EVS_FILTER_INDEX_SMEAR3 >> 8))
+#define CFE_EVS_FILTER_INDEX_SIZE   (CFE_EVS_FILTER_INDEX_MASK + 1)
+
+/* Limits on what a deferred event may capture; events needing more are formatted immediately */
+#define CFE_EVS_DEFERRED_MAX_ARGS      8  /* Conversions per event message */
+#define CFE_EVS_DEFERRED_MAX_SPEC_LEN  16 /* Characters in one conversion specification */
+#define CFE_EVS_DEFERRED_STRING_SPACE  CFE_MISSION_EVS_MAX_MESSAGE_LENGTH /* Bytes for copied %s arguments */
+
 /************************  Internal Structure Definitions  *****************************/
 
 typedef struct
@@ -87,13 +106,56 @@ typedef struct
     CFE_ES_AppId_t UnregAppID;
 
     EVS_BinFilter_t BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Array of binary filters */
+    uint8           FilterIndex[CFE_EVS_FILTER_INDEX_SIZE];         /* Event ID hash index into BinFilters */
 
     uint8  ActiveFlag;           /* Application event service active flag */
     uint8  EventTypesActiveFlag; /* Application event types active flag */
     uint16 EventCount;           /* Application event counter */
+    bool   DeferredFormat;       /* Queue events for formatting by the EVS task */
 
 } EVS_AppData_t;
 
+/* Captured value of one deferred event argument, see EVS_DeferredArgType_t */
+typedef union
+{
+    int                IntVal;
+    unsigned int       UIntVal;
+    long               LongVal;
+    unsigned long      ULongVal;
+    long long          LLongVal;
+    unsigned long long ULLongVal;
+    size_t             SizeVal;
+    intmax_t           IntMaxVal;
+    ptrdiff_t          PtrDiffVal;
+    double             DoubleVal;
+    const void *       PtrVal;
+    uint16             StringOffset; /* Offset of the copied string in StringData */
+
+} EVS_DeferredArg_t;
+
+/* An event captured by the sending app and formatted later by the EVS task */
+typedef struct
+{
+    uint32             Seq; /* Ring slot state, written last by the producer and consumer */
+    CFE_ES_AppId_t     AppID;
+    uint16             EventID;
+    uint16             EventType;
+    CFE_TIME_SysTime_t Time;
+    const char *       Spec; /* Caller's format string, NULL if the slot was abandoned */
+    EVS_DeferredArg_t  Args[CFE_EVS_DEFERRED_MAX_ARGS];
+    char               StringData[CFE_EVS_DEFERRED_STRING_SPACE];
+
+} EVS_DeferredEvent_t;
+
+/* Per-app ring of deferred events: many producing tasks, the EVS task consuming */
+typedef struct
+{
+    uint32              Head; /* Next position to reserve */
+    uint32              Tail; /* Next position to format */
+    EVS_DeferredEvent_t Slots[CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH];
+
+} EVS_DeferredRing_t;
+
 typedef struct
 {
     char            AppName[OS_MAX_API_NAME];                    /* Application name */
@@ -109,6 +171,10 @@ typedef struct
 {
     EVS_AppData_t AppData[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /* Application state data and event filters */
 
+    /* Deferred event rings, indexed like AppData but kept apart so re-registering never
+     * clears a ring the EVS task may be draining */
+    EVS_DeferredRing_t DeferredRings[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+
     CFE_EVS_Log_t *EVS_LogPtr; /* Pointer to the EVS log in the ES Reset area*/
                                /* see cfe_es_global.h */
 
@@ -118,6 +184,7 @@ typedef struct
     CFE_EVS_HousekeepingTlm_t EVS_TlmPkt;
     CFE_SB_PipeId_t           EVS_CommandPipe;
     osal_id_t                 EVS_SharedDataMutexID;
+    osal_id_t                 EVS_DeferredMutexID; /* Serializes consumers of the deferred rings */
     CFE_ES_AppId_t            EVS_AppID;
 
 } CFE_EVS_Global_t;
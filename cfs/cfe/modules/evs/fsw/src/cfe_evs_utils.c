@@ -208,63 +208,34 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 {
     EVS_BinFilter_t *FilterPtr;
     bool             Filtered = false;
+    uint16           TypeBit;
     char             AppName[OS_MAX_API_NAME];
 
+    /* Map the event type onto its bit in EventTypesActiveFlag; invalid types map to no bit */
+    if (EventType >= CFE_EVS_EventType_DEBUG && EventType <= CFE_EVS_EventType_CRITICAL)
+    {
+        TypeBit = CFE_EVS_DEBUG_BIT << (EventType - CFE_EVS_EventType_DEBUG);
+    }
+    else
+    {
+        TypeBit = 0;
+    }
+
     if (AppDataPtr->ActiveFlag == false)
     {
         /* All events are disabled for this application */
         Filtered = true;
     }
-    else
-        switch (EventType)
-        {
-            case CFE_EVS_EventType_DEBUG:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_DEBUG_BIT) == 0)
-                {
-                    /* Debug events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            case CFE_EVS_EventType_INFORMATION:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_INFORMATION_BIT) == 0)
-                {
-                    /* Informational events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            case CFE_EVS_EventType_ERROR:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_ERROR_BIT) == 0)
-                {
-                    /* Error events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            case CFE_EVS_EventType_CRITICAL:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_CRITICAL_BIT) == 0)
-                {
-                    /* Critical events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            default:
-
-                /* Invalid Event Type */
-                Filtered = true;
-                break;
-        }
+    else if ((AppDataPtr->EventTypesActiveFlag & TypeBit) == 0)
+    {
+        /* This event type is disabled for this application, or is invalid */
+        Filtered = true;
+    }
 
     /* Is this type of event enabled for this application? */
     if (Filtered == false)
     {
-        FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_LookupFilter(AppDataPtr, (int16)EventID);
 
         /* Does this event ID have an event filter table entry? */
         if (FilterPtr != NULL)
@@ -324,6 +295,85 @@ EVS_BinFilter_t *EVS_FindEventID(int16 EventID, EVS_BinFilter_t *FilterArray)
 
 } /* End EVS_FindEventID */
 
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_BuildFilterIndex
+**
+** Purpose:  This routine rebuilds the event ID hash index of the given application
+**           from its binary filter array.
+**
+** Assumptions and Notes:  Must be called whenever a filter slot's event ID changes
+**           (register, add, delete).  Changing only a mask or count does not
+**           require a rebuild.  If an event ID appears more than once the lowest
+**           slot is found first, matching EVS_FindEventID.
+**
+*/
+void EVS_BuildFilterIndex(EVS_AppData_t *AppDataPtr)
+{
+    uint32 i;
+    uint32 Pos;
+
+    memset(AppDataPtr->FilterIndex, 0, sizeof(AppDataPtr->FilterIndex));
+
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        if (AppDataPtr->BinFilters[i].EventID != CFE_EVS_FREE_SLOT)
+        {
+            /* The index is at most half full, so a free entry is always found */
+            Pos = (uint16)AppDataPtr->BinFilters[i].EventID & CFE_EVS_FILTER_INDEX_MASK;
+            while (AppDataPtr->FilterIndex[Pos] != 0)
+            {
+                Pos = (Pos + 1) & CFE_EVS_FILTER_INDEX_MASK;
+            }
+
+            AppDataPtr->FilterIndex[Pos] = i + 1;
+        }
+    }
+
+} /* End EVS_BuildFilterIndex */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_LookupFilter
+**
+** Purpose:  This routine returns the binary filter registered for the given event ID
+**           by the given application, or NULL if there is none.
+**
+** Assumptions and Notes:  Uses the index built by EVS_BuildFilterIndex.  Every hit
+**           is confirmed against the filter slot itself, so a stale index can only
+**           cause a miss, never a wrong match.
+**
+*/
+EVS_BinFilter_t *EVS_LookupFilter(EVS_AppData_t *AppDataPtr, int16 EventID)
+{
+    uint32 Pos;
+    uint32 Probes;
+    uint8  Slot;
+
+    Pos = (uint16)EventID & CFE_EVS_FILTER_INDEX_MASK;
+
+    for (Probes = 0; Probes < CFE_EVS_FILTER_INDEX_SIZE; Probes++)
+    {
+        Slot = AppDataPtr->FilterIndex[Pos];
+        if (Slot == 0 || Slot > CFE_PLATFORM_EVS_MAX_EVENT_FILTERS)
+        {
+            break;
+        }
+
+        if (AppDataPtr->BinFilters[Slot - 1].EventID == EventID)
+        {
+            return (&AppDataPtr->BinFilters[Slot - 1]);
+        }
+
+        Pos = (Pos + 1) & CFE_EVS_FILTER_INDEX_MASK;
+    }
+
+    return ((EVS_BinFilter_t *)NULL);
+
+} /* End EVS_LookupFilter */
+
 /*
 **             Function Prologue
 **
@@ -379,9 +429,8 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask)
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
 {
-    CFE_EVS_LongEventTlm_t  LongEventTlm;  /* The "long" flavor is always generated, as this is what is logged */
-    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
-    int                     ExpandedLength;
+    CFE_EVS_LongEventTlm_t LongEventTlm; /* The "long" flavor is always generated, as this is what is logged */
+    int                    ExpandedLength;
 
     /* Initialize EVS event packets */
     CFE_MSG_Init(&LongEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), sizeof(LongEventTlm));
@@ -393,36 +442,58 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
     ExpandedLength =
         vsnprintf((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec, ArgPtr);
 
+    EVS_PublishEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, TimeStamp);
+
+} /* End EVS_GenerateEventTelemetry */
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_PublishEventTelemetry
+**
+** Purpose:  This routine completes an event message whose text has been expanded
+**           and sends it out the software bus, the event log and all enabled
+**           output ports
+**
+** Assumptions and Notes:
+**           The long message must already be initialized with its event ID, type and
+**           text.  ExpandedLength is the full length of the text before truncation.
+*/
+void EVS_PublishEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlmPtr,
+                               int ExpandedLength, const CFE_TIME_SysTime_t *TimeStamp)
+{
+    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
+
     /*
      * If vsnprintf is bigger than message size, mark with truncation character
      * Note negative returns (error from vsnprintf) will just leave the message as-is
      */
-    if (ExpandedLength >= (int)sizeof(LongEventTlm.Payload.Message))
+    if (ExpandedLength >= (int)sizeof(LongEventTlmPtr->Payload.Message))
     {
         /* Mark character before zero terminator to indicate truncation */
-        LongEventTlm.Payload.Message[sizeof(LongEventTlm.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
+        LongEventTlmPtr->Payload.Message[sizeof(LongEventTlmPtr->Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter++;
     }
 
     /* Obtain task and system information */
-    CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
-                      sizeof(LongEventTlm.Payload.PacketID.AppName));
-    LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
-    LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
+    CFE_ES_GetAppName((char *)LongEventTlmPtr->Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
+                      sizeof(LongEventTlmPtr->Payload.PacketID.AppName));
+    LongEventTlmPtr->Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
+    LongEventTlmPtr->Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
 
     /* Set the packet timestamp */
-    CFE_MSG_SetMsgTime(&LongEventTlm.TlmHeader.Msg, *TimeStamp);
+    CFE_MSG_SetMsgTime(&LongEventTlmPtr->TlmHeader.Msg, *TimeStamp);
 
     /* Write event to the event log */
-    EVS_AddLog(&LongEventTlm);
+    EVS_AddLog(LongEventTlmPtr);
 
     /* Send event via selected ports */
-    EVS_SendViaPorts(&LongEventTlm);
+    EVS_SendViaPorts(LongEventTlmPtr);
 
     if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_LONG)
     {
         /* Send long event via SoftwareBus */
-        CFE_SB_TransmitMsg(&LongEventTlm.TlmHeader.Msg, true);
+        CFE_SB_TransmitMsg(&LongEventTlmPtr->TlmHeader.Msg, true);
     }
     else if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_SHORT)
     {
@@ -435,7 +506,7 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         CFE_MSG_Init(&ShortEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
                      sizeof(ShortEventTlm));
         CFE_MSG_SetMsgTime(&ShortEventTlm.TlmHeader.Msg, *TimeStamp);
-        ShortEventTlm.Payload.PacketID = LongEventTlm.Payload.PacketID;
+        ShortEventTlm.Payload.PacketID = LongEventTlmPtr->Payload.PacketID;
         CFE_SB_TransmitMsg(&ShortEventTlm.TlmHeader.Msg, true);
     }
 
@@ -450,7 +521,7 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         AppDataPtr->EventCount++;
     }
 
-} /* End EVS_GenerateEventTelemetry */
+} /* End EVS_PublishEventTelemetry */
 
 /*
 **             Function Prologue
@@ -165,11 +165,16 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 
 EVS_BinFilter_t *EVS_FindEventID(int16 EventID, EVS_BinFilter_t *FilterArray);
 
+void             EVS_BuildFilterIndex(EVS_AppData_t *AppDataPtr);
+EVS_BinFilter_t *EVS_LookupFilter(EVS_AppData_t *AppDataPtr, int16 EventID);
+
 void EVS_EnableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask);
 void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask);
 
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *Time, const char *MsgSpec, va_list ArgPtr);
+void EVS_PublishEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlmPtr,
+                               int ExpandedLength, const CFE_TIME_SysTime_t *TimeStamp);
 
 int32 EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...);
 
@@ -52,6 +52,22 @@
 #error CFE_EVS_DEFAULT_MSG_FORMAT can only be CFE_EVS_MsgFormat_LONG or CFE_EVS_MsgFormat_SHORT !
 #endif
 
+/*
+** The per-application filter index stores filter slot numbers plus one in a uint8
+*/
+#if (CFE_PLATFORM_EVS_MAX_EVENT_FILTERS < 1) || (CFE_PLATFORM_EVS_MAX_EVENT_FILTERS > 254)
+#error CFE_PLATFORM_EVS_MAX_EVENT_FILTERS must be between 1 and 254!
+#endif
+
+#if (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH < 2) || \
+    ((CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH & (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH - 1)) != 0)
+#error CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH must be a power of two and at least 2!
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_DRAIN_MSEC < 1
+#error CFE_PLATFORM_EVS_DEFERRED_DRAIN_MSEC must be greater than zero!
+#endif
+
 #if CFE_PLATFORM_EVS_PORT_DEFAULT > 0x0F
 #error CFE_PLATFORM_EVS_PORT_DEFAULT cannot be greater than 0x0F!
 #endif
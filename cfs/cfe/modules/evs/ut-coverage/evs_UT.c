@@ -200,6 +200,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_IllegalAppID);
     UT_ADD_TEST(Test_UnregisteredApp);
     UT_ADD_TEST(Test_FilterRegistration);
+    UT_ADD_TEST(Test_DeferredFormat);
     UT_ADD_TEST(Test_FilterReset);
     UT_ADD_TEST(Test_Format);
     UT_ADD_TEST(Test_Ports);
@@ -244,7 +245,12 @@ void Test_Init(void)
     /* Set unexpected message ID */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &msgid, sizeof(msgid), false);
 
+    /* A receive timeout only wakes the task to send deferred events; fail the read after it */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_PIPE_RD_ERR);
+
     UT_EVS_DoGenericCheckEvents(CFE_EVS_TaskMain, &UT_EVS_EventBuf);
+    UT_Report(__FILE__, __LINE__, UT_GetStubCount(UT_KEY(CFE_SB_ReceiveBuffer)) == 3, "CFE_EVS_TaskMain",
+              "Command pipe timeout continues the main loop");
     ASSERT_TRUE(UT_SyslogIsInHistory(EVS_SYSLOG_MSGS[8]));
     ASSERT_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_ERR_MSGID_EID);
 
@@ -595,6 +601,53 @@ void Test_FilterRegistration(void)
     UT_Report(__FILE__, __LINE__, CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "FAILED") == CFE_SUCCESS,
               "CFE_EVS_SendEvent", "Locked info message should still be filtered");
 
+    /* Test filter lookup with event IDs that collide in the filter index */
+    UT_InitData();
+    filter[0].EventID = 1;
+    filter[0].Mask    = 0x0001;
+    filter[1].EventID = 1 + CFE_EVS_FILTER_INDEX_SIZE;
+    filter[1].Mask    = 0x0002;
+    UT_Report(__FILE__, __LINE__, CFE_EVS_Register(filter, 2, CFE_EVS_EventFilter_BINARY) == CFE_SUCCESS,
+              "CFE_EVS_Register", "Valid w/ colliding filter index entries");
+    UT_Report(__FILE__, __LINE__, EVS_LookupFilter(AppDataPtr, 1) == &AppDataPtr->BinFilters[0], "EVS_LookupFilter",
+              "First colliding event ID found");
+    UT_Report(__FILE__, __LINE__,
+              EVS_LookupFilter(AppDataPtr, 1 + CFE_EVS_FILTER_INDEX_SIZE) == &AppDataPtr->BinFilters[1],
+              "EVS_LookupFilter", "Second colliding event ID found");
+    UT_Report(__FILE__, __LINE__, EVS_LookupFilter(AppDataPtr, 1 + 2 * CFE_EVS_FILTER_INDEX_SIZE) == NULL,
+              "EVS_LookupFilter", "Unregistered colliding event ID not found");
+    UT_Report(__FILE__, __LINE__, EVS_LookupFilter(AppDataPtr, 2) == NULL, "EVS_LookupFilter",
+              "Unregistered event ID not found");
+
+    /* Test that freeing the first colliding entry and rebuilding keeps the second reachable */
+    UT_InitData();
+    AppDataPtr->BinFilters[0].EventID = CFE_EVS_FREE_SLOT;
+    EVS_BuildFilterIndex(AppDataPtr);
+    UT_Report(__FILE__, __LINE__,
+              EVS_LookupFilter(AppDataPtr, 1) == NULL &&
+                  EVS_LookupFilter(AppDataPtr, 1 + CFE_EVS_FILTER_INDEX_SIZE) == &AppDataPtr->BinFilters[1],
+              "EVS_BuildFilterIndex", "Rebuild after freeing a colliding slot");
+
+    /* Test that a stale index entry cannot match the wrong filter */
+    UT_InitData();
+    AppDataPtr->BinFilters[1].EventID = 3;
+    UT_Report(__FILE__, __LINE__, EVS_LookupFilter(AppDataPtr, 1 + CFE_EVS_FILTER_INDEX_SIZE) == NULL,
+              "EVS_LookupFilter", "Stale index entry rejected");
+
+    /* Test event type checks against the active event types */
+    UT_InitData();
+    AppDataPtr->ActiveFlag           = true;
+    AppDataPtr->EventTypesActiveFlag = CFE_EVS_ERROR_BIT;
+    UT_Report(__FILE__, __LINE__, EVS_IsFiltered(AppDataPtr, 2, CFE_EVS_EventType_ERROR) == false, "EVS_IsFiltered",
+              "Enabled event type not filtered");
+    UT_Report(__FILE__, __LINE__, EVS_IsFiltered(AppDataPtr, 2, CFE_EVS_EventType_CRITICAL) == true,
+              "EVS_IsFiltered", "Disabled event type filtered");
+    AppDataPtr->EventTypesActiveFlag = 0xFF;
+    UT_Report(__FILE__, __LINE__,
+              EVS_IsFiltered(AppDataPtr, 2, 0) == true &&
+                  EVS_IsFiltered(AppDataPtr, 2, CFE_EVS_EventType_CRITICAL + 1) == true,
+              "EVS_IsFiltered", "Invalid event types filtered");
+
     /* Return application to original state: re-register application */
     UT_InitData();
     UT_Report(__FILE__, __LINE__, CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY) == CFE_SUCCESS,
@@ -618,6 +671,148 @@ void Test_FilterRegistration(void)
               "CFE_EVS_SendTimedEvent", "Application registered and filtered");
 }
 
+/*
+** Test deferred event formatting
+*/
+void Test_DeferredFormat(void)
+{
+    EVS_AppData_t *                AppDataPtr;
+    CFE_ES_AppId_t                 AppID;
+    UT_SoftwareBusSnapshot_Entry_t SnapshotData;
+    char                           Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    char                           Expected[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    char                           StrArg[8];
+    char                           LongStr[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + 10];
+    int                            i;
+
+    UtPrintf("Begin Test Deferred Format");
+
+    /* Get a local ref to the "current" AppData table entry */
+    EVS_GetCurrentContext(&AppDataPtr, &AppID);
+
+    CFE_EVS_Global.EVS_AppID                            = AppID;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+
+    memset(&SnapshotData, 0, sizeof(SnapshotData));
+    SnapshotData.SnapshotOffset = offsetof(CFE_EVS_LongEventTlm_t, Payload.Message);
+    SnapshotData.SnapshotSize   = sizeof(Message);
+    SnapshotData.SnapshotBuffer = Message;
+
+    /* Test enabling deferred formatting for an unregistered app */
+    UT_InitData();
+    CFE_EVS_Unregister();
+    UT_Report(__FILE__, __LINE__, CFE_EVS_SetDeferredFormat(true) == CFE_EVS_APP_NOT_REGISTERED,
+              "CFE_EVS_SetDeferredFormat", "Application not registered");
+
+    /* Test enabling deferred formatting with a failed app ID lookup */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    UT_Report(__FILE__, __LINE__, CFE_EVS_SetDeferredFormat(true) == CFE_EVS_APP_ILLEGAL_APP_ID,
+              "CFE_EVS_SetDeferredFormat",
+              "Get application ID failure");
+
+    /* Test enabling deferred formatting */
+    UT_InitData();
+    CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
+    AppDataPtr->EventTypesActiveFlag = CFE_EVS_INFORMATION_BIT;
+    UT_Report(__FILE__, __LINE__, CFE_EVS_SetDeferredFormat(true) == CFE_SUCCESS, "CFE_EVS_SetDeferredFormat",
+              "Enable deferred formatting");
+
+    /* Test that a deferred event is queued, with its string arguments copied */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &SnapshotData);
+    strcpy(StrArg, "abc");
+    snprintf(Expected, sizeof(Expected), "%d %s %lu %x %5.2f %c %% %lld|%-5s|", -5, StrArg, 7UL, 0xabu, 1.5, 'z',
+             -9LL, "xy");
+    SnapshotData.Count = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "%d %s %lu %x %5.2f %c %% %lld|%-5s|", -5, StrArg,
+                                7UL, 0xabu, 1.5, 'z', -9LL, "xy") == CFE_SUCCESS &&
+                  SnapshotData.Count == 0,
+              "CFE_EVS_SendEvent", "Deferred event queued");
+    strcpy(StrArg, "XXX");
+
+    /* Test that the EVS task formats and sends the queued event */
+    memset(Message, 0, sizeof(Message));
+    EVS_ProcessDeferredEvents();
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == 1 && strcmp(Message, Expected) == 0,
+              "EVS_ProcessDeferredEvents", "Deferred event formatted");
+
+    /* Test the remaining argument types */
+    snprintf(Expected, sizeof(Expected), "%zu %hd %p %jd %td %llu %G %s", (size_t)3, (short)-2, (void *)AppDataPtr,
+             (intmax_t)-4, (ptrdiff_t)6, 8ULL, 0.25, "(null)");
+    SnapshotData.Count = 0;
+    CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "%zu %hd %p %jd %td %llu %G %s", (size_t)3, (short)-2,
+                      (void *)AppDataPtr, (intmax_t)-4, (ptrdiff_t)6, 8ULL, 0.25, (char *)NULL);
+    EVS_ProcessDeferredEvents();
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == 1 && strcmp(Message, Expected) == 0,
+              "EVS_ProcessDeferredEvents", "All argument types formatted");
+
+    /* Test that a format the capture cannot handle is formatted immediately, after the queued events */
+    SnapshotData.Count = 0;
+    CFE_EVS_SendEvent(2, CFE_EVS_EventType_INFORMATION, "Queued");
+    UT_Report(__FILE__, __LINE__,
+              CFE_EVS_SendEvent(2, CFE_EVS_EventType_INFORMATION, "%*d", 3, 4) == CFE_SUCCESS &&
+                  SnapshotData.Count == 2 && strcmp(Message, "  4") == 0,
+              "CFE_EVS_SendEvent", "Unsupported conversion formatted immediately");
+    SnapshotData.Count = 0;
+    CFE_EVS_SendEvent(2, CFE_EVS_EventType_INFORMATION, "%d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9);
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == 1, "CFE_EVS_SendEvent",
+              "Too many arguments formatted immediately");
+    EVS_ProcessDeferredEvents();
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == 1, "EVS_ProcessDeferredEvents",
+              "Abandoned slots are not sent");
+
+    /* Test that a full queue is drained in order before the next event is formatted immediately */
+    SnapshotData.Count = 0;
+    for (i = 0; i < CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH; i++)
+    {
+        CFE_EVS_SendEvent(3, CFE_EVS_EventType_INFORMATION, "Event %d", i);
+    }
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == 0, "CFE_EVS_SendEvent", "Queue filled");
+    CFE_EVS_SendEvent(3, CFE_EVS_EventType_INFORMATION, "Event %d", i);
+    snprintf(Expected, sizeof(Expected), "Event %d", CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH);
+    UT_Report(__FILE__, __LINE__,
+              SnapshotData.Count == CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH + 1 && strcmp(Message, Expected) == 0,
+              "CFE_EVS_SendEvent", "Full queue drained in order before immediate formatting");
+    EVS_ProcessDeferredEvents();
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH + 1,
+              "EVS_ProcessDeferredEvents", "Nothing left queued");
+
+    /* Test truncation of long strings and long messages */
+    memset(LongStr, 'a', sizeof(LongStr) - 1);
+    LongStr[sizeof(LongStr) - 1] = '\0';
+    SnapshotData.Count           = 0;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter = 0;
+    CFE_EVS_SendEvent(4, CFE_EVS_EventType_INFORMATION, "%s%s%d", LongStr, LongStr, 5);
+    EVS_ProcessDeferredEvents();
+    UT_Report(__FILE__, __LINE__,
+              SnapshotData.Count == 1 && Message[sizeof(Message) - 2] == CFE_EVS_MSG_TRUNCATED &&
+                  CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter == 1,
+              "EVS_ProcessDeferredEvents", "Long deferred message truncated");
+
+    /* Test that events queued under a since-reused app record are dropped */
+    SnapshotData.Count = 0;
+    CFE_EVS_SendEvent(5, CFE_EVS_EventType_INFORMATION, "Stale");
+    AppDataPtr->AppID = CFE_ES_APPID_UNDEFINED;
+    EVS_ProcessDeferredEvents();
+    AppDataPtr->AppID = AppID;
+    UT_Report(__FILE__, __LINE__, SnapshotData.Count == 0, "EVS_ProcessDeferredEvents", "Stale event dropped");
+
+    /* Test that unregistering sends the app's queued events first */
+    CFE_EVS_SendEvent(6, CFE_EVS_EventType_INFORMATION, "Flushed");
+    UT_Report(__FILE__, __LINE__,
+              CFE_EVS_Unregister() == CFE_SUCCESS && SnapshotData.Count == 1 && strcmp(Message, "Flushed") == 0,
+              "CFE_EVS_Unregister", "Queued events flushed");
+
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), NULL, NULL);
+
+    /* Return application to original state: re-register application */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__, CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY) == CFE_SUCCESS,
+              "CFE_EVS_Register", "Re-register application");
+}
+
 /*
 ** Test reset filter calls
 */
@@ -109,6 +109,21 @@ void Test_UnregisteredApp(void);
 ******************************************************************************/
 void Test_FilterRegistration(void);
 
+/*****************************************************************************/
+/**
+** \brief Test deferred event formatting
+**
+** \par Description
+**        This function tests queuing events for formatting by the EVS task.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeferredFormat(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test reset filter API calls
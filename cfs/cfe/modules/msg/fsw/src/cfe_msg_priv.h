@@ -81,4 +81,24 @@ static inline void CFE_MSG_SetHeaderField(uint8 *Word, uint16 Val, uint16 Mask)
  */
 void CFE_MSG_InitDefaultHdr(CFE_MSG_Message_t *MsgPtr);
 
+/*****************************************************************************/
+/**
+ * \brief XOR all bytes of a buffer into a seed value
+ *
+ * \par DESCRIPTION
+ *     Word-at-a-time engine behind the secondary header checksum.  Bytes up
+ *     to the first 8-byte boundary are folded individually, the body is
+ *     XORed a word (or vector, when SSE2/NEON is available at build time)
+ *     at a time and folded down to 8 bits, and the tail is folded bytewise.
+ *     The result is bit-identical to a plain byte loop for any alignment
+ *     and length.
+ *
+ * \param[in]      DataPtr Buffer to fold, may be unaligned
+ * \param[in]      Len     Number of bytes in the buffer
+ * \param[in]      Seed    Initial value XORed with the buffer
+ *
+ * \return Seed XOR every byte of the buffer
+ */
+uint8 CFE_MSG_XorBytes(const uint8 *DataPtr, size_t Len, uint8 Seed);
+
 #endif /* CFE_MSG_PRIV_H */
@@ -24,6 +24,118 @@
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
 
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CFE_MSG_XOR_VECTOR_SIZE 16
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define CFE_MSG_XOR_VECTOR_SIZE 16
+#endif
+
+/* Unrolled word block, four independent accumulators keep the loads pipelined */
+#define CFE_MSG_XOR_BLOCK_SIZE (4 * sizeof(uint64))
+
+/******************************************************************************/
+/**
+ * \brief Fold a 64-bit XOR accumulator down to a single byte
+ */
+static inline uint8 CFE_MSG_XorFold64(uint64 Word)
+{
+    Word ^= Word >> 32;
+    Word ^= Word >> 16;
+    Word ^= Word >> 8;
+
+    return (uint8)Word;
+}
+
+/******************************************************************************
+ * XOR all bytes into a seed - See header file for details
+ */
+uint8 CFE_MSG_XorBytes(const uint8 *DataPtr, size_t Len, uint8 Seed)
+{
+    uint64 Acc[4] = {0, 0, 0, 0};
+    uint64 Word;
+    uint8  Result = Seed;
+
+    /* Bytewise up to the first word boundary so the body loads are aligned */
+    while (Len > 0 && ((cpuaddr)DataPtr & (sizeof(uint64) - 1)) != 0)
+    {
+        Result ^= *(DataPtr++);
+        --Len;
+    }
+
+#ifdef CFE_MSG_XOR_VECTOR_SIZE
+    if (Len >= (2 * CFE_MSG_XOR_VECTOR_SIZE))
+    {
+        uint64 Lanes[2];
+#if defined(__SSE2__)
+        __m128i VAcc0 = _mm_setzero_si128();
+        __m128i VAcc1 = _mm_setzero_si128();
+
+        while (Len >= (2 * CFE_MSG_XOR_VECTOR_SIZE))
+        {
+            VAcc0 = _mm_xor_si128(VAcc0, _mm_loadu_si128((const __m128i *)(const void *)DataPtr));
+            VAcc1 = _mm_xor_si128(VAcc1,
+                                  _mm_loadu_si128((const __m128i *)(const void *)(DataPtr + CFE_MSG_XOR_VECTOR_SIZE)));
+            DataPtr += 2 * CFE_MSG_XOR_VECTOR_SIZE;
+            Len -= 2 * CFE_MSG_XOR_VECTOR_SIZE;
+        }
+        _mm_storeu_si128((__m128i *)(void *)Lanes, _mm_xor_si128(VAcc0, VAcc1));
+#else
+        uint8x16_t VAcc0 = vdupq_n_u8(0);
+        uint8x16_t VAcc1 = vdupq_n_u8(0);
+
+        while (Len >= (2 * CFE_MSG_XOR_VECTOR_SIZE))
+        {
+            VAcc0 = veorq_u8(VAcc0, vld1q_u8(DataPtr));
+            VAcc1 = veorq_u8(VAcc1, vld1q_u8(DataPtr + CFE_MSG_XOR_VECTOR_SIZE));
+            DataPtr += 2 * CFE_MSG_XOR_VECTOR_SIZE;
+            Len -= 2 * CFE_MSG_XOR_VECTOR_SIZE;
+        }
+        vst1q_u8((uint8 *)Lanes, veorq_u8(VAcc0, VAcc1));
+#endif
+        Acc[0] = Lanes[0];
+        Acc[1] = Lanes[1];
+    }
+#endif
+
+    while (Len >= CFE_MSG_XOR_BLOCK_SIZE)
+    {
+        /* memcpy keeps the loads free of strict aliasing issues, compilers emit a plain load */
+        memcpy(&Word, DataPtr, sizeof(Word));
+        Acc[0] ^= Word;
+        memcpy(&Word, DataPtr + sizeof(Word), sizeof(Word));
+        Acc[1] ^= Word;
+        memcpy(&Word, DataPtr + (2 * sizeof(Word)), sizeof(Word));
+        Acc[2] ^= Word;
+        memcpy(&Word, DataPtr + (3 * sizeof(Word)), sizeof(Word));
+        Acc[3] ^= Word;
+        DataPtr += CFE_MSG_XOR_BLOCK_SIZE;
+        Len -= CFE_MSG_XOR_BLOCK_SIZE;
+    }
+
+    while (Len >= sizeof(Word))
+    {
+        memcpy(&Word, DataPtr, sizeof(Word));
+        Acc[0] ^= Word;
+        DataPtr += sizeof(Word);
+        Len -= sizeof(Word);
+    }
+
+    /* XOR is byte-position independent, so the fold is the same for either endianness */
+    Result ^= CFE_MSG_XorFold64(Acc[0] ^ Acc[1] ^ Acc[2] ^ Acc[3]);
+
+    while (Len > 0)
+    {
+        Result ^= *(DataPtr++);
+        --Len;
+    }
+
+    return Result;
+}
+
 /******************************************************************************/
 /**
  * \brief Compute checksum - internal utility
@@ -35,19 +147,12 @@
 CFE_MSG_Checksum_t CFE_MSG_ComputeCheckSum(const CFE_MSG_Message_t *MsgPtr)
 {
 
-    CFE_MSG_Size_t     PktLen  = 0;
-    const uint8 *      BytePtr = MsgPtr->Byte;
-    CFE_MSG_Checksum_t chksum  = 0xFF;
+    CFE_MSG_Size_t PktLen = 0;
 
     /* Message already checked, no error case reachable */
     CFE_MSG_GetSize(MsgPtr, &PktLen);
 
-    while (PktLen--)
-    {
-        chksum ^= *(BytePtr++);
-    }
-
-    return chksum;
+    return CFE_MSG_XorBytes(MsgPtr->Byte, PktLen, 0xFF);
 }
 
 /******************************************************************************
@@ -32,8 +32,20 @@
 #include "cfe_msg.h"
 #include "test_cfe_msg_checksum.h"
 #include "cfe_error.h"
+#include "cfe_msg_priv.h"
 #include <string.h>
 
+/* Reference byte loop the word-at-a-time engine must match */
+static uint8 Test_MSG_XorReference(const uint8 *DataPtr, size_t Len, uint8 Seed)
+{
+    while (Len--)
+    {
+        Seed ^= *(DataPtr++);
+    }
+
+    return Seed;
+}
+
 void Test_MSG_Checksum(void)
 {
     CFE_MSG_CommandHeader_t cmd;
@@ -87,4 +99,31 @@ void Test_MSG_Checksum(void)
     ASSERT_EQ(CFE_MSG_ValidateChecksum(msgptr, &actual), CFE_SUCCESS);
     ASSERT_EQ(actual, true);
     ASSERT_EQ(Test_MSG_NotZero(msgptr), MSG_LENGTH_FLAG | MSG_HASSEC_FLAG | MSG_TYPE_FLAG);
+
+    UtPrintf("Word-at-a-time engine matches byte loop for all alignments and lengths");
+    {
+        uint64 buf[40];
+        uint8 *bytes = (uint8 *)buf;
+        size_t offset;
+        size_t len;
+        uint32 mismatches = 0;
+
+        for (len = 0; len < sizeof(buf); len++)
+        {
+            bytes[len] = (uint8)((len * 37) + 11);
+        }
+
+        for (offset = 0; offset < (2 * sizeof(uint64)); offset++)
+        {
+            for (len = 0; len <= (sizeof(buf) - offset); len++)
+            {
+                if (CFE_MSG_XorBytes(&bytes[offset], len, 0xFF) != Test_MSG_XorReference(&bytes[offset], len, 0xFF))
+                {
+                    mismatches++;
+                }
+            }
+        }
+        ASSERT_EQ(mismatches, 0);
+        ASSERT_EQ(CFE_MSG_XorBytes(bytes, 0, 0x5A), 0x5A);
+    }
 }
@@ -41,7 +41,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_SB_MAX_EID 67
+#define CFE_SB_MAX_EID 68
 
 /*
 ** SB task event message ID's.
@@ -101,6 +101,20 @@
 **/
 #define CFE_SB_CR_PIPE_ERR_EID 4
 
+/** \brief <tt> 'CreatePipeErr:OS_SelectEventCreate returned \%d,app \%s' </tt>
+**  \event <tt> 'CreatePipeErr:OS_SelectEventCreate returned \%d,app \%s' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when the #CFE_SB_CreatePipeEx API is called
+**  with #CFE_SB_PIPEOPTS_POLLABLE and the OS could not create the pollable event
+**  for the pipe.  The error status returned by the OS is displayed in the event.
+**  Platforms without a pollable event primitive return OS_ERR_NOT_IMPLEMENTED.
+**/
+#define CFE_SB_CR_PIPE_POLL_ERR_EID 68
+
 /** \brief <tt> 'Pipe Created:name \%s,id \%d,app \%s' </tt>
 **  \event <tt> 'Pipe Created:name \%s,id \%d,app \%s' </tt>
 **
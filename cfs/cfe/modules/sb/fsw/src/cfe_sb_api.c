@@ -89,11 +89,21 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx)
  * Function: CFE_SB_CreatePipe - See API and header file for details
  */
 int32 CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName)
+{
+    return CFE_SB_CreatePipeEx(PipeIdPtr, Depth, PipeName, 0);
+} /* end CFE_SB_CreatePipe */
+
+/*
+ * Function: CFE_SB_CreatePipeEx - See API and header file for details
+ */
+int32 CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName, uint8 Opts)
 {
     CFE_ES_AppId_t   AppId;
     CFE_ES_TaskId_t  TskId;
     osal_id_t        SysQueueId;
+    osal_id_t        PollEventId;
     int32            Status;
+    int32            OsStatus;
     CFE_SB_PipeD_t * PipeDscPtr;
     CFE_ResourceId_t PendingPipeId = CFE_RESOURCEID_UNDEFINED;
     uint16           PendingEventId;
@@ -101,6 +111,8 @@ int32 CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *Pi
 
     Status         = CFE_SUCCESS;
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    PollEventId    = OS_OBJECT_ID_UNDEFINED;
+    OsStatus       = OS_SUCCESS;
     PendingEventId = 0;
     PipeDscPtr     = NULL;
 
@@ -180,14 +192,29 @@ int32 CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *Pi
         }
     }
 
+    /* create the event that makes the pipe visible to OS_SelectMultiple(), if requested */
+    if (Status == CFE_SUCCESS && (Opts & CFE_SB_PIPEOPTS_POLLABLE) != 0)
+    {
+        OsStatus = OS_SelectEventCreate(&PollEventId);
+        if (OsStatus != OS_SUCCESS)
+        {
+            OS_QueueDelete(SysQueueId);
+
+            PendingEventId = CFE_SB_CR_PIPE_POLL_ERR_EID;
+            Status         = CFE_SB_PIPE_CR_ERR;
+        }
+    }
+
     CFE_SB_LockSharedData(__func__, __LINE__);
 
     if (Status == CFE_SUCCESS)
     {
         /* fill in the pipe table fields */
         PipeDscPtr->SysQueueId    = SysQueueId;
+        PipeDscPtr->PollEventId   = PollEventId;
         PipeDscPtr->MaxQueueDepth = Depth;
         PipeDscPtr->AppId         = AppId;
+        PipeDscPtr->Opts          = Opts;
 
         CFE_SB_PipeDescSetUsed(PipeDscPtr, PendingPipeId);
 
@@ -259,12 +286,17 @@ int32 CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *Pi
                                            "CreatePipeErr:OS_QueueCreate returned %d,app %s", (int)Status,
                                            CFE_SB_GetAppTskName(TskId, FullName));
                 break;
+            case CFE_SB_CR_PIPE_POLL_ERR_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_POLL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "CreatePipeErr:OS_SelectEventCreate returned %d,app %s", (int)OsStatus,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
         }
     }
 
     return Status;
 
-} /* end CFE_SB_CreatePipe */
+} /* end CFE_SB_CreatePipeEx */
 
 /*
  *  Function: CFE_SB_DeletePipe - See API and header file for details
@@ -345,14 +377,17 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     CFE_ES_TaskId_t             TskId;
     CFE_SB_BufferD_t *          BufDscPtr;
     osal_id_t                   SysQueueId;
+    osal_id_t                   PollEventId;
     char                        FullName[(OS_MAX_API_NAME * 2)];
     size_t                      BufDscSize;
     CFE_SB_RemovePipeCallback_t Args;
     uint16                      PendingEventID;
+    uint16                      PendingDeliveries;
 
     Status         = CFE_SUCCESS;
     PendingEventID = 0;
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    PollEventId    = OS_OBJECT_ID_UNDEFINED;
     BufDscPtr      = NULL;
 
     /* take semaphore to prevent a task switch during this call */
@@ -386,8 +421,11 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          *
          * However we must first save certain state data for later deletion.
          */
-        SysQueueId = PipeDscPtr->SysQueueId;
-        BufDscPtr  = PipeDscPtr->LastBuffer;
+        SysQueueId  = PipeDscPtr->SysQueueId;
+        PollEventId = PipeDscPtr->PollEventId;
+
+        /* Release any buffer(s) still held from the last receive on this pipe */
+        CFE_SB_ReleasePipeLastBuffers(PipeDscPtr);
 
         /*
          * Mark entry as "reserved" so other resources can be deleted
@@ -416,13 +454,34 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
 
             if (OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK) != OS_SUCCESS)
             {
-                /* no more messages */
-                break;
+                /*
+                 * The queue is empty, but a broadcast that selected this pipe before
+                 * it was removed from the routes may still be writing to the queue
+                 * (this is done outside the SB lock).  Wait for any such write to
+                 * complete so that its buffer reference gets drained here too.
+                 */
+                CFE_SB_LockSharedData(__func__, __LINE__);
+                PendingDeliveries = PipeDscPtr->PendingDeliveries;
+                CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+                if (PendingDeliveries == 0)
+                {
+                    /* no more messages */
+                    break;
+                }
+
+                OS_TaskDelay(CFE_SB_PIPE_DRAIN_DLY);
             }
         }
 
         /* Delete the underlying OS queue */
         OS_QueueDelete(SysQueueId);
+
+        /* Nothing signals the event once the deliveries have drained */
+        if (OS_ObjectIdDefined(PollEventId))
+        {
+            OS_close(PollEventId);
+        }
     }
 
     /*
@@ -519,7 +578,8 @@ int32 CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
     }
     else
     {
-        PipeDscPtr->Opts = Opts;
+        /* Pollability is fixed when the pipe is created */
+        PipeDscPtr->Opts = (Opts & ~CFE_SB_PIPEOPTS_POLLABLE) | (PipeDscPtr->Opts & CFE_SB_PIPEOPTS_POLLABLE);
     }
 
     /* If anything went wrong, increment the error counter before unlock */
@@ -636,6 +696,38 @@ int32 CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return Status;
 } /* end CFE_SB_GetPipeOpts */
 
+/*
+ *  Function:  CFE_SB_GetPipePollId - See API and header file for details
+ */
+int32 CFE_SB_GetPipePollId(CFE_SB_PipeId_t PipeId, osal_id_t *PollIdPtr)
+{
+    int32           Status;
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    if (PollIdPtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status = CFE_SUCCESS;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) || !OS_ObjectIdDefined(PipeDscPtr->PollEventId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        *PollIdPtr = PipeDscPtr->PollEventId;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+} /* end CFE_SB_GetPipePollId */
+
 /*
  *  Function:  CFE_SB_GetPipeName - See API and header file for details
  */
@@ -1558,17 +1650,24 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
  */
 void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId)
 {
-    CFE_ES_AppId_t         AppId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_EventBuf_t      SBSndErr;
-    int32                  Status;
-    uint32                 i;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
+    CFE_ES_AppId_t          AppId;
+    CFE_ES_TaskId_t         TskId;
+    CFE_SB_DestinationD_t * DestPtr;
+    CFE_SB_PipeD_t *        PipeDscPtr;
+    CFE_SB_EventBuf_t       SBSndErr;
+    CFE_SB_DeliveryEntry_t  Delivery[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+    CFE_SB_DeliveryEntry_t *DeliveryPtr;
+    uint32                  NumDeliveries;
+    CFE_SB_MsgId_t          MsgId;
+    uint32                  i;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
+    char                    PipeName[OS_MAX_API_NAME];
+    bool                    IsPersistent;
+    bool                    IsOrdered;
 
     SBSndErr.EvtsToSnd = 0;
+    NumDeliveries      = 0;
+    MsgId              = BufDscPtr->MsgId;
 
     /* get app id for loopback testing */
     CFE_ES_GetAppID(&AppId);
@@ -1576,11 +1675,22 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     /* get task id for events and Sender Info*/
     CFE_ES_GetTaskID(&TskId);
 
+    /*
+     * Hold the ordering lock of the route from the sequence count through the
+     * queue writes, so two publishers of the same MsgId cannot enqueue out of
+     * order once the SB lock is released.  Sends on other routes are not held up.
+     */
+    IsOrdered = CFE_SBR_IsValidRouteId(RouteId);
+    if (IsOrdered)
+    {
+        CFE_SB_LockRouteOrder(RouteId);
+    }
+
     /* take semaphore to prevent a task switch during processing */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
     /* For an invalid route / no subsribers this whole logic can be skipped */
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    if (IsOrdered)
     {
         /* Set the seq count if requested (while locked) before actually sending */
         /* For some reason this is only done for TLM types (historical, TBD) */
@@ -1592,8 +1702,9 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(RouteId));
         }
 
-        /* Send the packet to all destinations  */
-        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
+        /* Select the destinations the packet will be written to */
+        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId);
+             DestPtr != NULL && NumDeliveries < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; DestPtr = DestPtr->Next)
         {
             if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
             {
@@ -1629,69 +1740,159 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             } /* end if */
 
             /*
-            ** Write the buffer descriptor to the queue of the pipe.  If the write
-            ** failed, log info and increment the pipe's error counter.
-            */
-            Status = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+             * The queue write itself is done after the lock is released, so account
+             * for it now as if it will succeed: the pending queue entry holds a ref
+             * to the buffer, and the receiver may dequeue it as soon as it is written.
+             * Any failed write is backed out after the fact.
+             */
+            CFE_SB_IncrBufUseCnt(BufDscPtr);
 
-            if (Status == OS_SUCCESS)
-            {
-                /* The queue now holds a ref to the buffer, so increment its ref count. */
-                CFE_SB_IncrBufUseCnt(BufDscPtr);
+            DeliveryPtr = &Delivery[NumDeliveries];
 
-                DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
-                DestPtr->DestCnt++;   /* used for statistics */
-                ++PipeDscPtr->CurrentQueueDepth;
-                if (PipeDscPtr->CurrentQueueDepth >= PipeDscPtr->PeakQueueDepth)
-                {
-                    PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
-                }
-            }
-            else if (Status == OS_QUEUE_FULL)
+            /*
+             * A pollable pipe only needs its event signalled when it goes non-empty.
+             * The receiver clears the event (under this lock) only once the depth
+             * returns to zero, so a signal sent after this increment is never lost.
+             */
+            DeliveryPtr->PollEventId = OS_OBJECT_ID_UNDEFINED;
+            if (PipeDscPtr->CurrentQueueDepth == 0)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
-                PipeDscPtr->SendErrors++;
+                DeliveryPtr->PollEventId = PipeDscPtr->PollEventId;
             }
-            else
+
+            DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
+            DestPtr->DestCnt++;   /* used for statistics */
+            ++PipeDscPtr->CurrentQueueDepth;
+            if (PipeDscPtr->CurrentQueueDepth >= PipeDscPtr->PeakQueueDepth &&
+                PipeDscPtr->CurrentQueueDepth <= PipeDscPtr->MaxQueueDepth)
             {
-                /* Unexpected error while writing to queue. */
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_WR_ERR_EID;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].ErrStat = Status;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
-                PipeDscPtr->SendErrors++;
-            } /*end if */
+                PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
+            }
+
+            /* Prevents the pipe from being deleted until the write is complete */
+            ++PipeDscPtr->PendingDeliveries;
+
+            DeliveryPtr->PipeDscPtr = PipeDscPtr;
+            DeliveryPtr->PipeId     = DestPtr->PipeId;
+            DeliveryPtr->SysQueueId = PipeDscPtr->SysQueueId;
+            ++NumDeliveries;
 
         } /* end loop over destinations */
     }
 
     /*
-     * If any specific delivery issues occured, also increment the
-     * general error count before releasing the lock.
+     * A publish ring buffer stays owned by its app, and the ring keeps the
+     * reference that would otherwise be released below.  This is snapshotted
+     * because the ring may be deleted while the lock is released, which
+     * then drops that reference itself.
      */
-    if (SBSndErr.EvtsToSnd > 0)
+    IsPersistent = BufDscPtr->Persistent;
+    if (!IsPersistent)
     {
-        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+        /*
+         * Remove this from whatever list it was in
+         *
+         * If it was a singleton/new buffer this has no effect.
+         * If it was a zero-copy buffer this removes it from the ZeroCopyList.
+         */
+        CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+
+        /* clear the AppID field in case it was a zero copy buffer,
+         * as it is no longer owned by that app after broadcasting */
+        BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+
+        /* track the buffer as an in-transit message */
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
     }
 
     /*
-     * Remove this from whatever list it was in
-     *
-     * If it was a singleton/new buffer this has no effect.
-     * If it was a zero-copy buffer this removes it from the ZeroCopyList.
+     * Release the lock while writing to the pipe queues.  This is the expensive part
+     * of a send (a system call per destination on most OS's), and doing it unlocked
+     * allows tasks publishing different messages to fan out concurrently.  The route
+     * ordering lock is still held, so sends of this message cannot pass each other.
      */
-    CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < NumDeliveries; i++)
+    {
+        /*
+        ** Write the buffer descriptor to the queue of the pipe.  If the write
+        ** failed, it is logged and backed out below.
+        */
+        Delivery[i].Status = OS_QueuePut(Delivery[i].SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+
+        /* Wake any task waiting on the pipe's event alongside its other I/O */
+        if (Delivery[i].Status == OS_SUCCESS && OS_ObjectIdDefined(Delivery[i].PollEventId))
+        {
+            OS_SelectEventSignal(Delivery[i].PollEventId);
+        }
+    }
+
+    if (IsOrdered)
+    {
+        CFE_SB_UnlockRouteOrder(RouteId);
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
 
-    /* clear the AppID field in case it was a zero copy buffer,
-     * as it is no longer owned by that app after broadcasting */
-    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    for (i = 0; i < NumDeliveries; i++)
+    {
+        DeliveryPtr = &Delivery[i];
+        PipeDscPtr  = DeliveryPtr->PipeDscPtr;
 
-    /* track the buffer as an in-transit message */
-    CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
+        --PipeDscPtr->PendingDeliveries;
+
+        if (DeliveryPtr->Status == OS_SUCCESS)
+        {
+            continue;
+        }
+
+        /* Undo the accounting done for this destination prior to the write */
+        DestPtr = CFE_SB_GetDestPtr(RouteId, DeliveryPtr->PipeId);
+        if (DestPtr != NULL)
+        {
+            if (DestPtr->BuffCount > 0)
+            {
+                DestPtr->BuffCount--;
+            }
+            if (DestPtr->DestCnt > 0)
+            {
+                DestPtr->DestCnt--;
+            }
+        }
+
+        if (PipeDscPtr->CurrentQueueDepth > 0)
+        {
+            --PipeDscPtr->CurrentQueueDepth;
+        }
+        PipeDscPtr->SendErrors++;
+
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+
+        SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId = DeliveryPtr->PipeId;
+        if (DeliveryPtr->Status == OS_QUEUE_FULL)
+        {
+            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
+            CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
+        }
+        else
+        {
+            /* Unexpected error while writing to queue. */
+            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_WR_ERR_EID;
+            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].ErrStat = DeliveryPtr->Status;
+            CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
+        } /*end if */
+        SBSndErr.EvtsToSnd++;
+    }
+
+    /*
+     * If any specific delivery issues occured, also increment the
+     * general error count before releasing the lock.
+     */
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+    }
 
     /*
     ** Decrement the buffer UseCount and free buffer if cnt=0. This decrement is done
@@ -1700,7 +1901,10 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     ** done to ensure the buffer gets released when there are destinations that have
     ** been disabled via ground command.
     */
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
+    if (!IsPersistent)
+    {
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+    }
 
     /* release the semaphore */
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1722,7 +1926,7 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
 
                 /* clear the bit so the task may send this event again */
@@ -1743,7 +1947,7 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
 
                 /* clear the bit so the task may send this event again */
@@ -1761,7 +1965,7 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
 
                 CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat 0x%x",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId), PipeName,
                                            CFE_SB_GetAppTskName(TskId, FullName),
                                            (unsigned int)SBSndErr.EvtBuf[i].ErrStat);
 
@@ -1777,10 +1981,23 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
  * Function: CFE_SB_ReceiveBuffer - See API and header file for details
  */
 int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    uint32 Count;
+
+    /* A single receive is just a batch of one */
+    return CFE_SB_ReceiveBufferBatch(BufPtr, 1, &Count, PipeId, TimeOut);
+}
+
+/*
+ * Function: CFE_SB_ReceiveBufferBatch - See API and header file for details
+ */
+int32 CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                CFE_SB_PipeId_t PipeId, int32 TimeOut)
 {
     int32                  Status;
     int32                  RcvStatus;
     CFE_SB_BufferD_t *     BufDscPtr;
+    CFE_SB_BufferD_t *     BufDscList[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
     size_t                 BufDscSize;
     CFE_SB_PipeD_t *       PipeDscPtr;
     CFE_SB_DestinationD_t *DestPtr;
@@ -1789,6 +2006,8 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
     uint16                 PendingEventID;
     osal_id_t              SysQueueId;
     int32                  SysTimeout;
+    uint32                 NumReceived;
+    uint32                 i;
     char                   FullName[(OS_MAX_API_NAME * 2)];
 
     PendingEventID = 0;
@@ -1800,6 +2019,7 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
     DestPtr        = NULL;
     BufDscSize     = 0;
     RcvStatus      = OS_SUCCESS;
+    NumReceived    = 0;
 
     /*
      * Check input args and see if any are bad, which require
@@ -1812,7 +2032,7 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
      * currently defined the same.
      */
 
-    if (BufPtr == NULL)
+    if (BufPtrArray == NULL || CountPtr == NULL || MaxCount == 0)
     {
         PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
         Status         = CFE_SB_BAD_ARGUMENT;
@@ -1833,6 +2053,11 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
         Status         = CFE_SB_BAD_ARGUMENT;
     }
 
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+    {
+        MaxCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    }
+
     /* If OK, then lock and pull relevent info from Pipe Descriptor */
     if (Status == CFE_SUCCESS)
     {
@@ -1852,36 +2077,34 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
             SysQueueId = PipeDscPtr->SysQueueId;
 
             /*
-             * Un-reference any previous buffer from the last call.
+             * Un-reference any previous buffer(s) from the last call.
              *
              * NOTE: This is historical behavior where apps call CFE_SB_ReceiveBuffer()
              * in the loop within the app's main task.  There is currently no separate
              * API to "free" or unreference a buffer that was returned from SB.
              *
              * Instead, each time this function is invoked, it is implicitly interpreted
-             * as an indication that the caller is done with the previous buffer.
+             * as an indication that the caller is done with the previous buffer(s).
              *
              * Unfortunately this prevents pipe IDs from being serviced/shared across
              * multiple child tasks in a worker pattern design.  This may be changed
              * in a future version of CFE to decouple these actions, to allow for
              * multiple workers to service the same pipe.
              */
-            if (PipeDscPtr->LastBuffer != NULL)
-            {
-                /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-                CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-                PipeDscPtr->LastBuffer = NULL;
-            }
+            CFE_SB_ReleasePipeLastBuffers(PipeDscPtr);
         }
 
         CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
     /*
-     * If everything validated, then proceed to get a buffer from the queue.
+     * If everything validated, then proceed to get buffer(s) from the queue.
      * This must be done OUTSIDE the SB lock, as this call likely blocks.
+     *
+     * Only the first read waits per the requested timeout.  After that, whatever
+     * is already waiting on the pipe is drained (without blocking) up to MaxCount.
      */
-    if (Status == CFE_SUCCESS)
+    while (Status == CFE_SUCCESS && NumReceived < MaxCount)
     {
         /* Read the buffer descriptor address from the queue.  */
         RcvStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
@@ -1894,7 +2117,14 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
          */
         if (RcvStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
         {
-            /* Pass through */
+            BufDscList[NumReceived] = BufDscPtr;
+            ++NumReceived;
+            SysTimeout = OS_CHECK;
+        }
+        else if (NumReceived > 0)
+        {
+            /* drained everything that was available; anything else will be seen next call */
+            break;
         }
         else if (RcvStatus == OS_QUEUE_EMPTY)
         {
@@ -1914,7 +2144,7 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
         }
     }
 
-    /* Now re-lock to store the buffer in the pipe descriptor */
+    /* Now re-lock to store the buffer(s) in the pipe descriptor */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
     if (Status == CFE_SUCCESS)
@@ -1924,53 +2154,76 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
          * Technically it is possible that the pipe was changed between now and then,
          * but the current PipeID definition doesn't really allow this to be detected.
          */
-        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
         {
-            /*
-            ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
-            ** ptr corresponding to the message just read. This is done so that
-            ** the buffer can be released on the next receive call for this pipe.
-            **
-            ** This counts as a new reference as it is being stored in the PipeDsc
-            */
-            CFE_SB_IncrBufUseCnt(BufDscPtr);
-            PipeDscPtr->LastBuffer = BufDscPtr;
-
-            /*
-             * Also set the Receivers pointer to the address of the actual message
-             * (currently this is "borrowing" the ref above, not its own ref)
-             */
-            *BufPtr = &BufDscPtr->Content;
+            /* should send the bad pipe ID event here too */
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
 
-            /* get pointer to destination to be used in decrementing msg limit cnt*/
-            RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
-            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+        for (i = 0; i < NumReceived; ++i)
+        {
+            BufDscPtr = BufDscList[i];
 
-            /*
-            ** DestPtr would be NULL if the msg is unsubscribed to while it is on
-            ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
-            ** then resubscribed to while it is on the pipe. Both of these cases are
-            ** considered nominal and are handled by the code below.
-            */
-            if (DestPtr != NULL && DestPtr->BuffCount > 0)
+            if (Status == CFE_SUCCESS)
             {
-                DestPtr->BuffCount--;
-            }
+                /*
+                ** Load the pipe tables 'LastBuffer' list with the buffer descriptor
+                ** ptr corresponding to the message just read. This is done so that
+                ** the buffer can be released on the next receive call for this pipe.
+                **
+                ** This counts as a new reference as it is being stored in the PipeDsc
+                */
+                CFE_SB_IncrBufUseCnt(BufDscPtr);
+                PipeDscPtr->LastBuffer[i] = BufDscPtr;
+
+                /*
+                 * Also set the Receivers pointer to the address of the actual message
+                 * (currently this is "borrowing" the ref above, not its own ref)
+                 */
+                BufPtrArray[i] = &BufDscPtr->Content;
+
+                /* get pointer to destination to be used in decrementing msg limit cnt*/
+                RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
+                DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+
+                /*
+                ** DestPtr would be NULL if the msg is unsubscribed to while it is on
+                ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
+                ** then resubscribed to while it is on the pipe. Both of these cases are
+                ** considered nominal and are handled by the code below.
+                */
+                if (DestPtr != NULL && DestPtr->BuffCount > 0)
+                {
+                    DestPtr->BuffCount--;
+                }
 
-            if (PipeDscPtr->CurrentQueueDepth > 0)
-            {
-                --PipeDscPtr->CurrentQueueDepth;
+                if (PipeDscPtr->CurrentQueueDepth > 0)
+                {
+                    --PipeDscPtr->CurrentQueueDepth;
+                }
             }
+
+            /* Always decrement the use count, for the ref that was in the queue */
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
         }
-        else
+
+        if (Status == CFE_SUCCESS)
         {
-            /* should send the bad pipe ID event here too */
-            PendingEventID = CFE_SB_BAD_PIPEID_EID;
-            Status         = CFE_SB_PIPE_RD_ERR;
+            PipeDscPtr->LastBufferCount = NumReceived;
         }
+    }
 
-        /* Always decrement the use count, for the ref that was in the queue */
-        CFE_SB_DecrBufUseCnt(BufDscPtr);
+    /*
+     * Once a pollable pipe is seen to be empty, return its event to the non-readable
+     * state.  This is done while locked so it cannot race with a delivery that has
+     * already counted itself in CurrentQueueDepth but not yet signalled.
+     */
+    if ((Status == CFE_SUCCESS || Status == CFE_SB_NO_MESSAGE || Status == CFE_SB_TIME_OUT) &&
+        CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) && OS_ObjectIdDefined(PipeDscPtr->PollEventId) &&
+        PipeDscPtr->CurrentQueueDepth == 0)
+    {
+        OS_SelectEventClear(PipeDscPtr->PollEventId);
     }
 
     /* Before unlocking, check the PendingEventID and increment relevant error counter */
@@ -2005,7 +2258,7 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
             case CFE_SB_RCV_BAD_ARG_EID:
                 CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
                                            "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %lu,t/o %d,app %s",
-                                           (unsigned long)BufPtr, CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
+                                           (unsigned long)BufPtrArray, CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
                                            CFE_SB_GetAppTskName(TskId, FullName));
                 break;
             case CFE_SB_BAD_PIPEID_EID:
@@ -2016,10 +2269,20 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
         }
     }
 
-    /* If not successful, set the output pointer to NULL */
-    if (Status != CFE_SUCCESS && BufPtr != NULL)
+    /* If not successful, set the output pointer to NULL and count to zero */
+    if (Status != CFE_SUCCESS)
+    {
+        if (BufPtrArray != NULL && MaxCount > 0)
+        {
+            BufPtrArray[0] = NULL;
+        }
+
+        NumReceived = 0;
+    }
+
+    if (CountPtr != NULL)
     {
-        *BufPtr = NULL;
+        *CountPtr = NumReceived;
     }
 
     return Status;
@@ -2128,6 +2391,12 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
 
     CFE_SB_LockSharedData(__func__, __LINE__);
 
+    if (Status == CFE_SUCCESS && BufDscPtr->Persistent)
+    {
+        /* publish ring buffers are only released by deleting the ring */
+        Status = CFE_SB_BUFFER_INVALID;
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /* Clear the ownership app ID and decrement use count (may also free) */
@@ -2193,3 +2462,193 @@ int32 CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount
 
     return Status;
 }
+
+/*
+ * Function: CFE_SB_CreatePublishRing - See API and header file for details
+ */
+CFE_Status_t CFE_SB_CreatePublishRing(CFE_SB_MsgId_t MsgId, size_t MsgSize, uint16 Depth)
+{
+    CFE_ES_AppId_t        AppId;
+    CFE_SB_PublishRing_t *RingPtr;
+    CFE_SB_BufferD_t *    BufDscPtr;
+    int32                 Status;
+    uint16                BufCount;
+    uint32                i;
+
+    if (!CFE_SB_IsValidMsgId(MsgId) || MsgSize == 0 || MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE || Depth == 0 ||
+        Depth > CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    RingPtr  = NULL;
+    BufCount = 0;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    if (CFE_SB_LocatePublishRing(MsgId) != NULL)
+    {
+        /* only one ring per message ID */
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /* find a free ring entry */
+        RingPtr = CFE_SB_Global.PublishRing;
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_PUBLISH_RINGS && CFE_RESOURCEID_TEST_DEFINED(RingPtr->AppId); ++i)
+        {
+            ++RingPtr;
+        }
+
+        if (i == CFE_PLATFORM_SB_MAX_PUBLISH_RINGS)
+        {
+            RingPtr = NULL;
+            Status  = CFE_SB_BUF_ALOC_ERR;
+        }
+    }
+
+    if (RingPtr != NULL)
+    {
+        /*
+         * Reserve the entry and allocate all buffers now.  The depth stays zero
+         * until the headers are initialized, so no buffer is handed out early.
+         */
+        RingPtr->AppId   = AppId;
+        RingPtr->MsgId   = MsgId;
+        RingPtr->NextBuf = 0;
+
+        while (BufCount < Depth)
+        {
+            BufDscPtr = CFE_SB_GetBufferFromPool(MsgSize);
+            if (BufDscPtr == NULL)
+            {
+                break;
+            }
+
+            /* The ring holds the initial reference of each buffer */
+            BufDscPtr->AppId       = AppId;
+            BufDscPtr->Persistent  = true;
+            RingPtr->Buf[BufCount] = BufDscPtr;
+            ++BufCount;
+        }
+
+        if (BufCount < Depth)
+        {
+            RingPtr->Depth = BufCount;
+            CFE_SB_FreePublishRing(RingPtr);
+            RingPtr = NULL;
+            Status  = CFE_SB_BUF_ALOC_ERR;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (RingPtr == NULL)
+    {
+        if (Status == CFE_SB_BUF_ALOC_ERR)
+        {
+            CFE_ES_WriteToSysLog("CFE_SB:CreatePublishRing-Failed for MsgId 0x%x, depth %u, size %lu\n",
+                                 (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Depth,
+                                 (unsigned long)MsgSize);
+        }
+        return Status;
+    }
+
+    /* Wipe each buffer and write the header once, it is reused for every transmit */
+    for (i = 0; i < Depth; ++i)
+    {
+        CFE_MSG_Init(&RingPtr->Buf[i]->Content.Msg, MsgId, MsgSize);
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    RingPtr->Depth = Depth;
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return CFE_SUCCESS;
+
+} /* end CFE_SB_CreatePublishRing */
+
+/*
+ * Function: CFE_SB_GetPublishBuffer - See API and header file for details
+ */
+CFE_SB_Buffer_t *CFE_SB_GetPublishBuffer(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_PublishRing_t *RingPtr;
+    CFE_SB_BufferD_t *    BufDscPtr;
+    uint16                Idx;
+    uint16                i;
+
+    BufDscPtr = NULL;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    RingPtr = CFE_SB_LocatePublishRing(MsgId);
+    if (RingPtr != NULL)
+    {
+        /*
+         * Take the next buffer in ring order that only the ring references,
+         * meaning every subscriber has released its last transmit.
+         */
+        Idx = RingPtr->NextBuf;
+        for (i = 0; i < RingPtr->Depth; ++i)
+        {
+            if (RingPtr->Buf[Idx]->UseCount == 1)
+            {
+                BufDscPtr        = RingPtr->Buf[Idx];
+                RingPtr->NextBuf = (Idx + 1) % RingPtr->Depth;
+                break;
+            }
+
+            Idx = (Idx + 1) % RingPtr->Depth;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (BufDscPtr == NULL)
+    {
+        return NULL;
+    }
+
+    return &BufDscPtr->Content;
+
+} /* end CFE_SB_GetPublishBuffer */
+
+/*
+ * Function: CFE_SB_DeletePublishRing - See API and header file for details
+ */
+CFE_Status_t CFE_SB_DeletePublishRing(CFE_SB_MsgId_t MsgId)
+{
+    CFE_ES_AppId_t        AppId;
+    CFE_SB_PublishRing_t *RingPtr;
+    int32                 Status;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    RingPtr = CFE_SB_LocatePublishRing(MsgId);
+    if (RingPtr == NULL || !CFE_RESOURCEID_TEST_EQUAL(RingPtr->AppId, AppId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        CFE_SB_FreePublishRing(RingPtr);
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+
+} /* end CFE_SB_DeletePublishRing */
@@ -82,6 +82,84 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
     Node->Next->Prev = Node;
 }
 
+/******************************************************************************
+**  Function:   CFE_SB_GetBufferCache()
+**
+**  Purpose:
+**    Get the cache of released buffers that an allocation of AllocSize is
+**    served from. CFE_SB_MemPoolDefSize is sorted largest first so the cache
+**    is the last entry whose block size holds AllocSize, found with a binary
+**    search instead of a walk over every block size.
+**
+**  Arguments:
+**    AllocSize          : Allocation size including the buffer descriptor.
+**
+**  Return:
+**    Pointer to the cache, or NULL if AllocSize exceeds the largest block size.
+*/
+CFE_SB_BufCache_t *CFE_SB_GetBufferCache(size_t AllocSize)
+{
+    uint16 Low;
+    uint16 High;
+    uint16 Mid;
+
+    if (AllocSize > CFE_SB_MemPoolDefSize[0])
+    {
+        return NULL;
+    }
+
+    Low  = 0;
+    High = CFE_PLATFORM_ES_POOL_MAX_BUCKETS - 1;
+    while (Low < High)
+    {
+        Mid = (Low + High + 1) / 2;
+        if (CFE_SB_MemPoolDefSize[Mid] >= AllocSize)
+        {
+            Low = Mid;
+        }
+        else
+        {
+            High = Mid - 1;
+        }
+    }
+
+    return &CFE_SB_Global.Mem.Cache[Low];
+
+} /* end CFE_SB_GetBufferCache */
+
+/******************************************************************************
+**  Function:   CFE_SB_FlushBufferCache()
+**
+**  Purpose:
+**    Return every cached buffer to the SB buffer pool.
+**
+**  Note:
+**    This must only be invoked while holding the SB global lock
+**
+**  Return:
+**    Number of buffers returned to the pool.
+*/
+uint32 CFE_SB_FlushBufferCache(void)
+{
+    uint32             FlushCount = 0;
+    uint16             i;
+    CFE_SB_BufCache_t *Cache;
+
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        Cache = &CFE_SB_Global.Mem.Cache[i];
+        while (Cache->Count > 0)
+        {
+            --Cache->Count;
+            CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, Cache->Buf[Cache->Count]);
+            ++FlushCount;
+        }
+    }
+
+    return FlushCount;
+
+} /* end CFE_SB_FlushBufferCache */
+
 /******************************************************************************
 **  Function:   CFE_SB_GetBufferFromPool()
 **
@@ -94,6 +172,11 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
 **  Note:
 **    This must only be invoked while holding the SB global lock
 **
+**    A buffer released to the cache for the same block size is reused before
+**    the pool is asked for one. If the pool is exhausted the cache is flushed
+**    and the pool is tried again since cached buffers of other block sizes
+**    may be holding the memory.
+**
 **  Arguments:
 **    MaxMsgSize         : Size of the buffer content area in bytes.
 **
@@ -104,18 +187,33 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
 
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 {
-    int32             stat1;
-    size_t            AllocSize;
-    CFE_SB_BufferD_t *bd = NULL;
+    int32              stat1;
+    size_t             AllocSize;
+    CFE_SB_BufferD_t * bd = NULL;
+    CFE_SB_BufCache_t *Cache;
 
     /* The allocation needs to include enough space for the descriptor object */
     AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&bd, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    Cache = CFE_SB_GetBufferCache(AllocSize);
+    if (Cache != NULL && Cache->Count > 0)
     {
-        return NULL;
+        --Cache->Count;
+        bd = Cache->Buf[Cache->Count];
+    }
+    else
+    {
+        /* Allocate a new buffer descriptor from the SB memory pool.*/
+        stat1 = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&bd, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        if (stat1 < 0 && CFE_SB_FlushBufferCache() > 0)
+        {
+            stat1 = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&bd, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        }
+
+        if (stat1 < 0)
+        {
+            return NULL;
+        }
     }
 
     /* increment the number of buffers in use and adjust the high water mark if needed */
@@ -157,6 +255,9 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 **  Note:
 **    This must only be invoked while holding the SB global lock
 **
+**    The buffer is kept in the cache for its block size when the cache has
+**    room. The statistics count it as released either way.
+**
 **  Arguments:
 **    bd     : Pointer to the buffer descriptor.
 **
@@ -165,14 +266,25 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 */
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 {
+    CFE_SB_BufCache_t *Cache;
+
     /* Remove from any tracking list (no effect if not in a list) */
     CFE_SB_TrackingListRemove(&bd->Link);
 
     --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
 
-    /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    Cache = CFE_SB_GetBufferCache(bd->AllocatedSize);
+    if (Cache != NULL && Cache->Count < CFE_PLATFORM_SB_BUF_CACHE_DEPTH)
+    {
+        Cache->Buf[Cache->Count] = bd;
+        ++Cache->Count;
+    }
+    else
+    {
+        /* finally give the buf descriptor back to the buf descriptor pool */
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    }
 
 } /* end CFE_SB_ReturnBufferToPool */
 
@@ -239,6 +351,102 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
 
 } /* end CFE_SB_DecrBufUseCnt */
 
+/******************************************************************************
+**  Function:   CFE_SB_ReleasePipeLastBuffers()
+**
+**  Purpose:
+**    This function releases the references the pipe descriptor holds on the
+**    buffer(s) returned by the last receive call on that pipe.
+**
+**  Note:
+**    This must only be invoked while holding the SB global lock
+**
+**  Arguments:
+**    pd : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_ReleasePipeLastBuffers(CFE_SB_PipeD_t *pd)
+{
+    uint16 i;
+
+    for (i = 0; i < pd->LastBufferCount; ++i)
+    {
+        CFE_SB_DecrBufUseCnt(pd->LastBuffer[i]);
+        pd->LastBuffer[i] = NULL;
+    }
+
+    pd->LastBufferCount = 0;
+
+} /* end CFE_SB_ReleasePipeLastBuffers */
+
+/******************************************************************************
+**  Function:   CFE_SB_LocatePublishRing()
+**
+**  Purpose:
+**    This function finds the publish ring that was created for a message ID.
+**
+**  Note:
+**    This must only be invoked while holding the SB global lock
+**
+**  Arguments:
+**    MsgId : Message ID of the ring
+**
+**  Return:
+**    Pointer to the ring, or NULL if there is no ring for MsgId
+*/
+CFE_SB_PublishRing_t *CFE_SB_LocatePublishRing(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_PublishRing_t *RingPtr;
+    uint32                i;
+
+    RingPtr = CFE_SB_Global.PublishRing;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PUBLISH_RINGS; ++i)
+    {
+        if (CFE_RESOURCEID_TEST_DEFINED(RingPtr->AppId) && CFE_SB_MsgId_Equal(RingPtr->MsgId, MsgId))
+        {
+            return RingPtr;
+        }
+        ++RingPtr;
+    }
+
+    return NULL;
+
+} /* end CFE_SB_LocatePublishRing */
+
+/******************************************************************************
+**  Function:   CFE_SB_FreePublishRing()
+**
+**  Purpose:
+**    This function drops the reference the ring holds on each of its buffers
+**    and frees the ring entry.  Buffers still queued to or held by a
+**    subscriber are returned to the pool when the subscriber releases them.
+**
+**  Note:
+**    This must only be invoked while holding the SB global lock
+**
+**  Arguments:
+**    RingPtr : Pointer to the ring
+**
+**  Return:
+**    None
+*/
+void CFE_SB_FreePublishRing(CFE_SB_PublishRing_t *RingPtr)
+{
+    uint16 i;
+
+    for (i = 0; i < RingPtr->Depth; ++i)
+    {
+        RingPtr->Buf[i]->Persistent = false;
+        RingPtr->Buf[i]->AppId      = CFE_ES_APPID_UNDEFINED;
+        CFE_SB_DecrBufUseCnt(RingPtr->Buf[i]);
+    }
+
+    memset(RingPtr, 0, sizeof(*RingPtr));
+
+} /* end CFE_SB_FreePublishRing */
+
 /******************************************************************************
 **  Function:   CFE_SB_GetDestinationBlk()
 **
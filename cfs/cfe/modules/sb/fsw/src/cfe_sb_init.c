@@ -34,6 +34,7 @@
 
 #include "cfe_sb_module_all.h"
 
+#include <stdio.h>
 #include <string.h>
 
 /*
@@ -65,7 +66,9 @@ const size_t CFE_SB_MemPoolDefSize[CFE_PLATFORM_ES_POOL_MAX_BUCKETS] = {
 int32 CFE_SB_EarlyInit(void)
 {
 
-    int32 Stat;
+    int32  Stat;
+    uint32 i;
+    char   MutexName[OS_MAX_API_NAME];
 
     /* Clear task global */
     memset(&CFE_SB_Global, 0, sizeof(CFE_SB_Global));
@@ -77,6 +80,17 @@ int32 CFE_SB_EarlyInit(void)
         return Stat;
     } /* end if */
 
+    for (i = 0; i < CFE_SB_ROUTE_ORDER_LOCKS; i++)
+    {
+        snprintf(MutexName, sizeof(MutexName), "CFE_SB_Order%u", (unsigned int)i);
+        Stat = OS_MutSemCreate(&CFE_SB_Global.RouteOrderMutexId[i], MutexName, 0);
+        if (Stat != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("SB route order mutex creation failed! RC=0x%08x\n", (unsigned int)Stat);
+            return Stat;
+        } /* end if */
+    }
+
     /* Initialize the state of susbcription reporting */
     CFE_SB_Global.SubscriptionReporting = CFE_SB_DISABLE;
 
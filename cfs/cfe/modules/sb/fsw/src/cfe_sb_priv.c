@@ -120,7 +120,8 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
         CFE_SB_DeletePipeWithAppId(DelList[i], AppId);
     }
 
-    /* Release any zero copy buffers */
+    /* Release any publish rings and zero copy buffers */
+    CFE_SB_PublishRingReleaseAppId(AppId);
     CFE_SB_ZeroCopyReleaseAppId(AppId);
 
     return CFE_SUCCESS;
@@ -197,6 +198,63 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
 
 } /* end CFE_SB_UnlockSharedData */
 
+/******************************************************************************
+**  Function:  CFE_SB_LockRouteOrder()
+**
+**  Purpose:
+**    SB internal function to serialize the sends on a route, from assigning
+**    the sequence count to writing the pipe queues.  This keeps the messages
+**    of one MsgId in order on every pipe while the queue writes are done
+**    outside the Shared Data Mutex.  Routes share the ordering mutexes by hash.
+**
+**    This must be taken before the Shared Data Mutex, never while holding it.
+**
+**  Arguments:
+**    RouteId - the route being sent to
+**
+**  Return:
+**    None
+*/
+void CFE_SB_LockRouteOrder(CFE_SBR_RouteId_t RouteId)
+{
+    int32 Status;
+
+    Status = OS_MutSemTake(
+        CFE_SB_Global.RouteOrderMutexId[CFE_SBR_RouteIdToValue(RouteId) % CFE_SB_ROUTE_ORDER_LOCKS]);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SB RouteOrder Mutex Take Err Stat=0x%x,Route=%lu\n", (unsigned int)Status,
+                             (unsigned long)CFE_SBR_RouteIdToValue(RouteId));
+    } /* end if */
+
+} /* end CFE_SB_LockRouteOrder */
+
+/******************************************************************************
+**  Function:  CFE_SB_UnlockRouteOrder()
+**
+**  Purpose:
+**    SB internal function to release the ordering mutex of a route
+**
+**  Arguments:
+**    RouteId - the route being sent to
+**
+**  Return:
+**    None
+*/
+void CFE_SB_UnlockRouteOrder(CFE_SBR_RouteId_t RouteId)
+{
+    int32 Status;
+
+    Status = OS_MutSemGive(
+        CFE_SB_Global.RouteOrderMutexId[CFE_SBR_RouteIdToValue(RouteId) % CFE_SB_ROUTE_ORDER_LOCKS]);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SB RouteOrder Mutex Give Err Stat=0x%x,Route=%lu\n", (unsigned int)Status,
+                             (unsigned long)CFE_SBR_RouteIdToValue(RouteId));
+    } /* end if */
+
+} /* end CFE_SB_UnlockRouteOrder */
+
 /******************************************************************************
  * SB private function to get destination pointer - see description in header
  */
@@ -559,4 +617,50 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
 
 } /* end CFE_SB_ZeroCopyReleaseAppId */
 
+/******************************************************************************
+** Name:    CFE_SB_PublishRingReleaseAppId
+**
+** Purpose: API used for releasing all publish rings owned by a specific
+**          Application. This function is used for cleaning up when an
+**          application is deleted or crashes.
+**
+** Assumptions, External Events, and Notes:
+**          Buffers still held by subscribers are freed when released.
+**
+** Input Arguments:
+**          AppId
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32 CFE_SB_PublishRingReleaseAppId(CFE_ES_AppId_t AppId)
+{
+    CFE_SB_PublishRing_t *RingPtr;
+    uint32                i;
+
+    if (CFE_RESOURCEID_TEST_DEFINED(AppId))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        RingPtr = CFE_SB_Global.PublishRing;
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_PUBLISH_RINGS; ++i)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(RingPtr->AppId, AppId))
+            {
+                CFE_SB_FreePublishRing(RingPtr);
+            }
+            ++RingPtr;
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return CFE_SUCCESS;
+
+} /* end CFE_SB_PublishRingReleaseAppId */
+
 /*****************************************************************************/
@@ -80,9 +80,11 @@
 #define CFE_SB_INCREMENT_TLM    1
 
 #define CFE_SB_MAIN_LOOP_ERR_DLY             1000
+#define CFE_SB_PIPE_DRAIN_DLY                1
 #define CFE_SB_CMD_PIPE_DEPTH                32
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
+#define CFE_SB_ROUTE_ORDER_LOCKS             8 /* routes are hashed onto this many ordering mutexes */
 
 #define CFE_SB_PIPE_OVERFLOW (-1)
 #define CFE_SB_PIPE_WR_ERR   (-2)
@@ -155,6 +157,8 @@ typedef struct CFE_SB_BufferD
 
     uint16 UseCount; /**< Number of active references to this buffer in the system */
 
+    bool Persistent; /**< Buffer belongs to a publish ring, which keeps its reference across transmits */
+
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 
 } CFE_SB_BufferD_t;
@@ -174,13 +178,51 @@ typedef struct
     uint8             Spare;
     CFE_ES_AppId_t    AppId;
     osal_id_t         SysQueueId;
+    osal_id_t         PollEventId; /**< OSAL event signalled while non-empty, if CFE_SB_PIPEOPTS_POLLABLE */
     uint16            SendErrors;
     uint16            MaxQueueDepth;
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
-    CFE_SB_BufferD_t *LastBuffer;
+    uint16            PendingDeliveries; /**< Queue writes in progress outside the SB lock */
+    uint16            LastBufferCount; /**< Number of valid entries in LastBuffer */
+    CFE_SB_BufferD_t *LastBuffer[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH]; /**< Buffers returned by the last receive */
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_BufCache_t
+**
+**  Purpose:
+**     Released message buffers of one SB pool block size that are kept for
+**     reuse instead of being returned to the pool.
+*/
+typedef struct
+{
+
+    uint16            Count;
+    CFE_SB_BufferD_t *Buf[CFE_PLATFORM_SB_BUF_CACHE_DEPTH];
+
+} CFE_SB_BufCache_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_PublishRing_t
+**
+**  Purpose:
+**     A set of message buffers preallocated by one application for one
+**     Message ID.  The ring holds one reference on each buffer, so a buffer
+**     is free for reuse when its use count is 1.  The entry is unused when
+**     AppId is undefined.
+*/
+typedef struct
+{
+
+    CFE_ES_AppId_t    AppId;
+    CFE_SB_MsgId_t    MsgId;
+    uint16            Depth;
+    uint16            NextBuf;
+    CFE_SB_BufferD_t *Buf[CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH];
+
+} CFE_SB_PublishRing_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
@@ -193,6 +235,8 @@ typedef struct
     CFE_ES_MemHandle_t PoolHdl;
     CFE_ES_STATIC_POOL_TYPE(CFE_PLATFORM_SB_BUF_MEMORY_BYTES) Partition;
 
+    CFE_SB_BufCache_t Cache[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /* Indexed like CFE_SB_MemPoolDefSize */
+
 } CFE_SB_MemParams_t;
 
 /*******************************************************************************/
@@ -240,6 +284,7 @@ typedef struct
 typedef struct
 {
     osal_id_t                    SharedDataMutexId;
+    osal_id_t                    RouteOrderMutexId[CFE_SB_ROUTE_ORDER_LOCKS];
     uint32                       SubscriptionReporting;
     CFE_ES_AppId_t               AppId;
     uint32                       StopRecurseFlags[OS_MAX_TASKS];
@@ -261,6 +306,9 @@ typedef struct
     /* A list of buffers currently issued to apps for zero-copy */
     CFE_SB_BufferLink_t ZeroCopyList;
 
+    /* Persistent publish buffer rings */
+    CFE_SB_PublishRing_t PublishRing[CFE_PLATFORM_SB_MAX_PUBLISH_RINGS];
+
 } CFE_SB_Global_t;
 
 /******************************************************************************
@@ -288,6 +336,22 @@ typedef struct
     CFE_SB_SendErrEventBuf_t EvtBuf[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
 } CFE_SB_EventBuf_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_DeliveryEntry_t
+**
+**  Purpose:
+**     This structure is used to store a queue write that is performed
+**     outside the SB lock during a send.
+*/
+typedef struct
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    CFE_SB_PipeId_t PipeId;
+    osal_id_t       SysQueueId;
+    osal_id_t       PollEventId; /**< Event to signal after the write, if the pipe was empty */
+    int32           Status;
+} CFE_SB_DeliveryEntry_t;
+
 /*
 ** Software Bus Function Prototypes
 */
@@ -299,6 +363,8 @@ void  CFE_SB_InitIdxStack(void);
 void  CFE_SB_ResetCounts(void);
 void  CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber);
 void  CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
+void  CFE_SB_LockRouteOrder(CFE_SBR_RouteId_t RouteId);
+void  CFE_SB_UnlockRouteOrder(CFE_SBR_RouteId_t RouteId);
 void  CFE_SB_ReleaseBuffer(CFE_SB_BufferD_t *bd, CFE_SB_DestinationD_t *dest);
 int32 CFE_SB_WriteQueue(CFE_SB_PipeD_t *pd, uint32 TskId, const CFE_SB_BufferD_t *bd, CFE_SB_MsgId_t MsgId);
 void  CFE_SB_ProcessCmdPipePkt(CFE_SB_Buffer_t *SBBufPtr);
@@ -316,6 +382,7 @@ int32  CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint
 int32  CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr,
                                   CFE_SBR_RouteId_t *RouteIdPtr);
 int32  CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
+int32  CFE_SB_PublishRingReleaseAppId(CFE_ES_AppId_t AppId);
 void   CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd);
 void   CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd);
 int32  CFE_SB_ValidateMsgId(CFE_SB_MsgId_t MsgId);
@@ -371,6 +438,11 @@ void CFE_SB_TrackingListRemove(CFE_SB_BufferLink_t *Node);
  */
 void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node);
 
+/**
+ * \brief SB memory pool block sizes, largest first
+ */
+extern const size_t CFE_SB_MemPoolDefSize[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
 /**
  * \brief Allocates a new buffer descriptor from the SB memory pool.
  *
@@ -386,6 +458,60 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
  */
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 
+/**
+ * \brief Finds the publish ring for a message ID
+ *
+ * \note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] MsgId Message ID of the ring
+ * \returns Pointer to the ring, or NULL if no ring exists for MsgId
+ */
+CFE_SB_PublishRing_t *CFE_SB_LocatePublishRing(CFE_SB_MsgId_t MsgId);
+
+/**
+ * \brief Releases the buffers of a publish ring and frees the ring entry
+ *
+ * Each buffer is returned to the pool now, or when the last subscriber
+ * releases it.
+ *
+ * \note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] RingPtr Pointer to the ring
+ */
+void CFE_SB_FreePublishRing(CFE_SB_PublishRing_t *RingPtr);
+
+/**
+ * \brief Gets the buffer cache for an allocation size
+ *
+ * The caches are indexed like #CFE_SB_MemPoolDefSize so a cached buffer came
+ * from the same pool block size that a new allocation of AllocSize would get.
+ *
+ * \param[in] AllocSize Allocation size including the buffer descriptor
+ * \returns Pointer to the cache, or NULL if AllocSize exceeds the largest block size
+ */
+CFE_SB_BufCache_t *CFE_SB_GetBufferCache(size_t AllocSize);
+
+/**
+ * \brief Returns all cached buffers to the SB memory pool
+ *
+ * \note This must only be invoked while holding the SB global lock
+ *
+ * \returns Number of buffers returned to the pool
+ */
+uint32 CFE_SB_FlushBufferCache(void);
+
+/**
+ * \brief Releases the buffer(s) returned by the last receive on a pipe
+ *
+ * Decrements the use count of every buffer held in the pipe descriptor's
+ * LastBuffer list and empties the list.
+ *
+ * \note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] pd Pointer to the pipe descriptor
+ */
+void CFE_SB_ReleasePipeLastBuffers(CFE_SB_PipeD_t *pd);
+
 /**
  * \brief Broadcast a SB buffer descriptor to all destinations in route
  *
@@ -404,6 +530,12 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  *  - For any undeliverable destination (limit, OSAL error, etc), a proper event is generated.
  *  - For any successful queueing, the buffer use count is incremented
  *
+ * The destinations are selected, and the buffer references and pipe depth accounting
+ * for them are reserved, while holding the SB global lock.  The actual queue writes
+ * are then done with the lock released, so that tasks sending different messages do
+ * not serialize on each other's queue writes.  Any write that fails is backed out
+ * once the lock is re-acquired.
+ *
  * The caller is expected to hold a reference (use count) of the buffer prior to invoking
  * this routine, representing itself, which is then consumed by this routine.
  *
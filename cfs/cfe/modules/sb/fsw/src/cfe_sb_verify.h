@@ -50,6 +50,14 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH < 1
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH > 0xFFFF
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be greater than 0xFFFF!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -66,6 +74,24 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH < 1
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be less than 1!
+#elif CFE_PLATFORM_SB_BUF_CACHE_DEPTH > 64
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be greater than 64!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_PUBLISH_RINGS < 1
+#error CFE_PLATFORM_SB_MAX_PUBLISH_RINGS cannot be less than 1!
+#elif CFE_PLATFORM_SB_MAX_PUBLISH_RINGS > 1024
+#error CFE_PLATFORM_SB_MAX_PUBLISH_RINGS cannot be greater than 1024!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH < 1
+#error CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH cannot be less than 1!
+#elif CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH > 64
+#error CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH cannot be greater than 64!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
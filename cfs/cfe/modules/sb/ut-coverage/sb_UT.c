@@ -1508,6 +1508,7 @@ void Test_SB_Cmds_UnexpMsgId(void)
 void Test_SB_EarlyInit(void)
 {
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_SemCreateError);
+    SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_OrderSemCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_PoolCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_NoErrors);
 } /* end Test_SB_EarlyInit */
@@ -1522,6 +1523,16 @@ void Test_SB_EarlyInit_SemCreateError(void)
               "Sem Create error logic");
 } /* end Test_SB_EarlyInit_SemCreateError */
 
+/*
+** Test early initialization response to a route order semaphore create failure
+*/
+void Test_SB_EarlyInit_OrderSemCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERR_NO_FREE_IDS);
+    UT_Report(__FILE__, __LINE__, CFE_SB_EarlyInit() == OS_ERR_NO_FREE_IDS, "CFE_SB_EarlyInit",
+              "Route order sem create error logic");
+} /* end Test_SB_EarlyInit_OrderSemCreateError */
+
 /*
 ** Test early initialization response to a pool create ex failure
 */
@@ -1551,6 +1562,8 @@ void Test_CreatePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_CreatePipe_InvalPipeDepth);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_MaxPipes);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_SamePipeName);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_Pollable);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_PollableErr);
 } /* end Test_CreatePipe_API */
 
 /*
@@ -1691,6 +1704,78 @@ void Test_CreatePipe_SamePipeName(void)
     TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test a pollable pipe signals its event when it goes non-empty and clears it once drained
+*/
+void Test_CreatePipe_Pollable(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    osal_id_t        PollId;
+    uint8            Opts;
+
+    SETUP(CFE_SB_CreatePipeEx(&PipeId, 4, "TestPipe", CFE_SB_PIPEOPTS_POLLABLE));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_SelectEventCreate)), 1);
+
+    ASSERT(CFE_SB_GetPipePollId(PipeId, &PollId));
+    ASSERT_TRUE(OS_ObjectIdDefined(PollId));
+
+    /* The option cannot be removed after creation */
+    SETUP(CFE_SB_SetPipeOpts(PipeId, 0));
+    SETUP(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    ASSERT_EQ(Opts, CFE_SB_PIPEOPTS_POLLABLE);
+
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* Only the delivery to an empty pipe signals */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_SelectEventSignal)), 1);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_SelectEventSignal)), 1);
+
+    /* Receiving the last message clears the event */
+    ASSERT(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_SelectEventClear)), 0);
+    ASSERT(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_SelectEventClear)), 1);
+
+    /* A spurious wakeup is cleared by a receive that finds nothing */
+    ASSERT_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_SelectEventClear)), 2);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_close)), 1);
+
+} /* end Test_CreatePipe_Pollable */
+
+/*
+** Test create pipe response when the pollable event cannot be created
+*/
+void Test_CreatePipe_PollableErr(void)
+{
+    CFE_SB_PipeId_t PipeId = CFE_SB_INVALID_PIPE;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectEventCreate), 1, OS_ERR_NOT_IMPLEMENTED);
+
+    ASSERT_EQ(CFE_SB_CreatePipeEx(&PipeId, 4, "TestPipe", CFE_SB_PIPEOPTS_POLLABLE), CFE_SB_PIPE_CR_ERR);
+    ASSERT_TRUE(!CFE_RESOURCEID_TEST_DEFINED(PipeId));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueDelete)), 1);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.PipesInUse, 0);
+
+    EVTSENT(CFE_SB_CR_PIPE_POLL_ERR_EID);
+
+} /* end Test_CreatePipe_PollableErr */
+
 /*
 ** Function for calling SB delete pipe API test functions
 */
@@ -1701,6 +1786,7 @@ void Test_DeletePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_DeletePipe_InvalidPipeId);
     SB_UT_ADD_SUBTEST(Test_DeletePipe_InvalidPipeOwner);
     SB_UT_ADD_SUBTEST(Test_DeletePipe_WithAppid);
+    SB_UT_ADD_SUBTEST(Test_DeletePipe_PendingDelivery);
 } /* end Test_DeletePipe_API */
 
 /*
@@ -1814,6 +1900,42 @@ void Test_DeletePipe_WithAppid(void)
 
 } /* end Test_DeletePipe_WithAppid */
 
+/* Hook to complete a simulated in-progress delivery while the delete waits for it */
+static int32 UT_CompletePendingDelivery(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    CFE_SB_PipeD_t *PipeDscPtr = UserObj;
+
+    PipeDscPtr->PendingDeliveries = 0;
+
+    return StubRetcode;
+}
+
+/*
+** Test pipe delete waits for a queue write done outside the SB lock
+*/
+void Test_DeletePipe_PendingDelivery(void)
+{
+    CFE_SB_PipeId_t PipedId;
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint16          PipeDepth = 10;
+
+    SETUP(CFE_SB_CreatePipe(&PipedId, PipeDepth, "TestPipe"));
+
+    /* Simulate a broadcast that has selected this pipe but not yet written to it */
+    PipeDscPtr                    = CFE_SB_LocatePipeDescByID(PipedId);
+    PipeDscPtr->PendingDeliveries = 1;
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_CompletePendingDelivery, PipeDscPtr);
+
+    ASSERT(CFE_SB_DeletePipe(PipedId));
+
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 1);
+
+    EVTSENT(CFE_SB_PIPE_DELETED_EID);
+
+} /* end Test_DeletePipe_PendingDelivery */
+
 /*
 ** Function for calling SB set pipe opts API test functions
 */
@@ -1825,6 +1947,7 @@ void Test_PipeOpts_API(void)
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadID);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadPtr);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts);
+    SB_UT_ADD_SUBTEST(Test_GetPipePollId_Errors);
 } /* end Test_PipeOpts_API */
 
 /*
@@ -2058,6 +2181,24 @@ void Test_GetPipeOpts(void)
 
 } /* end Test_GetPipeOpts */
 
+/*
+** Try getting the poll ID with a bad pointer, bad pipe ID and non-pollable pipe
+*/
+void Test_GetPipePollId_Errors(void)
+{
+    CFE_SB_PipeId_t PipeID;
+    osal_id_t       PollId;
+
+    SETUP(CFE_SB_CreatePipe(&PipeID, 4, "TestPipe1"));
+
+    ASSERT_EQ(CFE_SB_GetPipePollId(PipeID, NULL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetPipePollId(SB_UT_ALTERNATE_INVALID_PIPEID, &PollId), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_GetPipePollId(PipeID, &PollId), CFE_SB_BAD_ARGUMENT);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeID));
+
+} /* end Test_GetPipePollId_Errors */
+
 /*
 ** Function for calling SB subscribe API test functions
 */
@@ -2739,6 +2880,8 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_NoSubscribers);
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_PublishRing_CreateDelete);
+    SB_UT_ADD_SUBTEST(Test_PublishRing_Transmit);
 } /* end Test_TransmitMsg_API */
 
 /*
@@ -2902,6 +3045,7 @@ void Test_TransmitMsg_SequenceCount(void)
 void Test_TransmitMsg_QueuePutError(void)
 {
     CFE_SB_PipeId_t  PipeId4Error;
+    CFE_SB_PipeD_t * PipeDscPtr;
     CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
     SB_UT_Test_Tlm_t TlmPkt;
     int32            PipeDepth = 2;
@@ -2921,6 +3065,13 @@ void Test_TransmitMsg_QueuePutError(void)
 
     EVTSENT(CFE_SB_Q_WR_ERR_EID);
 
+    /* The failed write must be fully backed out */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId4Error);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_UINT32_EQ(PipeDscPtr->PendingDeliveries, 0);
+    UtAssert_UINT32_EQ(PipeDscPtr->SendErrors, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
     TEARDOWN(CFE_SB_DeletePipe(PipeId4Error));
 
 } /* end Test_TransmitMsg_QueuePutError */
@@ -3237,6 +3388,144 @@ void Test_ReleaseMessageBuffer(void)
 
 } /* end Test_TransmitMsg_ZeroCopyReleasePtr */
 
+/*
+** Test creating and deleting persistent publish rings
+*/
+void Test_PublishRing_CreateDelete(void)
+{
+    CFE_SB_MsgId_t MsgId = SB_UT_TLM_MID;
+    CFE_ES_AppId_t AppID;
+    CFE_ES_AppId_t AppID2;
+    uint32         InitCount;
+    uint16         i;
+
+    CFE_ES_GetAppID(&AppID);
+    AppID2 = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2));
+
+    /* Bad arguments */
+    ASSERT_EQ(CFE_SB_CreatePublishRing(CFE_SB_INVALID_MSG_ID, 10, 2), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, 0, 2), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1, 2), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, 10, 0), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, 10, CFE_PLATFORM_SB_MAX_PUBLISH_RING_DEPTH + 1), CFE_SB_BAD_ARGUMENT);
+    ASSERT_TRUE(CFE_SB_GetPublishBuffer(MsgId) == NULL);
+
+    /* No app ID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, 10, 2), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    ASSERT_EQ(CFE_SB_DeletePublishRing(MsgId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Pool allocation failure frees the buffers already allocated */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, 10, 2), CFE_SB_BUF_ALOC_ERR);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_TRUE(CFE_SB_LocatePublishRing(MsgId) == NULL);
+
+    /* Nominal, the buffers stay allocated to the ring and are initialized once */
+    InitCount = UT_GetStubCount(UT_KEY(CFE_MSG_Init));
+    ASSERT(CFE_SB_CreatePublishRing(MsgId, 10, 2));
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 2);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_Init)), InitCount + 2);
+    ASSERT_EQ(CFE_SB_CreatePublishRing(MsgId, 10, 2), CFE_SB_BAD_ARGUMENT);
+
+    /* Only the owner may delete the ring */
+    UT_SetAppID(AppID2);
+    ASSERT_EQ(CFE_SB_DeletePublishRing(MsgId), CFE_SB_BAD_ARGUMENT);
+    UT_SetAppID(AppID);
+    ASSERT(CFE_SB_DeletePublishRing(MsgId));
+    ASSERT_EQ(CFE_SB_DeletePublishRing(MsgId), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    /* Ring table full */
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PUBLISH_RINGS; ++i)
+    {
+        SETUP(CFE_SB_CreatePublishRing(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + i), 10, 1));
+    }
+    ASSERT_EQ(CFE_SB_CreatePublishRing(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + i), 10, 1),
+              CFE_SB_BUF_ALOC_ERR);
+
+    /* Rings are released with the owning app */
+    CFE_SB_CleanUpApp(AppID2);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, CFE_PLATFORM_SB_MAX_PUBLISH_RINGS);
+    CFE_SB_CleanUpApp(AppID);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_TRUE(CFE_SB_LocatePublishRing(MsgId) == NULL);
+
+    EVTCNT(0);
+
+} /* end Test_PublishRing_CreateDelete */
+
+/*
+** Test publishing from a persistent publish ring
+*/
+void Test_PublishRing_Transmit(void)
+{
+    CFE_SB_Buffer_t *       SendPtr1;
+    CFE_SB_Buffer_t *       SendPtr2;
+    CFE_SB_Buffer_t *       ReceivePtr = NULL;
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    CFE_MSG_SequenceCount_t SeqCnt;
+    CFE_MSG_Size_t          Size = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+
+    UT_SetHookFunction(UT_KEY(CFE_MSG_SetSequenceCount), UT_CheckSetSequenceCount, &SeqCnt);
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RingTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_CreatePublishRing(MsgId, sizeof(SB_UT_Test_Tlm_t), 2));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 3);
+
+    /* Publish both buffers, the ring is then exhausted */
+    SendPtr1 = CFE_SB_GetPublishBuffer(MsgId);
+    ASSERT_TRUE(SendPtr1 != NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitBuffer(SendPtr1, true));
+    ASSERT_EQ(SeqCnt, 1);
+
+    SendPtr2 = CFE_SB_GetPublishBuffer(MsgId);
+    ASSERT_TRUE(SendPtr2 != NULL && SendPtr2 != SendPtr1);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitBuffer(SendPtr2, true));
+    ASSERT_EQ(SeqCnt, 2);
+
+    ASSERT_TRUE(CFE_SB_GetPublishBuffer(MsgId) == NULL);
+
+    /* Ring buffers cannot be released as ordinary zero copy buffers */
+    ASSERT_EQ(CFE_SB_ReleaseMessageBuffer(SendPtr1), CFE_SB_BUFFER_INVALID);
+
+    /* The first buffer is free again once the subscriber has moved past it */
+    ASSERT(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    ASSERT_TRUE(ReceivePtr == SendPtr1);
+    ASSERT_TRUE(CFE_SB_GetPublishBuffer(MsgId) == NULL);
+    ASSERT(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    ASSERT_TRUE(ReceivePtr == SendPtr2);
+    ASSERT_TRUE(CFE_SB_GetPublishBuffer(MsgId) == SendPtr1);
+
+    /* Steady state publishing does not touch the pool */
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 3);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    /* Deleting the ring while a subscriber holds a buffer defers its release */
+    ASSERT(CFE_SB_DeletePublishRing(MsgId));
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    EVTCNT(3);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    EVTSENT(CFE_SB_PIPE_DELETED_EID);
+
+} /* end Test_PublishRing_Transmit */
+
 /*
 ** Test send message response with the destination disabled
 */
@@ -3365,6 +3654,10 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_Poll);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_MultipleMsgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_MaxCount);
 } /* end Test_ReceiveBuffer_API */
 
 /*
@@ -3541,20 +3834,21 @@ void Test_CleanupApp_API(void)
     CFE_SB_CleanUpApp(CFE_ES_APPID_UNDEFINED);
 
     /* This should have freed no buffers  */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
 
     /* Attempt again with a valid application ID */
     CFE_SB_CleanUpApp(AppID);
 
     /* This should have freed 2 out of the 3 buffers -
      * the ones which were gotten by this app. */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
 
     /* Clean up the second App */
     CFE_SB_CleanUpApp(AppID2);
 
-    /* This should have freed the last buffer */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    /* This should have freed the last buffer, released buffers are cached */
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
 
     EVTCNT(2);
 
@@ -3584,6 +3878,158 @@ void Test_ReceiveBuffer_InvalidBufferPtr(void)
 
 } /* end Test_ReceiveBuffer_InvalidBufferPtr */
 
+/*
+** Test receiving a batch of messages with invalid arguments
+*/
+void Test_ReceiveBufferBatch_InvalidArgs(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[2];
+    CFE_SB_PipeId_t  PipeId;
+    uint32           PipeDepth = 10;
+    uint32           Count;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+
+    ASSERT_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 2, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 0, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    Count = 1;
+    ASSERT_EQ(CFE_SB_ReceiveBufferBatch(NULL, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    Count = 1;
+    ASSERT_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 2, &Count, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_POLL),
+              CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    ASSERT_TRUE(SBBufPtrs[0] == NULL);
+
+    EVTCNT(5);
+
+    EVTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    EVTSENT(CFE_SB_BAD_PIPEID_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBufferBatch_InvalidArgs */
+
+/*
+** Test receiving a batch of messages when there is no message on the queue
+*/
+void Test_ReceiveBufferBatch_Poll(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[2];
+    CFE_SB_PipeId_t  PipeId;
+    uint32           PipeDepth = 10;
+    uint32           Count     = 1;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+
+    ASSERT_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    EVTCNT(1);
+
+    EVTSENT(CFE_SB_PIPE_ADDED_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBufferBatch_Poll */
+
+/*
+** Test receiving all waiting messages in a single batch
+*/
+void Test_ReceiveBufferBatch_MultipleMsgs(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth = 10;
+    uint32           Count;
+    uint32           i;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    for (i = 0; i < 3; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        SETUP(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    }
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+
+    /* Request more than is waiting: all three are returned without blocking */
+    ASSERT(CFE_SB_ReceiveBufferBatch(SBBufPtrs, CFE_PLATFORM_SB_MAX_RECEIVE_BATCH, &Count, PipeId,
+                                     CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 3);
+    ASSERT_TRUE(SBBufPtrs[0] != NULL && SBBufPtrs[1] != NULL && SBBufPtrs[2] != NULL);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBufferCount, 3);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
+
+    /* The next call releases the whole previous batch */
+    ASSERT_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, CFE_PLATFORM_SB_MAX_RECEIVE_BATCH, &Count, PipeId, CFE_SB_POLL),
+              CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 0);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBufferCount, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    EVTCNT(2);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBufferBatch_MultipleMsgs */
+
+/*
+** Test that a batch receive never returns more than the requested count
+*/
+void Test_ReceiveBufferBatch_MaxCount(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[2];
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth = 10;
+    uint32           Count;
+    uint32           i;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    for (i = 0; i < 3; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        SETUP(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    }
+
+    ASSERT(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 2, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 2);
+
+    ASSERT(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 2, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+
+    /* Deleting the pipe releases the buffer still held from the last batch */
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    EVTCNT(3);
+
+    EVTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+
+} /* end Test_ReceiveBufferBatch_MaxCount */
+
 /*
 ** Test SB Utility APIs
 */
@@ -3771,6 +4217,7 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_ReqToSendEvent_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_PutDestBlk_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_BufferCache);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_Nominal);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_LimitErr);
@@ -3885,6 +4332,73 @@ void Test_CFE_SB_Buffers(void)
 
 } /* end Test_CFE_SB_Buffers */
 
+/*
+** Test reuse of released buffers from the SB buffer cache
+*/
+void Test_CFE_SB_BufferCache(void)
+{
+    CFE_SB_BufferD_t * bd;
+    CFE_SB_BufferD_t * bd2;
+    CFE_SB_BufferD_t * bdList[CFE_PLATFORM_SB_BUF_CACHE_DEPTH + 1];
+    CFE_SB_BufCache_t *Cache;
+    uint16             i;
+
+    /* Cache lookup follows the pool block sizes */
+    ASSERT_TRUE(CFE_SB_GetBufferCache(CFE_SB_MemPoolDefSize[0] + 1) == NULL);
+    ASSERT_TRUE(CFE_SB_GetBufferCache(CFE_SB_MemPoolDefSize[0]) == &CFE_SB_Global.Mem.Cache[0]);
+    ASSERT_TRUE(CFE_SB_GetBufferCache(CFE_PLATFORM_SB_MEM_BLOCK_SIZE_01) ==
+                &CFE_SB_Global.Mem.Cache[CFE_PLATFORM_ES_POOL_MAX_BUCKETS - 1]);
+    ASSERT_TRUE(CFE_SB_GetBufferCache(CFE_PLATFORM_SB_MEM_BLOCK_SIZE_01 + 1) ==
+                &CFE_SB_Global.Mem.Cache[CFE_PLATFORM_ES_POOL_MAX_BUCKETS - 2]);
+
+    /* A released buffer is reused without going back to the pool and stats stay exact */
+    bd = CFE_SB_GetBufferFromPool(10);
+    ASSERT_TRUE(bd != NULL);
+    Cache = CFE_SB_GetBufferCache(bd->AllocatedSize);
+    CFE_SB_ReturnBufferToPool(bd);
+    ASSERT_EQ(Cache->Count, 1);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, 0);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    bd2 = CFE_SB_GetBufferFromPool(10);
+    ASSERT_TRUE(bd2 == bd);
+    ASSERT_EQ(bd2->UseCount, 1);
+    ASSERT_EQ(Cache->Count, 0);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, bd2->AllocatedSize);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    CFE_SB_ReturnBufferToPool(bd2);
+
+    /* Buffers released to a full cache go back to the pool */
+    for (i = 0; i <= CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+    {
+        bdList[i] = CFE_SB_GetBufferFromPool(10);
+    }
+    for (i = 0; i <= CFE_PLATFORM_SB_BUF_CACHE_DEPTH; ++i)
+    {
+        CFE_SB_ReturnBufferToPool(bdList[i]);
+    }
+    ASSERT_EQ(Cache->Count, CFE_PLATFORM_SB_BUF_CACHE_DEPTH);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse, CFE_PLATFORM_SB_BUF_CACHE_DEPTH + 1);
+
+    /* An exhausted pool flushes the cache and is tried again */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    bd = CFE_SB_GetBufferFromPool(200);
+    ASSERT_TRUE(bd != NULL);
+    ASSERT_EQ(Cache->Count, 0);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, CFE_PLATFORM_SB_BUF_CACHE_DEPTH + 1);
+
+    /* Nothing to flush so the failure is returned */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    ASSERT_TRUE(CFE_SB_GetBufferFromPool(10) == NULL);
+
+    EVTCNT(0);
+
+} /* end Test_CFE_SB_BufferCache */
+
 /*
 ** Test internal function to get the pipe table index for the given pipe ID
 */
@@ -502,6 +502,22 @@ void Test_GetPipeOpts_BadPtr(void);
 ******************************************************************************/
 void Test_GetPipeOpts(void);
 
+/*****************************************************************************/
+/**
+** \brief Test getting the poll ID with invalid arguments
+**
+** \par Description
+**        This function tests the get pipe poll ID API with a bad pointer,
+**        a bad pipe ID and a pipe that is not pollable.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetPipePollId_Errors(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB get pipe name by id API test functions
@@ -1047,6 +1063,23 @@ void Test_SB_EarlyInit(void);
 ******************************************************************************/
 void Test_SB_EarlyInit_SemCreateError(void);
 
+/*****************************************************************************/
+/**
+** \brief Test early initialization response to a route order semaphore
+**        create failure
+**
+** \par Description
+**        This function tests the early initialization response to a failure
+**        to create one of the route ordering semaphores.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_EarlyInit_OrderSemCreateError(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test early initialization response to a pool create ex failure
@@ -1200,6 +1233,38 @@ void Test_CreatePipe_LongPipeName(void);
 ******************************************************************************/
 void Test_CreatePipe_SamePipeName(void);
 
+/*****************************************************************************/
+/**
+** \brief Test a pollable pipe signals and clears its event
+**
+** \par Description
+**        This function tests that a pipe created with CFE_SB_PIPEOPTS_POLLABLE
+**        signals its event on the first delivery and clears it once drained.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreatePipe_Pollable(void);
+
+/*****************************************************************************/
+/**
+** \brief Test create pipe response to a pollable event failure
+**
+** \par Description
+**        This function tests the create pipe response when the OS cannot
+**        create the pollable event.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreatePipe_PollableErr(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test create pipe response to too many pipes
@@ -1293,6 +1358,22 @@ void Test_DeletePipe_InvalidPipeId(void);
 ******************************************************************************/
 void Test_DeletePipe_InvalidPipeOwner(void);
 
+/*****************************************************************************/
+/**
+** \brief Test delete pipe response to a pipe with a delivery in progress
+**
+** \par Description
+**        This function tests that delete pipe waits for a queue write that
+**        was started outside the SB lock before deleting the queue.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeletePipe_PendingDelivery(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test successful pipe delete with app ID
@@ -1968,6 +2049,38 @@ void Test_TransmitBuffer_NoIncrement(void);
 ******************************************************************************/
 void Test_ReleaseMessageBuffer(void);
 
+/*****************************************************************************/
+/**
+** \brief Test creating and deleting persistent publish rings
+**
+** \par Description
+**        This function tests argument checking, allocation failure, ownership,
+**        table limits and application cleanup of publish rings.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_PublishRing_CreateDelete(void);
+
+/*****************************************************************************/
+/**
+** \brief Test publishing from a persistent publish ring
+**
+** \par Description
+**        This function tests that ring buffers are reused once released by
+**        all subscribers, without any further pool allocation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_PublishRing_Transmit(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response with the destination disabled
@@ -2160,6 +2273,70 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages with invalid arguments
+**
+** \par Description
+**        This function tests the batch receive response to a null buffer array,
+**        a null count pointer, a zero count and an invalid pipe ID.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages when the pipe is empty
+**
+** \par Description
+**        This function tests the batch receive response when there is no message
+**        on the queue.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_Poll(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving all waiting messages in a single batch
+**
+** \par Description
+**        This function tests that a batch receive drains every waiting message,
+**        and that the next receive releases all buffers of the batch.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_MultipleMsgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that a batch receive honors the requested maximum count
+**
+** \par Description
+**        This function tests that a batch receive never returns more buffers
+**        than requested, leaving the rest on the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_MaxCount(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -2334,6 +2511,23 @@ void Test_PutDestBlk_ErrLogic(void);
 ******************************************************************************/
 void Test_CFE_SB_Buffers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the SB buffer cache
+**
+** \par Description
+**        This function tests that released buffers are cached and reused,
+**        that a full cache returns buffers to the pool and that the cache
+**        is flushed when the pool is exhausted.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_BufferCache(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test functions that involve bad pipe information
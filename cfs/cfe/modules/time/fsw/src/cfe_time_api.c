@@ -57,6 +57,66 @@ CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
 
 } /* End of CFE_TIME_GetTime() */
 
+/*
+ * Function: CFE_TIME_GetTimeFast - See API and header file for details
+ */
+CFE_TIME_SysTime_t CFE_TIME_GetTimeFast(void)
+{
+    const CFE_TIME_FastTime_t *FastTime   = &CFE_TIME_Global.FastTime;
+    uint32                     RetryCount = 4;
+    uint32                     Sequence;
+    uint64                     AtToneLatch;
+    uint64                     AtToneTime;
+    uint64                     CurrentLatch;
+    OS_time_t                  LocalTime;
+    CFE_TIME_SysTime_t         CurrentTime;
+
+    while (true)
+    {
+        Sequence = FastTime->Sequence;
+        CFE_TIME_FAST_READ_FENCE();
+
+        CFE_PSP_GetTime(&LocalTime);
+        AtToneLatch = FastTime->AtToneLatch;
+        AtToneTime  = FastTime->AtToneTime;
+
+        CFE_TIME_FAST_READ_FENCE();
+        if ((Sequence & 1) == 0 && Sequence == FastTime->Sequence)
+        {
+            break;
+        }
+
+        /*
+        ** Caught mid-update, retry a limited number of times...
+        */
+        if (RetryCount == 0)
+        {
+            return CFE_TIME_GetTime();
+        }
+
+        --RetryCount;
+    }
+
+    CurrentLatch = CFE_TIME_FastLatch(LocalTime);
+
+    /*
+    ** Nothing published yet, or the local clock rolled over since the
+    ** tone - both are rare, let the full computation handle them...
+    */
+    if (Sequence == 0 || CurrentLatch < AtToneLatch)
+    {
+        return CFE_TIME_GetTime();
+    }
+
+    AtToneTime += CurrentLatch - AtToneLatch;
+
+    CurrentTime.Seconds    = (uint32)(AtToneTime >> 32);
+    CurrentTime.Subseconds = (uint32)AtToneTime;
+
+    return (CurrentTime);
+
+} /* End of CFE_TIME_GetTimeFast() */
+
 /*
  * Function: CFE_TIME_GetTAI - See API and header file for details
  */
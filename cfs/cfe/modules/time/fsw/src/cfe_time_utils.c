@@ -73,6 +73,50 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void)
     return NextState;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_PublishFastTime()                                      */
+/* Precompute the default time at tone for CFE_TIME_GetTimeFast()  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_TIME_PublishFastTime(volatile CFE_TIME_ReferenceState_t *NextState)
+{
+    CFE_TIME_SysTime_t   AtToneTime;
+    CFE_TIME_FastTime_t *FastTime = &CFE_TIME_Global.FastTime;
+
+    /*
+    ** Same arithmetic as CFE_TIME_GetReference() with no time since tone...
+    */
+    AtToneTime = NextState->AtToneMET;
+
+#if (CFE_PLATFORM_TIME_CFG_CLIENT == true)
+    if (NextState->DelayDirection == CFE_TIME_AdjustDirection_ADD)
+    {
+        AtToneTime = CFE_TIME_Add(AtToneTime, NextState->AtToneDelay);
+    }
+    else
+    {
+        AtToneTime = CFE_TIME_Subtract(AtToneTime, NextState->AtToneDelay);
+    }
+#endif
+
+    AtToneTime = CFE_TIME_Add(AtToneTime, NextState->AtToneSTCF);
+
+#if (CFE_MISSION_TIME_CFG_DEFAULT_TAI != true)
+    AtToneTime.Seconds -= NextState->AtToneLeapSeconds;
+#endif
+
+    /* Odd sequence tells readers the tuple below is being rewritten */
+    FastTime->Sequence = FastTime->Sequence + 1;
+    CFE_TIME_FAST_WRITE_FENCE();
+
+    FastTime->AtToneLatch = ((uint64)NextState->AtToneLatch.Seconds << 32) + NextState->AtToneLatch.Subseconds;
+    FastTime->AtToneTime  = ((uint64)AtToneTime.Seconds << 32) + AtToneTime.Subseconds;
+
+    CFE_TIME_FAST_WRITE_FENCE();
+    FastTime->Sequence = FastTime->Sequence + 1;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_TIME_LatchClock() -- query local clock                      */
@@ -41,6 +41,25 @@
 
 #define CFE_TIME_NEGATIVE 0x80000000 /* ~ 68 * 31,536,000 seconds */
 
+/*
+** Local clock ticks to 8.24 fixed point subseconds, rounded so that a
+** multiply and shift reproduces OS_TimeGetSubsecondsPart()...
+*/
+#define CFE_TIME_FAST_SUBSECS_SHIFT 24
+#define CFE_TIME_FAST_SUBSECS_SCALE \
+    (((1ULL << (32 + CFE_TIME_FAST_SUBSECS_SHIFT)) + (OS_TIME_TICKS_PER_SECOND / 2)) / OS_TIME_TICKS_PER_SECOND)
+
+/*
+** Ordering for the fast time sequence counter (compiler-only on targets without the builtins)...
+*/
+#ifdef __ATOMIC_ACQUIRE
+#define CFE_TIME_FAST_WRITE_FENCE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#define CFE_TIME_FAST_READ_FENCE()  __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else
+#define CFE_TIME_FAST_WRITE_FENCE()
+#define CFE_TIME_FAST_READ_FENCE()
+#endif
+
 /*************************************************************************/
 
 /*
@@ -152,6 +171,21 @@ typedef struct
 
 } CFE_TIME_ReferenceState_t;
 
+/*
+** Default time at the tone, precomputed at every reference update...
+**
+** CFE_TIME_GetTimeFast() reads this instead of the reference state, so the
+** current time is a single clock latch plus one 64-bit add.  Times are kept
+** as 32.32 fixed point (seconds:subseconds).  Sequence is odd while an
+** update is in progress and zero until the first update is published.
+*/
+typedef struct
+{
+    volatile uint32 Sequence;
+    volatile uint64 AtToneLatch; /* Local clock latched at time of tone */
+    volatile uint64 AtToneTime;  /* Default time (TAI or UTC) at time of tone */
+} CFE_TIME_FastTime_t;
+
 /*************************************************************************/
 
 /*
@@ -225,6 +259,7 @@ typedef struct
     volatile CFE_TIME_ReferenceState_t ReferenceState[CFE_TIME_REFERENCE_BUF_DEPTH];
     volatile uint32                    LastVersionCounter;  /* Completed Updates to "AtTone" values */
     uint32                             ResetVersionCounter; /* Version counter at last counter reset */
+    CFE_TIME_FastTime_t                FastTime;            /* Default time at tone for CFE_TIME_GetTimeFast() */
 
     /*
     ** Time window verification values (converted from micro-secs)...
@@ -407,15 +442,33 @@ int32 CFE_TIME_ToneSendTime(CFE_TIME_SysTime_t NewTime);
  */
 volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
 
+/*
+ * Publish the default time at tone of a reference update for CFE_TIME_GetTimeFast()
+ */
+void CFE_TIME_PublishFastTime(volatile CFE_TIME_ReferenceState_t *NextState);
+
 /*
  * Helper function for updating the "Reference" value
  * This is the local replacement for "OS_IntUnlock()"
  */
 static inline void CFE_TIME_FinishReferenceUpdate(volatile CFE_TIME_ReferenceState_t *NextState)
 {
+    CFE_TIME_PublishFastTime(NextState);
     CFE_TIME_Global.LastVersionCounter = NextState->StateVersion;
 }
 
+/*
+ * Convert a local clock reading to 32.32 fixed point, matching CFE_TIME_LatchClock()
+ */
+static inline uint64 CFE_TIME_FastLatch(OS_time_t LocalTime)
+{
+    uint64 Subseconds = (((uint64)OS_TimeGetFractionalPart(LocalTime) * CFE_TIME_FAST_SUBSECS_SCALE) +
+                         ((1ULL << CFE_TIME_FAST_SUBSECS_SHIFT) - 1)) >>
+                        CFE_TIME_FAST_SUBSECS_SHIFT;
+
+    return ((uint64)(uint32)OS_TimeGetTotalSeconds(LocalTime) << 32) + Subseconds;
+}
+
 /*
  * Helper function for getting the "Reference" value
  * This is the replacement for direct memory reads of
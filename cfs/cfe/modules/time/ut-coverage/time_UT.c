@@ -384,6 +384,8 @@ void Test_GetTime(void)
     const char *                        expectedUTC  = "2013-001-03:02:42.56789";
     const char *                        expectedSTCF = "1980-001-01:00:00.00000";
     volatile CFE_TIME_ReferenceState_t *RefState;
+    CFE_TIME_SysTime_t                  FastTime;
+    CFE_TIME_SysTime_t                  FullTime;
 
     UtPrintf("Begin Test Get Time");
 
@@ -465,6 +467,32 @@ void Test_GetTime(void)
 #endif
     UT_Report(__FILE__, __LINE__, result, "CFE_TIME_GetTime", testDesc);
 
+    /* Test the cached fast path matches the full computation (at the default BSP time) */
+    UT_InitData();
+    FastTime = CFE_TIME_GetTimeFast();
+    FullTime = CFE_TIME_GetTime();
+    snprintf(testDesc, UT_MAX_MESSAGE_LENGTH, "Expected = %u.%08x, actual = %u.%08x", (unsigned int)FullTime.Seconds,
+             (unsigned int)FullTime.Subseconds, (unsigned int)FastTime.Seconds, (unsigned int)FastTime.Subseconds);
+    UT_Report(__FILE__, __LINE__, CFE_TIME_Compare(FastTime, FullTime) == CFE_TIME_EQUAL, "CFE_TIME_GetTimeFast",
+              testDesc);
+
+    /* Test the fast path falls back when the local clock rolled over since the tone;
+     * the fallback latches the default BSP time again */
+    UT_InitData();
+    UT_SetBSP_Time(RefState->AtToneLatch.Seconds - 1, 0);
+    FastTime = CFE_TIME_GetTimeFast();
+    FullTime = CFE_TIME_GetTime();
+    UT_Report(__FILE__, __LINE__, CFE_TIME_Compare(FastTime, FullTime) == CFE_TIME_EQUAL, "CFE_TIME_GetTimeFast",
+              "Local clock rollover");
+
+    /* Test the fast path falls back when it only ever sees an update in progress */
+    UT_InitData();
+    CFE_TIME_Global.FastTime.Sequence |= 1;
+    UT_Report(__FILE__, __LINE__, CFE_TIME_Compare(CFE_TIME_GetTimeFast(), CFE_TIME_GetTime()) == CFE_TIME_EQUAL,
+              "CFE_TIME_GetTimeFast", "Update in progress");
+    UtAssert_STUB_COUNT(CFE_PSP_GetTime, 7);
+    CFE_TIME_Global.FastTime.Sequence += 1;
+
     /* Test successfully retrieving the spacecraft time correlation
      * factor (SCTF)
      */
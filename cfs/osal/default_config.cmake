@@ -317,3 +317,15 @@ set(OSAL_CONFIG_MAX_CMD_LEN             1000
 set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
     CACHE STRING "Maximum depth of message queue"
 )
+
+# The largest message size for which a queue is implemented in-process.
+# On implementations which support it (currently POSIX), a queue created with a
+# maximum message size of this many bytes or less is implemented as a ring buffer
+# in process memory rather than a kernel message queue.  Puts and gets on such a
+# queue only enter the kernel when a reader actually needs to block or be woken.
+# This suits queues carrying small descriptors, such as the pointer-sized entries
+# used by cFE software bus pipes.  Each queue reserves storage for
+# OSAL_CONFIG_QUEUE_MAX_DEPTH messages of this size.  Set to 0 to disable.
+set(OSAL_CONFIG_QUEUE_RING_MAX_MSG_SIZE 0
+    CACHE STRING "Maximum message size of an in-process ring queue (0 to disable)"
+)
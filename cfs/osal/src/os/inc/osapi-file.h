@@ -257,6 +257,38 @@ int32 OS_TimedRead(osal_id_t filedes, void *buffer, size_t nbytes, int32 timeout
  */
 int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Copy data from one open file to another
+ *
+ * Copies up to max_bytes from the current position of src_fd to the current
+ * position of dest_fd, advancing both.  Fewer bytes are copied only if the end
+ * of the source file is reached, so a copy is complete once this reports zero
+ * bytes copied.
+ *
+ * Because progress is kept in the file positions, a large copy may be done in
+ * chunks by calling this repeatedly with a bounded max_bytes.  This allows the
+ * caller to pace the copy or stop it and resume later.
+ *
+ * Where the underlying OS supports it the data is moved inside the kernel
+ * (e.g. copy_file_range() or sendfile() on Linux) without passing through a
+ * user buffer.  Otherwise it falls back to a read/write loop.
+ *
+ * @param[in]  dest_fd       The handle ID of the destination file, open for writing
+ * @param[in]  src_fd        The handle ID of the source file, open for reading
+ * @param[in]  max_bytes     Maximum number of bytes to copy
+ * @param[out] bytes_copied  Number of bytes actually copied
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if bytes_copied is NULL
+ * @retval #OS_ERR_INVALID_SIZE if max_bytes is invalid
+ * @retval #OS_ERR_INVALID_ID if either file descriptor is invalid
+ * @retval #OS_ERROR if the data could not be read or written.  Some data may
+ *         have been copied, as reported in bytes_copied.
+ */
+int32 OS_FileCopyRange(osal_id_t dest_fd, osal_id_t src_fd, size_t max_bytes, size_t *bytes_copied);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Changes the permissions of a file
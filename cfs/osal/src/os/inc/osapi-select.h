@@ -47,6 +47,26 @@ typedef struct
     uint8 object_ids[(OS_MAX_NUM_OPEN_FILES + 7) / 8];
 } OS_FdSet;
 
+/**
+ * @brief A persistent set of OSAL stream IDs to wait on
+ *
+ * Unlike an OS_FdSet, membership is registered with the underlying OS once
+ * when an ID is added, so each wait only costs in proportion to the number
+ * of ready streams where the OS supports it (epoll on Linux).  Other
+ * platforms fall back to select() over the member sets.
+ *
+ * Created with OS_PollSetCreate() and manipulated using the related API
+ * calls.  It should not be modified directly by applications.
+ *
+ * @sa OS_PollSetCreate(), OS_PollSetAdd(), OS_PollSetRemove(), OS_PollSetWait(), OS_PollSetDelete()
+ */
+typedef struct
+{
+    int32    impl_handle; /**< @brief OS-specific handle (e.g. epoll descriptor), -1 if not used */
+    OS_FdSet read_set;    /**< @brief Members waiting to become readable */
+    OS_FdSet write_set;   /**< @brief Members waiting to become writable */
+} OS_PollSet;
+
 /**
  * @brief For the OS_SelectSingle() function's in/out StateFlags parameter,
  * the state(s) of the stream and the result of the select is a combination
@@ -158,6 +178,140 @@ int32 OS_SelectFdClear(OS_FdSet *Set, osal_id_t objid);
  * @retval false FDSet structure does not contain ID
  */
 bool OS_SelectFdIsSet(OS_FdSet *Set, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a persistent poll set
+ *
+ * After this call the set is empty and ready for OS_PollSetAdd().  The set
+ * holds an OS resource on some platforms, so it must be released with
+ * OS_PollSetDelete() when no longer needed.
+ *
+ * @param[out] Set  The poll set to initialize
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if Set is NULL
+ * @retval #OS_ERROR if the OS could not allocate the set
+ */
+int32 OS_PollSetCreate(OS_PollSet *Set);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Delete a persistent poll set
+ *
+ * Releases any OS resource held by the set.  The member streams themselves
+ * are not affected.
+ *
+ * @param[in,out] Set  The poll set to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ */
+int32 OS_PollSetDelete(OS_PollSet *Set);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Add a stream to a poll set, or change the states it is waited for
+ *
+ * StateFlags is a combination of OS_STREAM_STATE_READABLE and
+ * OS_STREAM_STATE_WRITABLE.  The stream stays a member until it is removed.
+ *
+ * @note A stream should be removed from all poll sets before it is closed.
+ *
+ * @param[in,out] Set         The poll set
+ * @param[in]     objid       The OSAL stream ID to add
+ * @param[in]     StateFlags  The state(s) to wait for
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERROR if StateFlags does not request any state
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the stream cannot be waited on
+ */
+int32 OS_PollSetAdd(OS_PollSet *Set, osal_id_t objid, uint32 StateFlags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Remove a stream from a poll set
+ *
+ * @param[in,out] Set    The poll set
+ * @param[in]     objid  The OSAL stream ID to remove
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ */
+int32 OS_PollSetRemove(OS_PollSet *Set, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for activity on the members of a poll set
+ *
+ * Blocks until at least one member is readable or writable, as requested
+ * when it was added, or the timeout elapses.  On return the output sets
+ * contain the streams with activity; either may be NULL if the caller is
+ * not interested in it.
+ *
+ * @param[in]  Set       The poll set
+ * @param[out] ReadSet   Members that are readable (optional)
+ * @param[out] WriteSet  Members that are writable (optional)
+ * @param[in]  msecs     Timeout in milliseconds, zero to poll, negative to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERROR_TIMEOUT if no member had activity before the timeout
+ */
+int32 OS_PollSetWait(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a pollable event stream
+ *
+ * An event stream carries no data.  It becomes readable when signalled with
+ * OS_SelectEventSignal() and stays readable until cleared with
+ * OS_SelectEventClear(), so it can be waited on with OS_SelectSingle(),
+ * OS_SelectMultiple() or a poll set alongside sockets and files.  This lets
+ * a task that services both I/O and a software queue sleep on a single wait.
+ *
+ * Signals that arrive before the event is cleared are coalesced.
+ *
+ * The event is released with OS_close().
+ *
+ * @param[out] event_id  The OSAL stream ID of the new event
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if event_id is NULL
+ * @retval #OS_ERR_NO_FREE_IDS if no free stream IDs are available
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the platform has no pollable event primitive
+ */
+int32 OS_SelectEventCreate(osal_id_t *event_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Make an event stream readable
+ *
+ * This may be called from any task, whether or not the event is
+ * already signalled.
+ *
+ * @param[in] event_id  The OSAL stream ID of the event
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID is not a valid stream
+ */
+int32 OS_SelectEventSignal(osal_id_t event_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Return an event stream to the non-readable state
+ *
+ * Clearing an event that is not signalled has no effect.
+ *
+ * @param[in] event_id  The OSAL stream ID of the event
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID is not a valid stream
+ */
+int32 OS_SelectEventClear(osal_id_t event_id);
 /**@}*/
 
 #endif /* OSAPI_SELECT_H */
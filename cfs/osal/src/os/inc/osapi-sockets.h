@@ -104,6 +104,29 @@ typedef struct
     OS_SockAddrData_t AddrData;     /**< @brief Abstract Address data */
 } OS_SockAddr_t;
 
+/**
+ * @brief Describes one datagram of a multi-message send
+ *
+ * @sa OS_SocketSendToMulti()
+ */
+typedef struct
+{
+    const void *Buffer; /**< @brief Pointer to message data to send */
+    size_t      BufLen; /**< @brief The length of the message data to send */
+} OS_SockBuf_t;
+
+/**
+ * @brief Describes one datagram buffer of a multi-message receive
+ *
+ * @sa OS_SocketRecvFromMulti()
+ */
+typedef struct
+{
+    void * Buffer;  /**< @brief Pointer to message data receive buffer */
+    size_t BufLen;  /**< @brief The maximum length of the message data to receive */
+    size_t RecvLen; /**< @brief Set to the actual length of the message data received */
+} OS_SockRecvBuf_t;
+
 /**
  * @brief Encapsulates socket properties
  *
@@ -317,6 +340,26 @@ int32 OS_SocketAccept(osal_id_t sock_id, osal_id_t *connsock_id, OS_SockAddr_t *
  */
 int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads several datagrams from a message-oriented (datagram) socket
+ *
+ * Waits for the first datagram as per OS_SocketRecvFrom(), then fills the rest of
+ * the array with any datagrams that are already queued on the socket, without
+ * blocking.  Where the platform supports it (e.g. recvmmsg() on Linux) this is done
+ * with a single system call per group of messages.
+ *
+ * The remote addresses of the datagrams are not reported.
+ *
+ * @param[in]     sock_id      The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] BufArray     Array of receive buffers, the RecvLen of each filled entry is set
+ * @param[in]     BufCount     The number of entries in BufArray
+ * @param[in]     timeout      The maximum amount of time to wait, or OS_PEND to wait forever
+ *
+ * @return Count of datagrams received or error status, see @ref OSReturnCodes
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockRecvBuf_t *BufArray, uint32 BufCount, int32 timeout);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Sends data to a message-oriented (datagram) socket
@@ -334,6 +377,30 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
  */
 int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends several datagrams to a message-oriented (datagram) socket
+ *
+ * Each entry of the array is sent as a separate datagram to the same remote
+ * address, in order.  Where the platform supports it (e.g. sendmmsg() on Linux)
+ * this is done with a single system call per group of messages, otherwise each
+ * message is sent individually as per OS_SocketSendTo().
+ *
+ * As with OS_SocketSendTo() this does not block.  If the socket cannot queue all
+ * of the messages, the count returned will be less than BufCount, and the messages
+ * after that count were not sent.
+ *
+ * @param[in]   sock_id      The socket ID, which must be of the datagram type
+ * @param[in]   BufArray     Array of datagrams to send
+ * @param[in]   BufCount     The number of entries in BufArray
+ * @param[in]   RemoteAddr   Buffer containing the remote network address to send to
+ *
+ * @return Count of datagrams sent or error status, see @ref OSReturnCodes
+ *         An error status is only returned if no datagram could be sent.
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, const OS_SockBuf_t *BufArray, uint32 BufCount,
+                           const OS_SockAddr_t *RemoteAddr);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an OSAL ID from a given name
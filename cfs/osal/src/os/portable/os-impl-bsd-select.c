@@ -384,3 +384,428 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
 
     return return_code;
 } /* end OS_SelectMultiple_Impl */
+
+/****************************************************************************************
+                                PERSISTENT POLL SET API
+ ***************************************************************************************/
+
+#ifdef OS_IMPL_POLLSET_EPOLL
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(OS_PollSet *Set)
+{
+    Set->impl_handle = epoll_create1(EPOLL_CLOEXEC);
+    if (Set->impl_handle < 0)
+    {
+        OS_DEBUG("epoll_create1: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(OS_PollSet *Set)
+{
+    if (Set->impl_handle >= 0)
+    {
+        close(Set->impl_handle);
+        Set->impl_handle = -1;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAdd_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(OS_PollSet *Set, const OS_object_token_t *token, uint32 StateFlags)
+{
+    OS_impl_file_internal_record_t *impl;
+    struct epoll_event              event;
+    int                             os_status;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if (!impl->selectable || impl->fd < 0)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&event, 0, sizeof(event));
+    if (StateFlags & OS_STREAM_STATE_READABLE)
+    {
+        event.events |= EPOLLIN;
+    }
+    if (StateFlags & OS_STREAM_STATE_WRITABLE)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    /* The OSAL index comes back with each ready event */
+    event.data.u32 = OS_ObjectIndexFromToken(token);
+
+    os_status = epoll_ctl(Set->impl_handle, EPOLL_CTL_ADD, impl->fd, &event);
+    if (os_status < 0 && errno == EEXIST)
+    {
+        os_status = epoll_ctl(Set->impl_handle, EPOLL_CTL_MOD, impl->fd, &event);
+    }
+
+    if (os_status < 0)
+    {
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetAdd_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetRemove_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(OS_PollSet *Set, const OS_object_token_t *token)
+{
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /*
+     * The kernel already dropped the registration if the descriptor was closed,
+     * so a missing entry is not an error.
+     */
+    if (impl->fd >= 0 && epoll_ctl(Set->impl_handle, EPOLL_CTL_DEL, impl->fd, NULL) < 0 && errno != ENOENT &&
+        errno != EBADF)
+    {
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetRemove_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+{
+    struct epoll_event events[OS_MAX_NUM_OPEN_FILES];
+    struct timespec    ts_now;
+    struct timespec    ts_end;
+    int                timeout;
+    int                os_status;
+    int                i;
+    uint32             local_id;
+
+    timeout = msecs;
+    if (msecs > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts_end);
+        ts_end.tv_sec += msecs / 1000;
+        ts_end.tv_nsec += 1000000 * (msecs % 1000);
+        if (ts_end.tv_nsec >= 1000000000)
+        {
+            ++ts_end.tv_sec;
+            ts_end.tv_nsec -= 1000000000;
+        }
+    }
+
+    while (true)
+    {
+        os_status = epoll_wait(Set->impl_handle, events, OS_MAX_NUM_OPEN_FILES, timeout);
+        if (os_status >= 0 || (errno != EINTR && errno != EAGAIN))
+        {
+            break;
+        }
+
+        /* Interrupted - wait again for whatever remains of the timeout */
+        if (msecs > 0)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &ts_now);
+            timeout = ((ts_end.tv_sec - ts_now.tv_sec) * 1000) + ((ts_end.tv_nsec - ts_now.tv_nsec) / 1000000);
+            if (timeout <= 0)
+            {
+                os_status = 0;
+                break;
+            }
+        }
+    }
+
+    if (os_status < 0)
+    {
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    for (i = 0; i < os_status; ++i)
+    {
+        local_id = events[i].data.u32;
+
+        /* Hangups and errors are reported as readable so the owner's next read sees them */
+        if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0 &&
+            (Set->read_set.object_ids[local_id >> 3] & (1 << (local_id & 0x7))) != 0)
+        {
+            ReadSet->object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+        }
+        if ((events[i].events & (EPOLLOUT | EPOLLERR)) != 0 &&
+            (Set->write_set.object_ids[local_id >> 3] & (1 << (local_id & 0x7))) != 0)
+        {
+            WriteSet->object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+        }
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetWait_Impl */
+
+#else
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(OS_PollSet *Set)
+{
+    /* The select() fallback needs nothing beyond the member sets */
+    return OS_SUCCESS;
+} /* end OS_PollSetCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(OS_PollSet *Set)
+{
+    return OS_SUCCESS;
+} /* end OS_PollSetDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAdd_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(OS_PollSet *Set, const OS_object_token_t *token, uint32 StateFlags)
+{
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* Reject now what OS_SelectMultiple_Impl() would reject on every wait */
+    if (!impl->selectable || impl->fd < 0 || impl->fd >= FD_SETSIZE)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetAdd_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetRemove_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(OS_PollSet *Set, const OS_object_token_t *token)
+{
+    return OS_SUCCESS;
+} /* end OS_PollSetRemove_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+{
+    int32 return_code;
+
+    /* Both outputs may be the same scratch set, so wait on copies */
+    OS_FdSet rd_set = Set->read_set;
+    OS_FdSet wr_set = Set->write_set;
+
+    return_code = OS_SelectMultiple_Impl(&rd_set, &wr_set, msecs);
+    if (return_code == OS_SUCCESS)
+    {
+        *ReadSet  = rd_set;
+        *WriteSet = wr_set;
+    }
+
+    return return_code;
+} /* end OS_PollSetWait_Impl */
+
+#endif /* OS_IMPL_POLLSET_EPOLL */
+
+/****************************************************************************************
+                                POLLABLE EVENT API
+ ***************************************************************************************/
+
+#ifdef OS_IMPL_SELECT_EVENTFD
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventCreate_Impl(const OS_object_token_t *token)
+{
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* Non-blocking so that signal and clear never wait, whatever the counter holds */
+    impl->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (impl->fd < 0)
+    {
+        OS_DEBUG("eventfd: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    impl->selectable = true;
+
+    return OS_SUCCESS;
+} /* end OS_SelectEventCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventSignal_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventSignal_Impl(const OS_object_token_t *token)
+{
+    OS_impl_file_internal_record_t *impl;
+    uint64                          count;
+
+    impl  = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+    count = 1;
+
+    /*
+     * EAGAIN means the counter is saturated, in which case the
+     * event is already readable and there is nothing more to do.
+     */
+    if (write(impl->fd, &count, sizeof(count)) != sizeof(count) && errno != EAGAIN)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_SelectEventSignal_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventClear_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventClear_Impl(const OS_object_token_t *token)
+{
+    OS_impl_file_internal_record_t *impl;
+    uint64                          count;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /* Reading resets the counter to zero; EAGAIN means it already was */
+    if (read(impl->fd, &count, sizeof(count)) != sizeof(count) && errno != EAGAIN)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_SelectEventClear_Impl */
+
+#else
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventCreate_Impl(const OS_object_token_t *token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_SelectEventCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventSignal_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventSignal_Impl(const OS_object_token_t *token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_SelectEventSignal_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventClear_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventClear_Impl(const OS_object_token_t *token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_SelectEventClear_Impl */
+
+#endif /* OS_IMPL_SELECT_EVENTFD */
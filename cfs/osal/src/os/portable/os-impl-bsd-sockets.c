@@ -512,22 +512,149 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 
 /*----------------------------------------------------------------
  *
- * Function: OS_SocketSendTo_Impl
+ * Function: OS_SocketRecvFromMulti_Impl
  *
  *  Purpose: Implemented per internal OSAL API
  *           See prototype for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
-                           const OS_SockAddr_t *RemoteAddr)
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockRecvBuf_t *BufArray, uint32 BufCount,
+                                  int32 timeout)
 {
+    int32                           return_code;
     int                             os_result;
-    socklen_t                       addrlen;
-    const struct sockaddr *         sa;
+    int                             waitflags;
+    uint32                          operation;
+    uint32                          num_recv;
     OS_impl_file_internal_record_t *impl;
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+    struct mmsghdr msgvec[OS_IMPL_SOCKET_MMSG_MAX];
+    struct iovec   iov[OS_IMPL_SOCKET_MMSG_MAX];
+    uint32         chunk;
+    uint32         i;
+#endif
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
 
+    operation = OS_STREAM_STATE_READABLE;
+    /*
+     * If "O_NONBLOCK" flag is set then use select()
+     * Note this is the only way to get a correct timeout
+     */
+    if (impl->selectable)
+    {
+        waitflags   = MSG_DONTWAIT;
+        return_code = OS_SelectSingle_Impl(token, &operation, timeout);
+    }
+    else
+    {
+        if (timeout == 0)
+        {
+            waitflags = MSG_DONTWAIT;
+        }
+        else
+        {
+            /* note timeout will not be honored if >0 */
+            waitflags = 0;
+        }
+        return_code = OS_SUCCESS;
+    }
+
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    if ((operation & OS_STREAM_STATE_READABLE) == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    /*
+     * Only the first datagram may wait, the rest of the
+     * array is filled with whatever is already queued.
+     */
+    num_recv  = 0;
+    os_result = 0;
+    while (num_recv < BufCount)
+    {
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+        /* Receive as many messages as the local vector holds with a single system call */
+        chunk = BufCount - num_recv;
+        if (chunk > OS_IMPL_SOCKET_MMSG_MAX)
+        {
+            chunk = OS_IMPL_SOCKET_MMSG_MAX;
+        }
+
+        memset(msgvec, 0, sizeof(msgvec[0]) * chunk);
+        for (i = 0; i < chunk; ++i)
+        {
+            iov[i].iov_base              = BufArray[num_recv + i].Buffer;
+            iov[i].iov_len               = BufArray[num_recv + i].BufLen;
+            msgvec[i].msg_hdr.msg_iov    = &iov[i];
+            msgvec[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        os_result = recvmmsg(impl->fd, msgvec, chunk, waitflags, NULL);
+        if (os_result <= 0)
+        {
+            break;
+        }
+
+        for (i = 0; i < (uint32)os_result; ++i)
+        {
+            BufArray[num_recv + i].RecvLen = msgvec[i].msg_len;
+        }
+
+        num_recv += (uint32)os_result;
+        if ((uint32)os_result < chunk)
+        {
+            /* nothing more queued */
+            break;
+        }
+#else
+        /* No vector receive on this platform, receive each message individually */
+        os_result = recvfrom(impl->fd, BufArray[num_recv].Buffer, BufArray[num_recv].BufLen, waitflags, NULL, NULL);
+        if (os_result < 0)
+        {
+            break;
+        }
+
+        BufArray[num_recv].RecvLen = os_result;
+        ++num_recv;
+#endif
+
+        waitflags = MSG_DONTWAIT;
+    }
+
+    if (num_recv == 0 && os_result < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return OS_QUEUE_EMPTY;
+        }
+
+        OS_DEBUG("recvfrom: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return num_recv;
+} /* end OS_SocketRecvFromMulti_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendAddrLength
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the system address length to use when sending to the
+ *           given remote address, or 0 if the address is not valid.
+ *
+ *-----------------------------------------------------------------*/
+static socklen_t OS_SocketSendAddrLength(const OS_SockAddr_t *RemoteAddr)
+{
+    socklen_t              addrlen;
+    const struct sockaddr *sa;
+
     sa = (const struct sockaddr *)&RemoteAddr->AddrData;
     switch (sa->sa_family)
     {
@@ -545,6 +672,34 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     }
 
     if (addrlen != RemoteAddr->ActualLength)
+    {
+        addrlen = 0;
+    }
+
+    return addrlen;
+} /* end OS_SocketSendAddrLength */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendTo_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
+                           const OS_SockAddr_t *RemoteAddr)
+{
+    int                             os_result;
+    socklen_t                       addrlen;
+    const struct sockaddr *         sa;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    sa      = (const struct sockaddr *)&RemoteAddr->AddrData;
+    addrlen = OS_SocketSendAddrLength(RemoteAddr);
+    if (addrlen == 0)
     {
         return OS_ERR_BAD_ADDRESS;
     }
@@ -559,6 +714,94 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return os_result;
 } /* end OS_SocketSendTo_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, const OS_SockBuf_t *BufArray, uint32 BufCount,
+                                const OS_SockAddr_t *RemoteAddr)
+{
+    int                             os_result;
+    uint32                          num_sent;
+    socklen_t                       addrlen;
+    const struct sockaddr *         sa;
+    OS_impl_file_internal_record_t *impl;
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+    struct mmsghdr msgvec[OS_IMPL_SOCKET_MMSG_MAX];
+    struct iovec   iov[OS_IMPL_SOCKET_MMSG_MAX];
+    uint32         chunk;
+    uint32         i;
+#endif
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    sa      = (const struct sockaddr *)&RemoteAddr->AddrData;
+    addrlen = OS_SocketSendAddrLength(RemoteAddr);
+    if (addrlen == 0)
+    {
+        return OS_ERR_BAD_ADDRESS;
+    }
+
+    num_sent  = 0;
+    os_result = 0;
+    while (num_sent < BufCount)
+    {
+#ifdef OS_NETWORK_SUPPORTS_MMSG
+        /* Send as many messages as the local vector holds with a single system call */
+        chunk = BufCount - num_sent;
+        if (chunk > OS_IMPL_SOCKET_MMSG_MAX)
+        {
+            chunk = OS_IMPL_SOCKET_MMSG_MAX;
+        }
+
+        memset(msgvec, 0, sizeof(msgvec[0]) * chunk);
+        for (i = 0; i < chunk; ++i)
+        {
+            iov[i].iov_base               = (void *)BufArray[num_sent + i].Buffer;
+            iov[i].iov_len                = BufArray[num_sent + i].BufLen;
+            msgvec[i].msg_hdr.msg_name    = (void *)sa;
+            msgvec[i].msg_hdr.msg_namelen = addrlen;
+            msgvec[i].msg_hdr.msg_iov     = &iov[i];
+            msgvec[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        os_result = sendmmsg(impl->fd, msgvec, chunk, MSG_DONTWAIT);
+        if (os_result <= 0)
+        {
+            break;
+        }
+
+        num_sent += (uint32)os_result;
+        if ((uint32)os_result < chunk)
+        {
+            /* socket could not queue the rest of this group */
+            break;
+        }
+#else
+        /* No vector send on this platform, send each message individually */
+        os_result = sendto(impl->fd, BufArray[num_sent].Buffer, BufArray[num_sent].BufLen, MSG_DONTWAIT, sa, addrlen);
+        if (os_result < 0)
+        {
+            break;
+        }
+
+        ++num_sent;
+#endif
+    }
+
+    if (num_sent == 0 && os_result < 0)
+    {
+        OS_DEBUG("sendto: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return num_sent;
+} /* end OS_SocketSendToMulti_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketGetInfo_Impl
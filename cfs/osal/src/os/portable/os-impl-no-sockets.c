@@ -93,6 +93,17 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
     return OS_ERR_NOT_IMPLEMENTED;
 }
 
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockRecvBuf_t *BufArray, uint32 BufCount,
+                                  int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*----------------------------------------------------------------
  * Implementation for no network configuration
  *
@@ -104,6 +115,17 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return OS_ERR_NOT_IMPLEMENTED;
 }
 
+/*----------------------------------------------------------------
+ * Implementation for no network configuration
+ *
+ * See prototype for argument/return detail
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, const OS_SockBuf_t *BufArray, uint32 BufCount,
+                                const OS_SockAddr_t *RemoteAddr)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*----------------------------------------------------------------
  * Implementation for no network configuration
  *
@@ -273,3 +273,59 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
 
     return (return_code);
 } /* end OS_GenericWrite_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_GenericCopyRange_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericCopyRange_Impl(const OS_object_token_t *dest_token, const OS_object_token_t *src_token, size_t nbytes,
+                               size_t *bytes_copied)
+{
+#if defined(OS_IMPL_IO_COPY_FILE_RANGE) || defined(OS_IMPL_IO_SENDFILE)
+    ssize_t                         os_result;
+    OS_impl_file_internal_record_t *dest_impl;
+    OS_impl_file_internal_record_t *src_impl;
+
+    dest_impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *dest_token);
+    src_impl  = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *src_token);
+
+    os_result = -1;
+    errno     = ENOSYS;
+
+#ifdef OS_IMPL_IO_COPY_FILE_RANGE
+    os_result = copy_file_range(src_impl->fd, NULL, dest_impl->fd, NULL, nbytes, 0);
+#endif
+
+#ifdef OS_IMPL_IO_SENDFILE
+    /*
+     * copy_file_range() is refused for some combinations of files,
+     * e.g. across filesystems on older kernels, where sendfile() works.
+     */
+    if (os_result < 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP))
+    {
+        os_result = sendfile(dest_impl->fd, src_impl->fd, NULL, nbytes);
+    }
+#endif
+
+    if (os_result < 0)
+    {
+        /* Let the caller use a buffered copy for files the kernel cannot handle */
+        if (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)
+        {
+            return OS_ERR_NOT_IMPLEMENTED;
+        }
+
+        OS_DEBUG("copy: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    *bytes_copied = os_result;
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+} /* end OS_GenericCopyRange_Impl */
@@ -35,6 +35,20 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+/*
+ * Linux can copy file data inside the kernel.  sendfile() accepts regular
+ * files since 2.6.33.  copy_file_range() is tried first as it also lets the
+ * filesystem share or offload the copy, but the C library only declares it
+ * (glibc 2.27 onward) when this file is built with _GNU_SOURCE.
+ */
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#define OS_IMPL_IO_SENDFILE
+#if defined(_GNU_SOURCE) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define OS_IMPL_IO_COPY_FILE_RANGE
+#endif
+#endif
+
 typedef struct
 {
     int  fd;
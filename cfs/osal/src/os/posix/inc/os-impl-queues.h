@@ -29,12 +29,41 @@
 #define OS_IMPL_QUEUES_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <mqueue.h>
+#include <pthread.h>
+
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+
+/* A single message slot within an in-process ring queue */
+typedef struct
+{
+    size_t size;
+    uint8  data[OS_QUEUE_RING_MAX_MSG_SIZE];
+} OS_impl_queue_ring_entry_t;
+
+/* In-process ring queue, used for queues with small messages */
+typedef struct
+{
+    pthread_mutex_t            mutex;
+    pthread_cond_t             not_empty;
+    uint32                     depth;
+    uint32                     head;
+    uint32                     count;
+    uint32                     waiters;
+    OS_impl_queue_ring_entry_t entry[OS_QUEUE_MAX_DEPTH];
+} OS_impl_queue_ring_t;
+
+#endif
 
 /* queues */
 typedef struct
 {
     mqd_t id;
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+    bool                 is_ring;
+    OS_impl_queue_ring_t ring;
+#endif
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
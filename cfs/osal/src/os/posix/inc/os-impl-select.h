@@ -33,4 +33,23 @@
 #include <sys/select.h>
 #include <sys/time.h>
 
+/*
+ * Linux provides epoll, which keeps the interest list of a persistent poll
+ * set in the kernel so a wait only costs in proportion to the ready streams.
+ * Other platforms use select() over the poll set members.
+ */
+#if defined(__linux__)
+#include <sys/epoll.h>
+#define OS_IMPL_POLLSET_EPOLL
+#endif
+
+/*
+ * Linux provides eventfd, a counter that is readable while nonzero,
+ * which backs the pollable event streams.
+ */
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#define OS_IMPL_SELECT_EVENTFD
+#endif
+
 #endif /* OS_IMPL_SELECT_H */
@@ -34,9 +34,20 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <sys/types.h>
+#include <sys/socket.h>
 
 #define OS_NETWORK_SUPPORTS_IPV6
 
+/*
+ * Linux provides sendmmsg()/recvmmsg() to transfer several datagrams with
+ * a single system call.  They are GNU extensions, so they are only used when
+ * the file is built with _GNU_SOURCE (see the posix CMakeLists.txt).
+ */
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#define OS_NETWORK_SUPPORTS_MMSG
+#define OS_IMPL_SOCKET_MMSG_MAX 32
+#endif
+
 /*
  * A full POSIX-compliant I/O layer should support using
  * nonblocking I/O calls in combination with select().
@@ -32,12 +32,23 @@
 #include <pthread.h>
 #include <signal.h>
 
+/*
+ * Linux can deliver simulated timebase ticks through a timerfd rather than
+ * a POSIX timer and RT signal.  This is not limited by the number of RT
+ * signals, and each read reports how many expirations occurred, so
+ * overruns are not lost to signal coalescing.
+ */
+#if defined(__linux__)
+#define OS_POSIX_TIMEBASE_USE_TIMERFD
+#endif
+
 typedef struct
 {
     pthread_t       handler_thread;
     pthread_mutex_t handler_mutex;
     timer_t         host_timerid;
     int             assigned_signal;
+    int             timer_fd;
     sigset_t        sigset;
     sig_atomic_t    reset_flag;
     struct timespec softsleep;
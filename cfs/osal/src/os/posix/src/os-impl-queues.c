@@ -39,6 +39,194 @@
 /* Tables where the OS object information is stored */
 OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+
+/****************************************************************************************
+                                IN-PROCESS RING QUEUES
+ ***************************************************************************************/
+
+/*
+ * Queues with small messages (e.g. the pointer-sized descriptors passed through
+ * cFE software bus pipes) are kept in a ring buffer in process memory rather
+ * than a kernel message queue.
+ *
+ * The ring is protected by a pthread mutex, and readers that need to block wait
+ * on a condition variable.  On Linux both of these are futex-based, so neither a
+ * put nor a get enters the kernel unless the mutex is contended or a reader is
+ * actually sleeping on an empty queue.  The condition is only signaled when there
+ * is a waiter, so a put to a queue that is not being waited on is never a syscall.
+ */
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for releasing the mutex in case the thread
+ * executing pthread_cond_wait() is canceled.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueRingReleaseMutex(void *mut)
+{
+    pthread_mutex_unlock(mut);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to set up an in-process ring queue
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingCreate(OS_impl_queue_ring_t *ring, osal_blockcount_t depth)
+{
+    int ret;
+
+    ret = pthread_mutex_init(&ring->mutex, NULL);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error: pthread_mutex_init failed: %s\n", strerror(ret));
+        return OS_ERROR;
+    }
+
+    ret = pthread_cond_init(&ring->not_empty, NULL);
+    if (ret != 0)
+    {
+        OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
+        pthread_mutex_destroy(&ring->mutex);
+        return OS_ERROR;
+    }
+
+    ring->depth   = depth;
+    ring->head    = 0;
+    ring->count   = 0;
+    ring->waiters = 0;
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to get a message from an in-process ring queue
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingGet(OS_impl_queue_ring_t *ring, void *data, size_t *size_copied, int32 timeout)
+{
+    int32                       return_code;
+    int                         wait_status;
+    struct timespec             ts;
+    OS_impl_queue_ring_entry_t *entry;
+
+    memset(&ts, 0, sizeof(ts));
+    if (timeout > 0)
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+    }
+
+    if (pthread_mutex_lock(&ring->mutex) != 0)
+    {
+        *size_copied = OSAL_SIZE_C(0);
+        return OS_ERROR;
+    }
+
+    /* because pthread_cond_wait() is also a cancellation point,
+     * this uses a cleanup handler to ensure that if canceled during this call,
+     * the mutex is also released */
+    pthread_cleanup_push(OS_Posix_QueueRingReleaseMutex, &ring->mutex);
+
+    return_code = OS_SUCCESS;
+    wait_status = 0;
+
+    while (ring->count == 0)
+    {
+        if (timeout == OS_CHECK)
+        {
+            return_code = OS_QUEUE_EMPTY;
+            break;
+        }
+
+        if (wait_status == ETIMEDOUT)
+        {
+            return_code = OS_QUEUE_TIMEOUT;
+            break;
+        }
+
+        ++ring->waiters;
+        if (timeout == OS_PEND)
+        {
+            pthread_cond_wait(&ring->not_empty, &ring->mutex);
+        }
+        else
+        {
+            wait_status = pthread_cond_timedwait(&ring->not_empty, &ring->mutex, &ts);
+        }
+        --ring->waiters;
+    }
+
+    if (return_code == OS_SUCCESS)
+    {
+        entry = &ring->entry[ring->head];
+        memcpy(data, entry->data, entry->size);
+        *size_copied = entry->size;
+
+        ++ring->head;
+        if (ring->head >= ring->depth)
+        {
+            ring->head = 0;
+        }
+        --ring->count;
+    }
+    else
+    {
+        *size_copied = OSAL_SIZE_C(0);
+    }
+
+    /*
+     * Pop the cleanup handler.
+     * Passing "true" means it will be executed, which
+     * handles releasing the mutex.
+     */
+    pthread_cleanup_pop(true);
+
+    return return_code;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to put a message into an in-process ring queue
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingPut(OS_impl_queue_ring_t *ring, const void *data, size_t size)
+{
+    int32                       return_code;
+    uint32                      tail;
+    OS_impl_queue_ring_entry_t *entry;
+
+    if (pthread_mutex_lock(&ring->mutex) != 0)
+    {
+        return OS_ERROR;
+    }
+
+    if (ring->count >= ring->depth)
+    {
+        return_code = OS_QUEUE_FULL;
+    }
+    else
+    {
+        tail = ring->head + ring->count;
+        if (tail >= ring->depth)
+        {
+            tail -= ring->depth;
+        }
+
+        entry       = &ring->entry[tail];
+        entry->size = size;
+        memcpy(entry->data, data, size);
+        ++ring->count;
+
+        /* Only wake a reader if one is actually waiting */
+        if (ring->waiters > 0)
+        {
+            pthread_cond_signal(&ring->not_empty);
+        }
+
+        return_code = OS_SUCCESS;
+    }
+
+    pthread_mutex_unlock(&ring->mutex);
+
+    return return_code;
+}
+
+#endif /* OS_QUEUE_RING_MAX_MSG_SIZE > 0 */
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
@@ -93,6 +281,15 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
     queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
 
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+    /* Small messages are kept in process memory rather than a kernel queue */
+    impl->is_ring = (queue->max_size <= OS_QUEUE_RING_MAX_MSG_SIZE);
+    if (impl->is_ring)
+    {
+        return OS_Posix_QueueRingCreate(&impl->ring, queue->max_depth);
+    }
+#endif
+
     /* set queue attributes */
     memset(&queueAttr, 0, sizeof(queueAttr));
     queueAttr.mq_maxmsg  = queue->max_depth;
@@ -171,6 +368,16 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+    if (impl->is_ring)
+    {
+        pthread_cond_destroy(&impl->ring.not_empty);
+        pthread_mutex_destroy(&impl->ring.mutex);
+        impl->is_ring = false;
+        return OS_SUCCESS;
+    }
+#endif
+
     /* Try to delete and unlink the queue */
     if (mq_close(impl->id) != 0)
     {
@@ -202,6 +409,13 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+    if (impl->is_ring)
+    {
+        return OS_Posix_QueueRingGet(&impl->ring, data, size_copied, timeout);
+    }
+#endif
+
     /*
      ** Read the message queue for data
      */
@@ -301,6 +515,13 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#if OS_QUEUE_RING_MAX_MSG_SIZE > 0
+    if (impl->is_ring)
+    {
+        return OS_Posix_QueueRingPut(&impl->ring, data, size);
+    }
+#endif
+
     /*
      * NOTE - using a zero timeout here for the same reason that QueueGet does ---
      * checking the attributes and doing the actual send is non-atomic, and if
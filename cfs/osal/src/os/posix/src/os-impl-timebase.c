@@ -28,6 +28,9 @@
  * This implementation depends on the POSIX Timer API which may not be available
  * in older versions of the Linux kernel. It was developed and tested on
  * RHEL 5 ./ CentOS 5 with Linux kernel 2.6.18
+ *
+ * On Linux the simulated tick is generated with a timerfd instead (see
+ * OS_POSIX_TIMEBASE_USE_TIMERFD), which does not consume RT signals.
  */
 
 /****************************************************************************************
@@ -42,6 +45,10 @@
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
 
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+#include <sys/timerfd.h>
+#endif
+
 /****************************************************************************************
                                 EXTERNAL FUNCTION PROTOTYPES
  ***************************************************************************************/
@@ -135,6 +142,7 @@ void OS_TimeBaseUnlock_Impl(const OS_object_token_t *token)
     pthread_mutex_unlock(&impl->handler_mutex);
 } /* end OS_TimeBaseUnlock_Impl */
 
+#ifndef OS_POSIX_TIMEBASE_USE_TIMERFD
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBase_SoftWaitImpl
@@ -190,6 +198,72 @@ static uint32 OS_TimeBase_SigWaitImpl(osal_id_t obj_id)
     return interval_time;
 } /* end OS_TimeBase_SoftWaitImpl */
 
+#else
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_TimerFdWaitImpl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits for the timerfd and converts the expiration count to ticks.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_TimerFdWaitImpl(osal_id_t obj_id)
+{
+    ssize_t                             ret;
+    OS_object_token_t                   token;
+    OS_impl_timebase_internal_record_t *impl;
+    OS_timebase_internal_record_t *     timebase;
+    uint64                              expirations;
+    uint64                              interval_time;
+
+    interval_time = 0;
+
+    if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, obj_id, &token) == OS_SUCCESS)
+    {
+        impl     = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, token);
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, token);
+
+        ret = read(impl->timer_fd, &expirations, sizeof(expirations));
+
+        if (ret != sizeof(expirations) || expirations == 0)
+        {
+            /*
+             * the read was interrupted.
+             * returning 0 will cause the process to repeat.
+             */
+        }
+        else
+        {
+            if (impl->reset_flag != 0)
+            {
+                /*
+                 * Reset/First interval behavior.
+                 * The first expiration reflects the configured start time.
+                 */
+                interval_time    = timebase->nominal_start_time;
+                impl->reset_flag = 0;
+                --expirations;
+            }
+
+            /*
+             * Every further expiration is one nominal interval, including any
+             * the handler thread fell behind on, so overruns are reported as
+             * elapsed time rather than dropped.
+             */
+            interval_time += expirations * timebase->nominal_interval_time;
+
+            /* The callback thread keeps per-timer countdowns as int32 */
+            if (interval_time > INT32_MAX)
+            {
+                interval_time = INT32_MAX;
+            }
+        }
+    }
+
+    return (uint32)interval_time;
+} /* end OS_TimeBase_TimerFdWaitImpl */
+#endif
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
  ***************************************************************************************/
@@ -283,6 +357,8 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
                 return_code = OS_ERROR;
                 break;
             }
+
+            OS_impl_timebase_table[idx].timer_fd = -1;
         }
 
         /*
@@ -322,6 +398,147 @@ static void *OS_TimeBasePthreadEntry(void *arg)
     return NULL;
 }
 
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_TimerFdCreateImpl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Creates the timerfd that simulates the timer tick.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_TimeBase_TimerFdCreateImpl(OS_impl_timebase_internal_record_t *local)
+{
+    /*
+    ** Note using the "MONOTONIC" clock here as this will still produce consistent intervals
+    ** even if the system clock is stepped (e.g. clock_settime).
+    */
+    local->timer_fd = timerfd_create(OS_PREFERRED_CLOCK, TFD_CLOEXEC);
+    if (local->timer_fd < 0)
+    {
+        OS_DEBUG("Error in timerfd_create: %s\n", strerror(errno));
+        return OS_TIMER_ERR_UNAVAILABLE;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_TimeBase_TimerFdCreateImpl */
+#else
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_SignalCreateImpl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Assigns an RT signal and creates the POSIX timer that simulates the timer tick.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_TimeBase_SignalCreateImpl(const OS_object_token_t *token, OS_impl_timebase_internal_record_t *local)
+{
+    int32           return_code;
+    int             status;
+    int             i;
+    osal_index_t    idx;
+    struct sigevent evp;
+    struct timespec ts;
+
+    return_code = OS_SUCCESS;
+
+    sigemptyset(&local->sigset);
+
+    /*
+     * find an RT signal that is not used by another time base object.
+     * This is all done while the global lock is held so no chance of the
+     * underlying tables changing
+     */
+    for (idx = 0; idx < OS_MAX_TIMEBASES; ++idx)
+    {
+        if (OS_ObjectIdIsValid(OS_global_timebase_table[idx].active_id) &&
+            OS_impl_timebase_table[idx].assigned_signal != 0)
+        {
+            sigaddset(&local->sigset, OS_impl_timebase_table[idx].assigned_signal);
+        }
+    }
+
+    for (i = SIGRTMIN; i <= SIGRTMAX; ++i)
+    {
+        if (!sigismember(&local->sigset, i))
+        {
+            local->assigned_signal = i;
+            break;
+        }
+    }
+
+    do
+    {
+        if (local->assigned_signal == 0)
+        {
+            OS_DEBUG("No free RT signals to use for simulated time base\n");
+            return_code = OS_TIMER_ERR_UNAVAILABLE;
+            break;
+        }
+
+        sigemptyset(&local->sigset);
+        sigaddset(&local->sigset, local->assigned_signal);
+
+        /*
+         * Ensure that the chosen signal is NOT already pending.
+         *
+         * Perform a "sigtimedwait" with a zero timeout to poll the
+         * status of the selected signal.  RT signals are also queued,
+         * so this needs to be called in a loop to until sigtimedwait()
+         * returns an error.
+         *
+         * The max number of signals that can be queued is available
+         * via sysconf() as the _SC_SIGQUEUE_MAX value.
+         *
+         * The output is irrelevant here; the objective is to just ensure
+         * that the signal is not already pending.
+         */
+        i = sysconf(_SC_SIGQUEUE_MAX);
+        do
+        {
+            ts.tv_sec  = 0;
+            ts.tv_nsec = 0;
+            if (sigtimedwait(&local->sigset, NULL, &ts) < 0)
+            {
+                /* signal is NOT pending */
+                break;
+            }
+            --i;
+        } while (i > 0);
+
+        /*
+        **  Initialize the sigevent structures for the handler.
+        */
+        memset((void *)&evp, 0, sizeof(evp));
+        evp.sigev_notify = SIGEV_SIGNAL;
+        evp.sigev_signo  = local->assigned_signal;
+
+        /*
+         * Pass the Timer Index value of the object ID to the signal handler --
+         *  Note that the upper bits can be safely assumed as a timer ID to recreate the original,
+         *  and doing it this way should still work on a system where sizeof(sival_int) < sizeof(uint32)
+         *  (as long as sizeof(sival_int) >= number of bits in OS_OBJECT_INDEX_MASK)
+         */
+        evp.sigev_value.sival_int = (int)OS_ObjectIdToSerialNumber_Impl(OS_ObjectIdFromToken(token));
+
+        /*
+        ** Create the timer
+        ** Note using the "MONOTONIC" clock here as this will still produce consistent intervals
+        ** even if the system clock is stepped (e.g. clock_settime).
+        */
+        status = timer_create(OS_PREFERRED_CLOCK, &evp, &local->host_timerid);
+        if (status < 0)
+        {
+            return_code = OS_TIMER_ERR_UNAVAILABLE;
+            break;
+        }
+
+    } while (0);
+
+    return return_code;
+} /* end OS_TimeBase_SignalCreateImpl */
+#endif
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBaseCreate_Impl
@@ -333,11 +550,6 @@ static void *OS_TimeBasePthreadEntry(void *arg)
 int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
 {
     int32                               return_code;
-    int                                 status;
-    int                                 i;
-    osal_index_t                        idx;
-    struct sigevent                     evp;
-    struct timespec                     ts;
     OS_impl_timebase_internal_record_t *local;
     OS_timebase_internal_record_t *     timebase;
     OS_VoidPtrValueWrapper_t            arg;
@@ -365,6 +577,7 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
     }
 
     local->assigned_signal = 0;
+    local->timer_fd        = -1;
     clock_gettime(OS_PREFERRED_CLOCK, &local->softsleep);
 
     /*
@@ -378,99 +591,19 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
      */
     if (timebase->external_sync == NULL)
     {
-        sigemptyset(&local->sigset);
-
-        /*
-         * find an RT signal that is not used by another time base object.
-         * This is all done while the global lock is held so no chance of the
-         * underlying tables changing
-         */
-        for (idx = 0; idx < OS_MAX_TIMEBASES; ++idx)
-        {
-            if (OS_ObjectIdIsValid(OS_global_timebase_table[idx].active_id) &&
-                OS_impl_timebase_table[idx].assigned_signal != 0)
-            {
-                sigaddset(&local->sigset, OS_impl_timebase_table[idx].assigned_signal);
-            }
-        }
-
-        for (i = SIGRTMIN; i <= SIGRTMAX; ++i)
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+        return_code = OS_TimeBase_TimerFdCreateImpl(local);
+        if (return_code == OS_SUCCESS)
         {
-            if (!sigismember(&local->sigset, i))
-            {
-                local->assigned_signal = i;
-                break;
-            }
+            timebase->external_sync = OS_TimeBase_TimerFdWaitImpl;
         }
-
-        do
+#else
+        return_code = OS_TimeBase_SignalCreateImpl(token, local);
+        if (return_code == OS_SUCCESS)
         {
-            if (local->assigned_signal == 0)
-            {
-                OS_DEBUG("No free RT signals to use for simulated time base\n");
-                return_code = OS_TIMER_ERR_UNAVAILABLE;
-                break;
-            }
-
-            sigemptyset(&local->sigset);
-            sigaddset(&local->sigset, local->assigned_signal);
-
-            /*
-             * Ensure that the chosen signal is NOT already pending.
-             *
-             * Perform a "sigtimedwait" with a zero timeout to poll the
-             * status of the selected signal.  RT signals are also queued,
-             * so this needs to be called in a loop to until sigtimedwait()
-             * returns an error.
-             *
-             * The max number of signals that can be queued is available
-             * via sysconf() as the _SC_SIGQUEUE_MAX value.
-             *
-             * The output is irrelevant here; the objective is to just ensure
-             * that the signal is not already pending.
-             */
-            i = sysconf(_SC_SIGQUEUE_MAX);
-            do
-            {
-                ts.tv_sec  = 0;
-                ts.tv_nsec = 0;
-                if (sigtimedwait(&local->sigset, NULL, &ts) < 0)
-                {
-                    /* signal is NOT pending */
-                    break;
-                }
-                --i;
-            } while (i > 0);
-
-            /*
-            **  Initialize the sigevent structures for the handler.
-            */
-            memset((void *)&evp, 0, sizeof(evp));
-            evp.sigev_notify = SIGEV_SIGNAL;
-            evp.sigev_signo  = local->assigned_signal;
-
-            /*
-             * Pass the Timer Index value of the object ID to the signal handler --
-             *  Note that the upper bits can be safely assumed as a timer ID to recreate the original,
-             *  and doing it this way should still work on a system where sizeof(sival_int) < sizeof(uint32)
-             *  (as long as sizeof(sival_int) >= number of bits in OS_OBJECT_INDEX_MASK)
-             */
-            evp.sigev_value.sival_int = (int)OS_ObjectIdToSerialNumber_Impl(OS_ObjectIdFromToken(token));
-
-            /*
-            ** Create the timer
-            ** Note using the "MONOTONIC" clock here as this will still produce consistent intervals
-            ** even if the system clock is stepped (e.g. clock_settime).
-            */
-            status = timer_create(OS_PREFERRED_CLOCK, &evp, &local->host_timerid);
-            if (status < 0)
-            {
-                return_code = OS_TIMER_ERR_UNAVAILABLE;
-                break;
-            }
-
             timebase->external_sync = OS_TimeBase_SigWaitImpl;
-        } while (0);
+        }
+#endif
     }
 
     if (return_code != OS_SUCCESS)
@@ -503,13 +636,21 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
     int32                               return_code;
     int                                 status;
     OS_timebase_internal_record_t *     timebase;
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+    struct itimerspec deadline;
+    struct timespec   now;
+#endif
 
     local       = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
     timebase    = OS_OBJECT_TABLE_GET(OS_timebase_table, *token);
     return_code = OS_SUCCESS;
 
     /* There is only something to do here if we are generating a simulated tick */
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+    if (local->timer_fd >= 0)
+#else
     if (local->assigned_signal != 0)
+#endif
     {
         /*
         ** Convert from Microseconds to timespec structures
@@ -518,12 +659,34 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
         OS_UsecToTimespec(start_time, &timeout.it_value);
         OS_UsecToTimespec(interval_time, &timeout.it_interval);
 
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+        /*
+        ** Program the first expiry as an absolute deadline, so the time spent
+        ** getting here does not shift the whole schedule.  A zero start time
+        ** still disarms the timer.
+        */
+        deadline = timeout;
+        if (deadline.it_value.tv_sec != 0 || deadline.it_value.tv_nsec != 0)
+        {
+            clock_gettime(OS_PREFERRED_CLOCK, &now);
+            deadline.it_value.tv_sec += now.tv_sec;
+            deadline.it_value.tv_nsec += now.tv_nsec;
+            if (deadline.it_value.tv_nsec >= 1000000000)
+            {
+                deadline.it_value.tv_nsec -= 1000000000;
+                ++deadline.it_value.tv_sec;
+            }
+        }
+
+        status = timerfd_settime(local->timer_fd, TFD_TIMER_ABSTIME, &deadline, NULL);
+#else
         /*
         ** Program the real timer
         */
         status = timer_settime(local->host_timerid, 0, /* Flags field can be zero */
                                &timeout,               /* struct itimerspec */
                                NULL);                  /* Oldvalue */
+#endif
 
         if (status < 0)
         {
@@ -564,6 +727,14 @@ int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
     /*
     ** Delete the timer
     */
+#ifdef OS_POSIX_TIMEBASE_USE_TIMERFD
+    if (local->timer_fd >= 0)
+    {
+        close(local->timer_fd);
+        local->timer_fd = -1;
+    }
+#endif
+
     if (local->assigned_signal != 0)
     {
         status = timer_delete(local->host_timerid);
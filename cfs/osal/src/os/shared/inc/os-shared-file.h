@@ -101,6 +101,20 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
  ------------------------------------------------------------------*/
 int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, int32 timeout);
 
+/*----------------------------------------------------------------
+   Function: OS_GenericCopyRange_Impl
+
+    Purpose: Copy data between two file descriptors without a user buffer
+             Copies up to nbytes from the current position of src to
+             the current position of dest, and may copy fewer.
+
+    Returns: OS_SUCCESS with the count in bytes_copied (zero at end of file),
+             OS_ERR_NOT_IMPLEMENTED if the OS cannot do this for these files,
+             or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_GenericCopyRange_Impl(const OS_object_token_t *dest_token, const OS_object_token_t *src_token, size_t nbytes,
+                               size_t *bytes_copied);
+
 /*----------------------------------------------------------------
    Function: OS_GenericClose_Impl
 
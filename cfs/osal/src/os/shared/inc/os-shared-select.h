@@ -78,4 +78,93 @@ int32 OS_SelectSingle_Impl(const OS_object_token_t *token, uint32 *SelectFlags,
  ------------------------------------------------------------------*/
 int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
 
+/*----------------------------------------------------------------
+
+   Function: OS_PollSetCreate_Impl
+
+   Purpose: Allocates the OS resource (if any) behind a persistent poll set
+            and stores it in "impl_handle"
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(OS_PollSet *Set);
+
+/*----------------------------------------------------------------
+
+   Function: OS_PollSetDelete_Impl
+
+   Purpose: Releases the OS resource (if any) behind a persistent poll set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(OS_PollSet *Set);
+
+/*----------------------------------------------------------------
+
+   Function: OS_PollSetAdd_Impl
+
+   Purpose: Registers a file handle with a poll set, or updates the
+            states it is registered for.  The shared layer updates the
+            member sets after this returns successfully.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the specified file handle does not support select
+ ------------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(OS_PollSet *Set, const OS_object_token_t *token, uint32 StateFlags);
+
+/*----------------------------------------------------------------
+
+   Function: OS_PollSetRemove_Impl
+
+   Purpose: Unregisters a file handle from a poll set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(OS_PollSet *Set, const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+   Function: OS_PollSetWait_Impl
+
+   Purpose: Waits for activity on the members of a poll set.
+            Time-Limited to "msecs" (negative to wait forever, zero to poll)
+            The output sets are always non-NULL and cleared by the caller.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERROR_TIMEOUT if no member had activity
+ ------------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+
+/*----------------------------------------------------------------
+
+   Function: OS_SelectEventCreate_Impl
+
+   Purpose: Opens the OS primitive behind a pollable event stream and
+            stores it in the file handle table
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_NOT_IMPLEMENTED if the platform has no such primitive
+ ------------------------------------------------------------------*/
+int32 OS_SelectEventCreate_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+   Function: OS_SelectEventSignal_Impl
+
+   Purpose: Makes an event stream readable
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SelectEventSignal_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+   Function: OS_SelectEventClear_Impl
+
+   Purpose: Returns an event stream to the non-readable state
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SelectEventClear_Impl(const OS_object_token_t *token);
+
 #endif /* OS_SHARED_SELECT_H */
@@ -98,6 +98,20 @@ int32 OS_SocketConnect_Impl(const OS_object_token_t *token, const OS_SockAddr_t
 int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr,
                              int32 timeout);
 
+/*----------------------------------------------------------------
+   Function: OS_SocketRecvFromMulti_Impl
+
+    Purpose: Receives up to "BufCount" datagrams from the specified socket (must be of the DATAGRAM type)
+             Each datagram is stored in the buffer of the next entry of "BufArray" and its
+             length is stored in the entry's RecvLen
+             Will wait up to "timeout" milliseconds for the first datagram
+             (zero to poll, negative to wait forever), the rest are only taken if already queued
+
+    Returns: Count of datagrams received, or relevant error code if none were received
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockRecvBuf_t *BufArray, uint32 BufCount,
+                                  int32 timeout);
+
 /*----------------------------------------------------------------
    Function: OS_SocketSendTo_Impl
 
@@ -110,6 +124,18 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
                            const OS_SockAddr_t *RemoteAddr);
 
+/*----------------------------------------------------------------
+   Function: OS_SocketSendToMulti_Impl
+
+    Purpose: Sends "BufCount" datagrams from the specified socket (must be of the DATAGRAM type)
+             to the remote address specified by "RemoteAddr"
+             Each datagram is described by an entry of "BufArray"
+
+    Returns: Count of datagrams sent, or relevant error code if none could be sent
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, const OS_SockBuf_t *BufArray, uint32 BufCount,
+                                const OS_SockAddr_t *RemoteAddr);
+
 /*----------------------------------------------------------------
 
    Function: OS_SocketGetInfo_Impl
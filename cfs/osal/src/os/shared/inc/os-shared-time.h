@@ -40,8 +40,10 @@ typedef struct
     char              timer_name[OS_MAX_API_NAME];
     uint32            flags;
     OS_object_token_t timebase_token;
-    osal_id_t         prev_cb;
-    osal_id_t         next_cb;
+    osal_id_t         prev_cb;     /* timing wheel bucket linkage */
+    osal_id_t         next_cb;     /* timing wheel bucket linkage */
+    uint32            wheel_pos;   /* bucket index + 1, or 0 when not scheduled */
+    uint64            expire_time; /* absolute expiry, in timebase wheel time */
     uint32            backlog_resets;
     int32             wait_time;
     int32             interval_time;
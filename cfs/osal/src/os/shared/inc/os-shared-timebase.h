@@ -31,15 +31,29 @@
 #include "osapi-timebase.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * Geometry of the hierarchical timing wheel that holds the timer callbacks
+ * of each time base.  Level 0 slots are 2^OS_TIMEBASE_WHEEL_RES_BITS usec wide
+ * and each further level is OS_TIMEBASE_WHEEL_SLOTS times coarser, so the four
+ * levels span 2^34 usec, which covers any valid OS_TimerSet() value.
+ */
+#define OS_TIMEBASE_WHEEL_RES_BITS  10
+#define OS_TIMEBASE_WHEEL_SLOT_BITS 6
+#define OS_TIMEBASE_WHEEL_SLOTS     (1 << OS_TIMEBASE_WHEEL_SLOT_BITS)
+#define OS_TIMEBASE_WHEEL_LEVELS    4
+
 typedef struct
 {
     char           timebase_name[OS_MAX_API_NAME];
     OS_TimerSync_t external_sync;
     uint32         accuracy_usec;
-    osal_id_t      first_cb;
     uint32         freerun_time;
     uint32         nominal_start_time;
     uint32         nominal_interval_time;
+    uint64         wheel_time;  /* total elapsed time processed, never wraps */
+    uint64         wheel_clock; /* level 0 slot number of wheel_time */
+    uint32         wheel_count; /* number of callbacks currently scheduled */
+    osal_id_t      wheel[OS_TIMEBASE_WHEEL_LEVELS * OS_TIMEBASE_WHEEL_SLOTS];
 } OS_timebase_internal_record_t;
 
 /*
@@ -131,6 +145,33 @@ int32 OS_TimeBaseGetInfo_Impl(const OS_object_token_t *token, OS_timebase_prop_t
  ------------------------------------------------------------------*/
 void OS_TimeBase_CallbackThread(osal_id_t timebase_id);
 
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_ProcessTick
+
+    Purpose: Advance the time base by one tick and invoke the callbacks of
+             every timer that expired during it.  Only the timing wheel
+             buckets passed over are visited, not every timer.
+             Caller must hold the time base lock.
+ ------------------------------------------------------------------*/
+void OS_TimeBase_ProcessTick(OS_timebase_internal_record_t *timebase, uint32 tick_time);
+
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_WheelInsert
+
+    Purpose: Schedule a timer callback to expire its wait_time usec after
+             the current time of the time base.  The callback must not
+             already be scheduled.  Caller must hold the time base lock.
+ ------------------------------------------------------------------*/
+void OS_TimeBase_WheelInsert(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id);
+
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_WheelRemove
+
+    Purpose: Unschedule a timer callback, if it is scheduled.
+             Caller must hold the time base lock.
+ ------------------------------------------------------------------*/
+void OS_TimeBase_WheelRemove(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id);
+
 /*----------------------------------------------------------------
    Function: OS_Milli2Ticks
 
@@ -67,12 +67,18 @@ enum
 OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
 
 /*
- * OS_cp copyblock size - in theory could be adjusted
- * to match page size for performance so providing a unique
- * define here.  Given a requirement/request could be transitioned
- * to a configuration parameter
+ * OS_FileCopyRange copyblock size, used only when the OS cannot copy the
+ * data in the kernel.  This is on the stack so it is kept to one page.
+ * Given a requirement/request could be transitioned to a configuration
+ * parameter
  */
-#define OS_CP_BLOCK_SIZE 512
+#define OS_CP_BLOCK_SIZE 4096
+
+/*
+ * Amount OS_cp asks OS_FileCopyRange for at a time.  There is no need to
+ * bound it for pacing, it only needs to fit comfortably in a size_t.
+ */
+#define OS_CP_CHUNK_SIZE 0x40000000
 
 /*----------------------------------------------------------------
  *
@@ -412,6 +418,109 @@ int32 OS_rename(const char *old, const char *new)
 
 } /* end OS_rename */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyRangeBuffered
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Copies through a buffer, for files that OS_GenericCopyRange_Impl
+ *           cannot handle.  Adds the number of bytes copied to *bytes_copied.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_FileCopyRangeBuffered(osal_id_t dest_fd, osal_id_t src_fd, size_t max_bytes, size_t *bytes_copied)
+{
+    int32  rd_size;
+    int32  wr_size;
+    int32  wr_total;
+    size_t block_size;
+    uint8  copyblock[OS_CP_BLOCK_SIZE];
+
+    while (max_bytes > 0)
+    {
+        block_size = sizeof(copyblock);
+        if (block_size > max_bytes)
+        {
+            block_size = max_bytes;
+        }
+
+        rd_size = OS_read(src_fd, copyblock, block_size);
+        if (rd_size <= 0)
+        {
+            return (rd_size < 0) ? rd_size : OS_SUCCESS;
+        }
+
+        wr_total = 0;
+        while (wr_total < rd_size)
+        {
+            wr_size = OS_write(dest_fd, &copyblock[wr_total], rd_size - wr_total);
+            if (wr_size < 0)
+            {
+                return wr_size;
+            }
+            wr_total += wr_size;
+            *bytes_copied += wr_size;
+        }
+
+        max_bytes -= rd_size;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_FileCopyRangeBuffered */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileCopyRange
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileCopyRange(osal_id_t dest_fd, osal_id_t src_fd, size_t max_bytes, size_t *bytes_copied)
+{
+    OS_object_token_t dest_token;
+    OS_object_token_t src_token;
+    int32             return_code;
+    size_t            chunk;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(bytes_copied);
+    OS_CHECK_SIZE(max_bytes);
+
+    *bytes_copied = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, src_fd, &src_token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, dest_fd, &dest_token);
+        if (return_code == OS_SUCCESS)
+        {
+            /* The kernel may copy less than asked for, so repeat until done or at EOF */
+            while (*bytes_copied < max_bytes)
+            {
+                chunk       = 0;
+                return_code = OS_GenericCopyRange_Impl(&dest_token, &src_token, max_bytes - *bytes_copied, &chunk);
+                if (return_code != OS_SUCCESS || chunk == 0)
+                {
+                    break;
+                }
+                *bytes_copied += chunk;
+            }
+
+            OS_ObjectIdRelease(&dest_token);
+        }
+
+        OS_ObjectIdRelease(&src_token);
+    }
+
+    /* Both file positions are where the kernel left off, so the buffered copy carries on from there */
+    if (return_code == OS_ERR_NOT_IMPLEMENTED)
+    {
+        return_code = OS_FileCopyRangeBuffered(dest_fd, src_fd, max_bytes - *bytes_copied, bytes_copied);
+    }
+
+    return return_code;
+} /* end OS_FileCopyRange */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_cp
@@ -423,12 +532,9 @@ int32 OS_rename(const char *old, const char *new)
 int32 OS_cp(const char *src, const char *dest)
 {
     int32     return_code;
-    int32     rd_size;
-    int32     wr_size;
-    int32     wr_total;
+    size_t    copied;
     osal_id_t file1;
     osal_id_t file2;
-    uint8     copyblock[OS_CP_BLOCK_SIZE];
 
     /* Check Parameters */
     OS_CHECK_POINTER(src);
@@ -444,27 +550,11 @@ int32 OS_cp(const char *src, const char *dest)
 
     while (return_code == OS_SUCCESS)
     {
-        rd_size = OS_read(file1, copyblock, sizeof(copyblock));
-        if (rd_size < 0)
-        {
-            return_code = rd_size;
-            break;
-        }
-        if (rd_size == 0)
+        return_code = OS_FileCopyRange(file2, file1, OS_CP_CHUNK_SIZE, &copied);
+        if (copied == 0)
         {
             break;
         }
-        wr_total = 0;
-        while (wr_total < rd_size)
-        {
-            wr_size = OS_write(file2, &copyblock[wr_total], rd_size - wr_total);
-            if (wr_size < 0)
-            {
-                return_code = wr_size;
-                break;
-            }
-            wr_total += wr_size;
-        }
     }
 
     if (OS_ObjectIdDefined(file1))
@@ -126,6 +126,73 @@ OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 
+/*
+ * The active_id and refcount of a record are read and updated outside of the
+ * global table lock by the lookup fast path in OS_ObjectIdGetById(), so every
+ * access that has to be ordered against it goes through the helpers below.
+ *
+ * Sequential consistency is required: a lookup bumps the refcount and then
+ * checks the ID, while an EXCLUSIVE lock reserves the ID and then checks the
+ * refcount, and at least one of the two must see the other's store.
+ *
+ * Without the GNU atomic builtins every lookup takes the locked path.
+ */
+#if defined(__GNUC__)
+#define OS_IDMAP_LOCKFREE_LOOKUP
+#endif
+
+static inline osal_id_t OS_ObjectIdLoadActive(const OS_common_record_t *obj)
+{
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+    osal_id_t id;
+
+    __atomic_load(&obj->active_id, &id, __ATOMIC_SEQ_CST);
+    return id;
+#else
+    return obj->active_id;
+#endif
+}
+
+static inline void OS_ObjectIdStoreActive(OS_common_record_t *obj, osal_id_t id)
+{
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+    __atomic_store(&obj->active_id, &id, __ATOMIC_SEQ_CST);
+#else
+    obj->active_id = id;
+#endif
+}
+
+static inline uint16 OS_ObjectIdRefcountLoad(const OS_common_record_t *obj)
+{
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+    return __atomic_load_n(&obj->refcount, __ATOMIC_SEQ_CST);
+#else
+    return obj->refcount;
+#endif
+}
+
+static inline void OS_ObjectIdRefcountIncr(OS_common_record_t *obj)
+{
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+    __atomic_add_fetch(&obj->refcount, 1, __ATOMIC_SEQ_CST);
+#else
+    ++obj->refcount;
+#endif
+}
+
+static inline void OS_ObjectIdRefcountDecr(OS_common_record_t *obj)
+{
+    /* every holder only drops its own reference, so this cannot race below zero */
+    if (OS_ObjectIdRefcountLoad(obj) > 0)
+    {
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+        __atomic_sub_fetch(&obj->refcount, 1, __ATOMIC_SEQ_CST);
+#else
+        --obj->refcount;
+#endif
+    }
+}
+
 /*
  *********************************************************************************
  *          IDENTIFIER MAP / UNMAP FUNCTIONS
@@ -468,15 +535,15 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                  */
                 if (!OS_ObjectIdEqual(expected_id, OS_OBJECT_ID_RESERVED))
                 {
-                    expected_id    = OS_OBJECT_ID_RESERVED;
-                    obj->active_id = expected_id;
+                    expected_id = OS_OBJECT_ID_RESERVED;
+                    OS_ObjectIdStoreActive(obj, expected_id);
                 }
 
                 /*
                  * Also confirm that reference count is zero
                  * If not zero, will need to wait for other tasks to release.
                  */
-                if (obj->refcount == 0)
+                if (OS_ObjectIdRefcountLoad(obj) == 0)
                 {
                     return_code = OS_SUCCESS;
                     break;
@@ -531,7 +598,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
         {
             /* always increment the refcount, which means a task is actively
              * using or modifying this record. */
-            ++obj->refcount;
+            OS_ObjectIdRefcountIncr(obj);
 
             /*
              * On a successful operation, the global is unlocked if it is
@@ -556,7 +623,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
              * it back to the original value which is in the token.
              * (note it had to match initially before overwrite)
              */
-            obj->active_id = OS_ObjectIdFromToken(token);
+            OS_ObjectIdStoreActive(obj, OS_ObjectIdFromToken(token));
         }
     }
 
@@ -680,11 +747,14 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
         token->obj_idx = OSAL_INDEX_C(local_id);
         OS_ObjectIdCompose_Impl(token->obj_type, serial, &token->obj_id);
 
-        /* Ensure any data in the record has been cleared */
-        obj->active_id  = token->obj_id;
+        /*
+         * Ensure any data in the record has been cleared.  The refcount of a
+         * free slot is already zero; it is not reset here because a lock-free
+         * lookup with a stale ID may hold a transient reference it is about to drop.
+         */
+        OS_ObjectIdStoreActive(obj, token->obj_id);
         obj->name_entry = NULL;
         obj->creator    = OS_TaskGetId();
-        obj->refcount   = 0;
 
         /* preemptively update the last id issued */
         objtype_state->last_id_issued = token->obj_id;
@@ -1043,6 +1113,90 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
 
 } /* end OS_ObjectIdFindByName */
 
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdRefcountRelease
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Drop a reference without holding the global table lock.
+ *
+ *           An EXCLUSIVE locker that found this reference outstanding has
+ *           already reserved the ID and is waiting on a state change of the
+ *           table, so in that case cycle the table lock to wake it.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdRefcountRelease(OS_object_token_t *token, OS_common_record_t *record)
+{
+    OS_ObjectIdRefcountDecr(record);
+
+    if (OS_ObjectIdEqual(OS_ObjectIdLoadActive(record), OS_OBJECT_ID_RESERVED))
+    {
+        OS_Lock_Global(token);
+        OS_Unlock_Global(token);
+    }
+} /* end OS_ObjectIdRefcountRelease */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdGetByIdFast
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Lock-free lookup for OS_LOCK_MODE_NONE and OS_LOCK_MODE_REFCOUNT,
+ *           covering the nominal case where OSAL is running and the ID is live.
+ *
+ *           The ID maps directly to its table slot.  For REFCOUNT the reference
+ *           is taken before the ID in the slot is confirmed, so a concurrent
+ *           EXCLUSIVE lock either sees the reference and waits for it, or has
+ *           already reserved the slot and this lookup backs out again.  A slot
+ *           that is reused for a new object gets a new ID, so the serial number
+ *           in the ID acts as the generation check.
+ *
+ *  Returns: true if the token is valid, or false if the caller must
+ *           repeat the lookup on the locked path
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_ObjectIdGetByIdFast(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_id_t id,
+                                   OS_object_token_t *token)
+{
+    OS_common_record_t *obj;
+    osal_index_t        obj_idx;
+
+    if (OS_SharedGlobalVars.GlobalState != OS_INIT_MAGIC_NUMBER || idtype == OS_OBJECT_TYPE_UNDEFINED ||
+        OS_ObjectIdToArrayIndex(idtype, id, &obj_idx) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    memset(token, 0, sizeof(*token));
+    token->lock_mode = lock_mode;
+    token->obj_type  = idtype;
+    token->obj_idx   = obj_idx;
+    token->obj_id    = id;
+
+    obj = OS_ObjectIdGlobalFromToken(token);
+
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT)
+    {
+        OS_ObjectIdRefcountIncr(obj);
+    }
+
+    if (OS_ObjectIdEqual(OS_ObjectIdLoadActive(obj), id))
+    {
+        return true;
+    }
+
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT)
+    {
+        OS_ObjectIdRefcountRelease(token, obj);
+    }
+
+    token->lock_mode = OS_LOCK_MODE_NONE;
+
+    return false;
+} /* end OS_ObjectIdGetByIdFast */
+#endif
+
 /*----------------------------------------------------------------
  *
  * Function: OS_ObjectIdGetById
@@ -1063,6 +1217,19 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
 {
     int32 return_code;
 
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+    /*
+     * Lookups that do not need the global table held are done without locking.
+     * Anything unusual (not running, bad ID, object being created or deleted)
+     * falls through to the locked path, which sorts out the proper status.
+     */
+    if ((lock_mode == OS_LOCK_MODE_NONE || lock_mode == OS_LOCK_MODE_REFCOUNT) &&
+        OS_ObjectIdGetByIdFast(lock_mode, idtype, id, token))
+    {
+        return OS_SUCCESS;
+    }
+#endif
+
     return_code = OS_ObjectIdTransactionInit(lock_mode, idtype, token);
     if (return_code != OS_SUCCESS)
     {
@@ -1119,16 +1286,23 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
 
     record = OS_ObjectIdGlobalFromToken(token);
 
+#ifdef OS_IDMAP_LOCKFREE_LOOKUP
+    if (token->lock_mode == OS_LOCK_MODE_REFCOUNT && final_id == NULL)
+    {
+        /* a plain reference is dropped without the global table lock */
+        OS_ObjectIdRefcountRelease(token, record);
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return;
+    }
+#endif
+
     /* re-acquire global table lock to adjust refcount */
     if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE || token->lock_mode == OS_LOCK_MODE_REFCOUNT)
     {
         OS_Lock_Global(token);
     }
 
-    if (record->refcount > 0)
-    {
-        --record->refcount;
-    }
+    OS_ObjectIdRefcountDecr(record);
 
     /*
      * at this point the global mutex is always held, either
@@ -1140,7 +1314,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
      */
     if (final_id != NULL)
     {
-        record->active_id = *final_id;
+        OS_ObjectIdStoreActive(record, *final_id);
     }
     else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
     {
@@ -1149,7 +1323,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
          * was reset to OS_OBJECT_ID_RESERVED.  This must restore the original
          * object ID from the token.
          */
-        record->active_id = token->obj_id;
+        OS_ObjectIdStoreActive(record, token->obj_id);
     }
 
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
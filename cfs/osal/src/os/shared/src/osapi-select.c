@@ -41,6 +41,7 @@
 /*
  * User defined include files
  */
+#include "os-shared-file.h"
 #include "os-shared-idmap.h"
 #include "os-shared-select.h"
 
@@ -211,3 +212,258 @@ bool OS_SelectFdIsSet(OS_FdSet *Set, osal_id_t objid)
      */
     return ((Set->object_ids[local_id >> 3] >> (local_id & 0x7)) & 0x1);
 } /* end OS_SelectFdIsSet */
+
+/*
+ *********************************************************************************
+ *          PERSISTENT POLL SET API
+ *********************************************************************************
+ */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetCreate
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate(OS_PollSet *Set)
+{
+    /* check parameters */
+    OS_CHECK_POINTER(Set);
+
+    memset(Set, 0, sizeof(OS_PollSet));
+    Set->impl_handle = -1;
+
+    return OS_PollSetCreate_Impl(Set);
+} /* end OS_PollSetCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetDelete
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete(OS_PollSet *Set)
+{
+    int32 return_code;
+
+    /* check parameters */
+    OS_CHECK_POINTER(Set);
+
+    return_code = OS_PollSetDelete_Impl(Set);
+    if (return_code == OS_SUCCESS)
+    {
+        memset(Set, 0, sizeof(OS_PollSet));
+        Set->impl_handle = -1;
+    }
+
+    return return_code;
+} /* end OS_PollSetDelete */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAdd
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd(OS_PollSet *Set, osal_id_t objid, uint32 StateFlags)
+{
+    int32             return_code;
+    OS_object_token_t token;
+    osal_index_t      local_id;
+
+    /* check parameters */
+    OS_CHECK_POINTER(Set);
+
+    if ((StateFlags & (OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE)) == 0)
+    {
+        return OS_ERROR;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSetAdd_Impl(Set, &token, StateFlags);
+        if (return_code == OS_SUCCESS)
+        {
+            /* Same bit layout as OS_SelectFdAdd() */
+            local_id = OS_ObjectIndexFromToken(&token);
+            Set->read_set.object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+            Set->write_set.object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+            if (StateFlags & OS_STREAM_STATE_READABLE)
+            {
+                Set->read_set.object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+            }
+            if (StateFlags & OS_STREAM_STATE_WRITABLE)
+            {
+                Set->write_set.object_ids[local_id >> 3] |= 1 << (local_id & 0x7);
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_PollSetAdd */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetRemove
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove(OS_PollSet *Set, osal_id_t objid)
+{
+    int32             return_code;
+    OS_object_token_t token;
+    osal_index_t      local_id;
+
+    /* check parameters */
+    OS_CHECK_POINTER(Set);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSetRemove_Impl(Set, &token);
+
+        /* Always drop the membership so a failed unregister cannot leave a stale entry */
+        local_id = OS_ObjectIndexFromToken(&token);
+        Set->read_set.object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+        Set->write_set.object_ids[local_id >> 3] &= ~(1 << (local_id & 0x7));
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_PollSetRemove */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetWait
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+{
+    OS_FdSet unused_set;
+
+    /* check parameters */
+    OS_CHECK_POINTER(Set);
+
+    /* Give the implementation somewhere to write results the caller did not ask for */
+    if (ReadSet == NULL)
+    {
+        ReadSet = &unused_set;
+    }
+    if (WriteSet == NULL)
+    {
+        WriteSet = &unused_set;
+    }
+
+    memset(ReadSet, 0, sizeof(OS_FdSet));
+    memset(WriteSet, 0, sizeof(OS_FdSet));
+
+    /*
+     * As with OS_SelectMultiple(), this does not hold refcounts on the
+     * members while waiting.
+     */
+    return OS_PollSetWait_Impl(Set, ReadSet, WriteSet, msecs);
+} /* end OS_PollSetWait */
+
+/*
+ *********************************************************************************
+ *          POLLABLE EVENT API
+ *********************************************************************************
+ */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventCreate
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventCreate(osal_id_t *event_id)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
+
+    /* check parameters */
+    OS_CHECK_POINTER(event_id);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_STREAM, NULL, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        /* An event is an anonymous stream, like a socket before it is bound */
+        memset(stream, 0, sizeof(OS_stream_internal_record_t));
+
+        return_code = OS_SelectEventCreate_Impl(&token);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, event_id);
+    }
+
+    return return_code;
+} /* end OS_SelectEventCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventSignal
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventSignal(osal_id_t event_id)
+{
+    int32             return_code;
+    OS_object_token_t token;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, event_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_SelectEventSignal_Impl(&token);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SelectEventSignal */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SelectEventClear
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SelectEventClear(osal_id_t event_id)
+{
+    int32             return_code;
+    OS_object_token_t token;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, event_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_SelectEventClear_Impl(&token);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SelectEventClear */
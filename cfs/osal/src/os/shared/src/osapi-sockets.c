@@ -390,6 +390,49 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
     return return_code;
 } /* end OS_SocketRecvFrom */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvFromMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockRecvBuf_t *BufArray, uint32 BufCount, int32 timeout)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(BufArray);
+    OS_CHECK_SIZE(BufCount);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else if ((stream->stream_state & OS_STREAM_STATE_BOUND) == 0)
+        {
+            /* Socket needs to be bound first */
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            return_code = OS_SocketRecvFromMulti_Impl(&token, BufArray, BufCount, timeout);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SocketRecvFromMulti */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketSendTo
@@ -429,6 +472,46 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return return_code;
 } /* end OS_SocketSendTo */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti(osal_id_t sock_id, const OS_SockBuf_t *BufArray, uint32 BufCount,
+                           const OS_SockAddr_t *RemoteAddr)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(BufArray);
+    OS_CHECK_SIZE(BufCount);
+    OS_CHECK_POINTER(RemoteAddr);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_SocketSendToMulti_Impl(&token, BufArray, BufCount, RemoteAddr);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SocketSendToMulti */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketGetIdByName
@@ -384,13 +384,10 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
 {
     OS_TimerSync_t                 syncfunc;
     OS_timebase_internal_record_t *timebase;
-    OS_timecb_internal_record_t *  timecb;
     OS_common_record_t *           record;
     OS_object_token_t              token;
-    OS_object_token_t              cb_token;
     uint32                         tick_time;
     uint32                         spin_cycles;
-    int32                          saved_wait_time;
 
     /*
      * Register this task as a time base handler.
@@ -475,57 +472,328 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
             break;
         }
 
-        timebase->freerun_time += tick_time;
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &cb_token) == 0)
+        OS_TimeBase_ProcessTick(timebase, tick_time);
+
+        OS_TimeBaseUnlock_Impl(&token);
+    }
+} /* end OS_TimeBase_CallbackThread */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_WheelGetCb
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Get the timer callback record for an ID linked on the wheel.
+ *
+ *           This is a plain index conversion rather than OS_ObjectIdGetById(),
+ *           as a timer being deleted is still linked until its timebase lock
+ *           is taken, and its neighbors must remain reachable until then.
+ *
+ *    Returns: The record, or NULL if the ID is not a timer callback
+ *
+ *-----------------------------------------------------------------*/
+static OS_timecb_internal_record_t *OS_TimeBase_WheelGetCb(osal_id_t timecb_id)
+{
+    osal_index_t idx;
+
+    if (!OS_ObjectIdDefined(timecb_id) ||
+        OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TIMECB, timecb_id, &idx) != OS_SUCCESS)
+    {
+        return NULL;
+    }
+
+    return &OS_timecb_table[idx];
+} /* end OS_TimeBase_WheelGetCb */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_WheelLink
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Link a timer callback into the wheel bucket matching its expire_time.
+ *
+ *           Entries due within OS_TIMEBASE_WHEEL_SLOTS level 0 slots of the wheel
+ *           clock go on level 0, those due within SLOTS^2 on level 1, and so on.
+ *           Higher level buckets are cascaded down as the clock reaches them.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_WheelLink(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id,
+                                  OS_timecb_internal_record_t *timecb)
+{
+    OS_timecb_internal_record_t *list_timecb;
+    uint64                       slot;
+    uint64                       delta;
+    uint32                       level;
+    uint32                       pos;
+
+    /*
+     * An entry is never due before the wheel clock, and a wait_time is always
+     * below 2^31 usec, so the delta always fits within the top level.
+     */
+    slot  = timecb->expire_time >> OS_TIMEBASE_WHEEL_RES_BITS;
+    delta = slot - timebase->wheel_clock;
+    level = 0;
+    while (level < (OS_TIMEBASE_WHEEL_LEVELS - 1) &&
+           delta >= ((uint64)1 << ((level + 1) * OS_TIMEBASE_WHEEL_SLOT_BITS)))
+    {
+        ++level;
+    }
+
+    pos = (level * OS_TIMEBASE_WHEEL_SLOTS) +
+          (uint32)((slot >> (level * OS_TIMEBASE_WHEEL_SLOT_BITS)) & (OS_TIMEBASE_WHEEL_SLOTS - 1));
+
+    timecb->prev_cb   = OS_OBJECT_ID_UNDEFINED;
+    timecb->next_cb   = timebase->wheel[pos];
+    timecb->wheel_pos = pos + 1;
+
+    list_timecb = OS_TimeBase_WheelGetCb(timecb->next_cb);
+    if (list_timecb != NULL)
+    {
+        list_timecb->prev_cb = timecb_id;
+    }
+
+    timebase->wheel[pos] = timecb_id;
+    ++timebase->wheel_count;
+} /* end OS_TimeBase_WheelLink */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_WheelUnlink
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Unlink a scheduled timer callback from its wheel bucket.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_WheelUnlink(OS_timebase_internal_record_t *timebase, OS_timecb_internal_record_t *timecb)
+{
+    OS_timecb_internal_record_t *list_timecb;
+
+    list_timecb = OS_TimeBase_WheelGetCb(timecb->prev_cb);
+    if (list_timecb != NULL)
+    {
+        list_timecb->next_cb = timecb->next_cb;
+    }
+    else
+    {
+        timebase->wheel[timecb->wheel_pos - 1] = timecb->next_cb;
+    }
+
+    list_timecb = OS_TimeBase_WheelGetCb(timecb->next_cb);
+    if (list_timecb != NULL)
+    {
+        list_timecb->prev_cb = timecb->prev_cb;
+    }
+
+    timecb->prev_cb   = OS_OBJECT_ID_UNDEFINED;
+    timecb->next_cb   = OS_OBJECT_ID_UNDEFINED;
+    timecb->wheel_pos = 0;
+    --timebase->wheel_count;
+} /* end OS_TimeBase_WheelUnlink */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_WheelInsert
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_WheelInsert(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id)
+{
+    OS_timecb_internal_record_t *timecb;
+
+    timecb = OS_TimeBase_WheelGetCb(timecb_id);
+    if (timecb != NULL && timecb->wheel_pos == 0)
+    {
+        timecb->expire_time = timebase->wheel_time + (uint32)timecb->wait_time;
+        OS_TimeBase_WheelLink(timebase, timecb_id, timecb);
+    }
+} /* end OS_TimeBase_WheelInsert */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_WheelRemove
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_WheelRemove(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id)
+{
+    OS_timecb_internal_record_t *timecb;
+
+    timecb = OS_TimeBase_WheelGetCb(timecb_id);
+    if (timecb != NULL && timecb->wheel_pos != 0)
+    {
+        OS_TimeBase_WheelUnlink(timebase, timecb);
+    }
+} /* end OS_TimeBase_WheelRemove */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_WheelAdvance
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Move the wheel clock up to the current wheel time, cascading the
+ *           higher level buckets it passes, and unlink every callback that
+ *           has expired by now.
+ *
+ *    Returns: The expired callbacks, chained through their next_cb links
+ *
+ *-----------------------------------------------------------------*/
+static osal_id_t OS_TimeBase_WheelAdvance(OS_timebase_internal_record_t *timebase)
+{
+    OS_timecb_internal_record_t *timecb;
+    osal_id_t                    expired_id;
+    osal_id_t                    timecb_id;
+    osal_id_t                    next_id;
+    uint64                       target;
+    uint32                       level;
+    uint32                       pos;
+
+    expired_id = OS_OBJECT_ID_UNDEFINED;
+    target     = timebase->wheel_time >> OS_TIMEBASE_WHEEL_RES_BITS;
+
+    while (1)
+    {
+        /*
+         * Everything in the current level 0 bucket is due within this slot,
+         * but if the slot is the one containing "now" some may not be due yet.
+         */
+        timecb_id = timebase->wheel[timebase->wheel_clock & (OS_TIMEBASE_WHEEL_SLOTS - 1)];
+        while ((timecb = OS_TimeBase_WheelGetCb(timecb_id)) != NULL)
         {
-            do
+            next_id = timecb->next_cb;
+            if (timecb->expire_time <= timebase->wheel_time)
             {
-                timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, cb_token);
-                saved_wait_time = timecb->wait_time;
-                timecb->wait_time -= tick_time;
-                while (timecb->wait_time <= 0)
-                {
-                    timecb->wait_time += timecb->interval_time;
-
-                    /*
-                     * Only allow the "wait_time" underflow to go as far negative as one interval time
-                     * This prevents a cb "interval_time" of less than the timebase interval_time from
-                     * accumulating infinitely
-                     */
-                    if (timecb->wait_time < -timecb->interval_time)
-                    {
-                        ++timecb->backlog_resets;
-                        timecb->wait_time = -timecb->interval_time;
-                    }
-
-                    /*
-                     * Only give the callback if the wait_time actually transitioned from positive to negative.
-                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
-                     * the "interval_time" at zero.  With the interval_time at zero the wait time will never
-                     * go positive again unless the API sets it again.
-                     */
-                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
-                    {
-                        (*timecb->callback_ptr)(OS_ObjectIdFromToken(&cb_token), timecb->callback_arg);
-                    }
-
-                    /*
-                     * Do not repeat the loop unless interval_time is configured.
-                     */
-                    if (timecb->interval_time <= 0)
-                    {
-                        break;
-                    }
-                }
-
-            } while (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->next_cb, &cb_token) ==
-                         OS_SUCCESS &&
-                     !OS_ObjectIdEqual(OS_ObjectIdFromToken(&cb_token), timebase->first_cb));
+                OS_TimeBase_WheelUnlink(timebase, timecb);
+                timecb->next_cb = expired_id;
+                expired_id      = timecb_id;
+            }
+            timecb_id = next_id;
         }
 
-        OS_TimeBaseUnlock_Impl(&token);
+        if (timebase->wheel_clock >= target)
+        {
+            break;
+        }
+
+        if (timebase->wheel_count == 0)
+        {
+            /* nothing left to find, so no need to step through the empty slots */
+            timebase->wheel_clock = target;
+            break;
+        }
+
+        ++timebase->wheel_clock;
+
+        /*
+         * Each time a level wraps, re-file the entries of the next level bucket
+         * that has now come within range of the level below.
+         */
+        for (level = 1; level < OS_TIMEBASE_WHEEL_LEVELS; ++level)
+        {
+            if ((timebase->wheel_clock & (((uint64)1 << (level * OS_TIMEBASE_WHEEL_SLOT_BITS)) - 1)) != 0)
+            {
+                break;
+            }
+
+            pos = (level * OS_TIMEBASE_WHEEL_SLOTS) +
+                  (uint32)((timebase->wheel_clock >> (level * OS_TIMEBASE_WHEEL_SLOT_BITS)) &
+                           (OS_TIMEBASE_WHEEL_SLOTS - 1));
+
+            timecb_id = timebase->wheel[pos];
+            while ((timecb = OS_TimeBase_WheelGetCb(timecb_id)) != NULL)
+            {
+                next_id = timecb->next_cb;
+                OS_TimeBase_WheelUnlink(timebase, timecb);
+                OS_TimeBase_WheelLink(timebase, timecb_id, timecb);
+                timecb_id = next_id;
+            }
+        }
     }
-} /* end OS_TimeBase_CallbackThread */
+
+    return expired_id;
+} /* end OS_TimeBase_WheelAdvance */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_ProcessTick
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_ProcessTick(OS_timebase_internal_record_t *timebase, uint32 tick_time)
+{
+    OS_timecb_internal_record_t *timecb;
+    osal_id_t                    expired_id;
+    osal_id_t                    timecb_id;
+    uint64                       prev_time;
+    int32                        saved_wait_time;
+
+    prev_time = timebase->wheel_time;
+
+    timebase->freerun_time += tick_time;
+    timebase->wheel_time += tick_time;
+
+    expired_id = OS_TimeBase_WheelAdvance(timebase);
+
+    while ((timecb = OS_TimeBase_WheelGetCb(expired_id)) != NULL)
+    {
+        timecb_id  = expired_id;
+        expired_id = timecb->next_cb;
+
+        /*
+         * Reconstruct the relative wait time as it was before and after this tick.
+         * An entry is only ever due at or after the time it was scheduled, so the
+         * "before" value is zero or positive and the "after" value is zero or negative.
+         */
+        saved_wait_time   = (int32)(timecb->expire_time - prev_time);
+        timecb->wait_time = (int32)(timecb->expire_time - timebase->wheel_time);
+        timecb->next_cb   = OS_OBJECT_ID_UNDEFINED;
+
+        while (timecb->wait_time <= 0)
+        {
+            timecb->wait_time += timecb->interval_time;
+
+            /*
+             * Only allow the "wait_time" underflow to go as far negative as one interval time
+             * This prevents a cb "interval_time" of less than the timebase interval_time from
+             * accumulating infinitely
+             */
+            if (timecb->wait_time < -timecb->interval_time)
+            {
+                ++timecb->backlog_resets;
+                timecb->wait_time = -timecb->interval_time;
+            }
+
+            /*
+             * Only give the callback if the wait_time actually transitioned from positive to negative.
+             * This allows one-shot operation where the API sets the "wait_time" positive but keeps
+             * the "interval_time" at zero.  With the interval_time at zero the timer is not
+             * rescheduled, so it will never expire again unless the API sets it again.
+             */
+            if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
+            {
+                (*timecb->callback_ptr)(timecb_id, timecb->callback_arg);
+            }
+
+            /*
+             * Do not repeat the loop unless interval_time is configured.
+             */
+            if (timecb->interval_time <= 0)
+            {
+                break;
+            }
+        }
+
+        if (timecb->interval_time > 0)
+        {
+            OS_TimeBase_WheelInsert(timebase, timecb_id);
+        }
+    }
+} /* end OS_TimeBase_ProcessTick */
 
 /*----------------------------------------------------------------
  *
@@ -35,6 +35,7 @@ void TestCreatRemove(void);
 void TestOpenClose(void);
 void TestChmod(void);
 void TestReadWriteLseek(void);
+void TestCopyRange(void);
 void TestMkRmDirFreeBytes(void);
 void TestOpenReadCloseDir(void);
 void TestRename(void);
@@ -81,6 +82,7 @@ void UtTest_Setup(void)
     UtTest_Add(TestOpenClose, NULL, NULL, "TestOpenClose");
     UtTest_Add(TestChmod, NULL, NULL, "TestChmod");
     UtTest_Add(TestReadWriteLseek, NULL, NULL, "TestReadWriteLseek");
+    UtTest_Add(TestCopyRange, NULL, NULL, "TestCopyRange");
     UtTest_Add(TestMkRmDirFreeBytes, NULL, NULL, "TestMkRmDirFreeBytes");
     UtTest_Add(TestOpenReadCloseDir, NULL, NULL, "TestOpenReadCloseDir");
     UtTest_Add(TestStat, NULL, NULL, "TestStat");
@@ -434,6 +436,78 @@ void TestReadWriteLseek(void)
     UtAssert_True(status == OS_SUCCESS, "status after remove = %d", (int)status);
 }
 
+/*---------------------------------------------------------------------------------------
+ *  Name TestCopyRange()
+---------------------------------------------------------------------------------------*/
+void TestCopyRange(void)
+{
+    const char *filename1 = "/drive0/CopySrc";
+    const char *filename2 = "/drive0/CopyDst";
+    uint8       pattern[256];
+    uint8       readbuf[256];
+    size_t      i;
+    size_t      copied;
+    size_t      total;
+    size_t      chunks;
+    uint32      mismatches;
+    int32       status;
+    osal_id_t   fd1;
+    osal_id_t   fd2;
+
+    /* 20000 bytes, so the last chunk is a partial one */
+    status = OS_OpenCreate(&fd1, filename1, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    UtAssert_True(status == OS_SUCCESS, "status after creat = %d", (int)status);
+    for (i = 0; i < sizeof(pattern); ++i)
+    {
+        pattern[i] = (uint8)(i * 7);
+    }
+    for (i = 0; i < 20000; i += 250)
+    {
+        UtAssert_INT32_EQ(OS_write(fd1, pattern, 250), 250);
+    }
+    UtAssert_INT32_EQ(OS_lseek(fd1, 0, OS_SEEK_SET), 0);
+
+    /* Copy in fixed chunks, each call picking up where the last ended */
+    status = OS_OpenCreate(&fd2, filename2, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    UtAssert_True(status == OS_SUCCESS, "status after creat = %d", (int)status);
+    total  = 0;
+    chunks = 0;
+    do
+    {
+        status = OS_FileCopyRange(fd2, fd1, 3000, &copied);
+        total += copied;
+        ++chunks;
+    } while (status == OS_SUCCESS && copied == 3000);
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_UINT32_EQ(total, 20000);
+    UtAssert_UINT32_EQ(chunks, 7);
+
+    /* Nothing left to copy */
+    UtAssert_INT32_EQ(OS_FileCopyRange(fd2, fd1, 3000, &copied), OS_SUCCESS);
+    UtAssert_UINT32_EQ(copied, 0);
+
+    UtAssert_INT32_EQ(OS_lseek(fd2, 0, OS_SEEK_SET), 0);
+    mismatches = 0;
+    for (i = 0; i < 20000; i += 250)
+    {
+        UtAssert_INT32_EQ(OS_read(fd2, readbuf, 250), 250);
+        if (memcmp(readbuf, pattern, 250) != 0)
+        {
+            ++mismatches;
+        }
+    }
+    UtAssert_UINT32_EQ(mismatches, 0);
+
+    UtAssert_INT32_EQ(OS_FileCopyRange(fd2, fd1, 3000, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_FileCopyRange(fd2, fd1, 0, &copied), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_FileCopyRange(fd2, OS_OBJECT_ID_UNDEFINED, 3000, &copied), OS_ERR_INVALID_ID);
+
+    UtAssert_INT32_EQ(OS_close(fd1), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_close(fd2), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_remove(filename1), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_remove(filename2), OS_SUCCESS);
+}
+
 /*---------------------------------------------------------------------------------------
  *  Name TestMkRmDir()
 ---------------------------------------------------------------------------------------*/
@@ -217,6 +217,9 @@ void TestDatagramNetworkApi(void)
         uint16           PortNum;
         OS_socket_prop_t prop;
         OS_SockAddr_t    l_addr;
+        OS_SockBuf_t     SendBufs[2];
+        OS_SockRecvBuf_t RecvBufs[3];
+        uint32           RecvData[3];
         int32            expected;
         int32            actual;
 
@@ -274,6 +277,54 @@ void TestDatagramNetworkApi(void)
         UtAssert_True(strcmp(AddrBuffer3, AddrBuffer4) == 0, "AddrBuffer3 (%s) == AddrBuffer4 (%s)", AddrBuffer3,
                       AddrBuffer4);
 
+        /*
+         * Send two datagrams from peer1 to peer2 in one call and verify
+         * they arrive separately and in order
+         */
+        SendBufs[0].Buffer = &Buf1;
+        SendBufs[0].BufLen = sizeof(Buf1);
+        SendBufs[1].Buffer = &Buf3;
+        SendBufs[1].BufLen = sizeof(Buf3);
+
+        expected = 2;
+        actual   = OS_SocketSendToMulti(p1_socket_id, SendBufs, 2, &p2_addr);
+        UtAssert_True(actual == expected, "OS_SocketSendToMulti() (%ld) == 2", (long)actual);
+
+        expected = sizeof(Buf2);
+        actual   = OS_SocketRecvFrom(p2_socket_id, &Buf2, sizeof(Buf2), &l_addr, 100);
+        UtAssert_True(actual == expected, "OS_SocketRecvFrom() Passed. sizeof(Buf2) (%ld) == 1", (long)actual);
+        UtAssert_True(Buf1 == Buf2, "Buf1 (%ld) == Buf2 (%ld)", (long)Buf1, (long)Buf2);
+
+        actual = OS_SocketRecvFrom(p2_socket_id, &Buf2, sizeof(Buf2), &l_addr, 100);
+        UtAssert_True(actual == expected, "OS_SocketRecvFrom() Passed. sizeof(Buf2) (%ld) == 1", (long)actual);
+        UtAssert_True(Buf3 == Buf2, "Buf3 (%ld) == Buf2 (%ld)", (long)Buf3, (long)Buf2);
+
+        /* Send the pair again and receive both with a single call */
+        RecvBufs[0].Buffer = &RecvData[0];
+        RecvBufs[0].BufLen = sizeof(RecvData[0]);
+        RecvBufs[1].Buffer = &RecvData[1];
+        RecvBufs[1].BufLen = sizeof(RecvData[1]);
+        RecvBufs[2].Buffer = &RecvData[2];
+        RecvBufs[2].BufLen = sizeof(RecvData[2]);
+
+        expected = 2;
+        actual   = OS_SocketSendToMulti(p1_socket_id, SendBufs, 2, &p2_addr);
+        UtAssert_True(actual == expected, "OS_SocketSendToMulti() (%ld) == 2", (long)actual);
+
+        actual = OS_SocketRecvFromMulti(p2_socket_id, RecvBufs, 3, 100);
+        UtAssert_True(actual == expected, "OS_SocketRecvFromMulti() (%ld) == 2", (long)actual);
+        UtAssert_True(RecvBufs[0].RecvLen == sizeof(Buf1), "RecvBufs[0].RecvLen (%lu) == sizeof(Buf1)",
+                      (unsigned long)RecvBufs[0].RecvLen);
+        UtAssert_True(RecvData[0] == Buf1, "RecvData[0] (%ld) == Buf1 (%ld)", (long)RecvData[0], (long)Buf1);
+        UtAssert_True(RecvData[1] == Buf3, "RecvData[1] (%ld) == Buf3 (%ld)", (long)RecvData[1], (long)Buf3);
+
+        /* Nothing more is queued */
+        expected = OS_ERROR_TIMEOUT;
+        actual   = OS_SocketRecvFromMulti(p2_socket_id, RecvBufs, 3, 0);
+        UtAssert_True(actual == expected, "OS_SocketRecvFromMulti() empty (%ld) == OS_ERROR_TIMEOUT", (long)actual);
+
+        expected = OS_SUCCESS;
+
         /* Get port from incoming address and verify */
         actual = OS_SocketAddrGetPort(&PortNum, &p2_addr);
         UtAssert_True(actual == expected, "OS_SocketAddrGetPort() (%ld) == OS_SUCCESS", (long)actual);
@@ -295,6 +346,24 @@ void TestDatagramNetworkApi(void)
          * to the network functions being called above
          */
 
+        /* OS_SocketRecvFromMulti */
+        expected = OS_INVALID_POINTER;
+        actual   = OS_SocketRecvFromMulti(p2_socket_id, NULL, 1, 0);
+        UtAssert_True(actual == expected, "OS_SocketRecvFromMulti(NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+
+        expected = OS_ERR_INVALID_SIZE;
+        actual   = OS_SocketRecvFromMulti(p2_socket_id, RecvBufs, 0, 0);
+        UtAssert_True(actual == expected, "OS_SocketRecvFromMulti(0) (%ld) == OS_ERR_INVALID_SIZE", (long)actual);
+
+        /* OS_SocketSendToMulti */
+        expected = OS_INVALID_POINTER;
+        actual   = OS_SocketSendToMulti(p1_socket_id, NULL, 1, &p2_addr);
+        UtAssert_True(actual == expected, "OS_SocketSendToMulti(NULL) (%ld) == OS_INVALID_POINTER", (long)actual);
+
+        expected = OS_ERR_INVALID_SIZE;
+        actual   = OS_SocketSendToMulti(p1_socket_id, SendBufs, 0, &p2_addr);
+        UtAssert_True(actual == expected, "OS_SocketSendToMulti(0) (%ld) == OS_ERR_INVALID_SIZE", (long)actual);
+
         /* OS_SocketSendTo */
         expected = OS_INVALID_POINTER;
         actual   = OS_SocketSendTo(p1_socket_id, NULL, OSAL_SIZE_C(0), NULL);
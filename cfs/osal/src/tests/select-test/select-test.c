@@ -400,6 +400,124 @@ void TestSelectMultipleRead(void)
     }
 }
 
+void TestPollSetRead(void)
+{
+    if (networkImplemented)
+    {
+        /*
+         * Test Case For:
+         * int32 OS_PollSetWait(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+         */
+        OS_PollSet PollSet;
+        OS_FdSet   ReadSet;
+        int32      expected = OS_SUCCESS;
+        int32      actual;
+        int32      status;
+
+        actual = OS_PollSetCreate(&PollSet);
+        UtAssert_True(actual == expected, "OS_PollSetCreate() (%ld) == OS_SUCCESS", (long)actual);
+
+        /* Create a server task/thread */
+        status = OS_TaskCreate(&s_task_id, "ServerPollRead", Server_Fn, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(16384),
+                               OSAL_PRIORITY_C(50), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS_TaskCreate() (%ld) == OS_SUCCESS", (long)status);
+
+        /* Connect to a server */
+        actual = OS_SocketConnect(c_socket_id, &s_addr, 10);
+        UtAssert_True(actual == expected, "OS_SocketConnect() (%ld) == OS_SUCCESS", (long)actual);
+
+        status = OS_TaskCreate(&s2_task_id, "ServerPollRead2", Server_Fn2, OSAL_TASK_STACK_ALLOCATE,
+                               OSAL_SIZE_C(16384), OSAL_PRIORITY_C(50), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS_TaskCreate() (%ld) == OS_SUCCESS", (long)status);
+
+        /* Connect to a server */
+        actual = OS_SocketConnect(c2_socket_id, &s2_addr, 10);
+        UtAssert_True(actual == expected, "OS_SocketConnect() (%ld) == OS_SUCCESS", (long)actual);
+
+        actual = OS_PollSetAdd(&PollSet, c_socket_id, OS_STREAM_STATE_READABLE);
+        UtAssert_True(actual == expected, "OS_PollSetAdd(1) (%ld) == OS_SUCCESS", (long)actual);
+        actual = OS_PollSetAdd(&PollSet, c2_socket_id, OS_STREAM_STATE_READABLE);
+        UtAssert_True(actual == expected, "OS_PollSetAdd(2) (%ld) == OS_SUCCESS", (long)actual);
+
+        /* The same set is waited on repeatedly without being rebuilt */
+        actual = OS_PollSetWait(&PollSet, &ReadSet, NULL, 100);
+        UtAssert_True(actual == expected, "OS_PollSetWait() (%ld) == OS_SUCCESS", (long)actual);
+        UtAssert_True(!OS_SelectFdIsSet(&ReadSet, c_socket_id), "OS_SelectFdIsSet(1) == false");
+        UtAssert_True(OS_SelectFdIsSet(&ReadSet, c2_socket_id), "OS_SelectFdIsSet(2) == true");
+
+        actual = OS_PollSetWait(&PollSet, &ReadSet, NULL, 100);
+        UtAssert_True(actual == expected, "OS_PollSetWait() (%ld) == OS_SUCCESS", (long)actual);
+        UtAssert_True(OS_SelectFdIsSet(&ReadSet, c2_socket_id), "OS_SelectFdIsSet(2) == true");
+
+        /* Once the ready stream is removed only the idle one remains */
+        actual = OS_PollSetRemove(&PollSet, c2_socket_id);
+        UtAssert_True(actual == expected, "OS_PollSetRemove() (%ld) == OS_SUCCESS", (long)actual);
+
+        expected = OS_ERROR_TIMEOUT;
+        actual   = OS_PollSetWait(&PollSet, &ReadSet, NULL, 100);
+        UtAssert_True(actual == expected, "OS_PollSetWait() (%ld) == OS_ERROR_TIMEOUT", (long)actual);
+        UtAssert_True(!OS_SelectFdIsSet(&ReadSet, c_socket_id), "OS_SelectFdIsSet(1) == false");
+
+        expected = OS_SUCCESS;
+        actual   = OS_PollSetDelete(&PollSet);
+        UtAssert_True(actual == expected, "OS_PollSetDelete() (%ld) == OS_SUCCESS", (long)actual);
+    }
+    else
+    {
+        UtAssert_NA("Network API not implemented");
+    }
+}
+
+void TestSelectEvent(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SelectEventCreate(osal_id_t *event_id);
+     * int32 OS_SelectEventSignal(osal_id_t event_id);
+     * int32 OS_SelectEventClear(osal_id_t event_id);
+     */
+    osal_id_t event_id;
+    uint32    StateFlags;
+    int32     actual;
+
+    actual = OS_SelectEventCreate(&event_id);
+    if (actual == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Pollable events not implemented");
+        return;
+    }
+
+    UtAssert_True(actual == OS_SUCCESS, "OS_SelectEventCreate() (%ld) == OS_SUCCESS", (long)actual);
+
+    StateFlags = OS_STREAM_STATE_READABLE;
+    actual     = OS_SelectSingle(event_id, &StateFlags, 0);
+    UtAssert_True(actual == OS_ERROR_TIMEOUT, "OS_SelectSingle() (%ld) == OS_ERROR_TIMEOUT", (long)actual);
+
+    /* Repeated signals are coalesced into a single readable state */
+    actual = OS_SelectEventSignal(event_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SelectEventSignal() (%ld) == OS_SUCCESS", (long)actual);
+    actual = OS_SelectEventSignal(event_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SelectEventSignal() (%ld) == OS_SUCCESS", (long)actual);
+
+    StateFlags = OS_STREAM_STATE_READABLE;
+    actual     = OS_SelectSingle(event_id, &StateFlags, 100);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SelectSingle() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(StateFlags == OS_STREAM_STATE_READABLE, "OS_SelectSingle() (%x) == OS_STREAM_STATE_READABLE",
+                  (unsigned int)StateFlags);
+
+    actual = OS_SelectEventClear(event_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SelectEventClear() (%ld) == OS_SUCCESS", (long)actual);
+    actual = OS_SelectEventClear(event_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SelectEventClear() (%ld) == OS_SUCCESS", (long)actual);
+
+    StateFlags = OS_STREAM_STATE_READABLE;
+    actual     = OS_SelectSingle(event_id, &StateFlags, 0);
+    UtAssert_True(actual == OS_ERROR_TIMEOUT, "OS_SelectSingle() (%ld) == OS_ERROR_TIMEOUT", (long)actual);
+
+    actual = OS_close(event_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_close() (%ld) == OS_SUCCESS", (long)actual);
+}
+
 void TestSelectSingleWrite(void)
 {
     if (networkImplemented)
@@ -605,6 +723,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(TestSelectSingleRead, Setup_Single, Teardown_Single, "TestSelectSingleRead");
     UtTest_Add(TestSelectMultipleRead, Setup_Multi, Teardown_Multi, "TestSelectMultipleRead");
+    UtTest_Add(TestPollSetRead, Setup_Multi, Teardown_Multi, "TestPollSetRead");
+    UtTest_Add(TestSelectEvent, NULL, NULL, "TestSelectEvent");
     UtTest_Add(TestSelectSingleWrite, Setup_Single, Teardown_Single, "TestSelectSingleWrite");
     UtTest_Add(TestSelectMultipleWrite, Setup_Multi, Teardown_Multi, "TestSelectMultipleWrite");
     UtTest_Add(TestSelectSingleFile, NULL, NULL, "TestSelectSingleFile");
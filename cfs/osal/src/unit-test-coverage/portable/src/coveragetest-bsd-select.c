@@ -148,6 +148,63 @@ void Test_OS_SelectMultiple_Impl(void)
 
 } /* end OS_SelectMultiple_Impl */
 
+void Test_OS_PollSet_Impl(void)
+{
+    /* Test Case For (select() fallback):
+     * int32 OS_PollSetCreate_Impl(OS_PollSet *Set)
+     * int32 OS_PollSetAdd_Impl(OS_PollSet *Set, const OS_object_token_t *token, uint32 StateFlags)
+     * int32 OS_PollSetWait_Impl(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+     * int32 OS_PollSetRemove_Impl(OS_PollSet *Set, const OS_object_token_t *token)
+     * int32 OS_PollSetDelete_Impl(OS_PollSet *Set)
+     */
+    OS_PollSet        PollSet;
+    OS_FdSet          ReadSet;
+    OS_FdSet          WriteSet;
+    OS_object_token_t token;
+
+    memset(&PollSet, 0, sizeof(PollSet));
+    memset(&token, 0, sizeof(token));
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (&PollSet), OS_SUCCESS);
+
+    /* Streams select() cannot handle are rejected when added */
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, 0);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, false);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&PollSet, &token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, OCS_FD_SETSIZE);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&PollSet, &token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, 0);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&PollSet, &token, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    /* The wait selects on copies of the member sets */
+    PollSet.read_set.object_ids[0] = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&PollSet, &ReadSet, &WriteSet, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(PollSet.read_set.object_ids[0], 1);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_select), 0);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&PollSet, &ReadSet, &WriteSet, 1), OS_ERROR_TIMEOUT);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&PollSet, &token), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete_Impl, (&PollSet), OS_SUCCESS);
+} /* end OS_PollSet_Impl */
+
+void Test_OS_SelectEvent_Impl(void)
+{
+    /* Test Case For (platforms without eventfd):
+     * int32 OS_SelectEventCreate_Impl(const OS_object_token_t *token)
+     * int32 OS_SelectEventSignal_Impl(const OS_object_token_t *token)
+     * int32 OS_SelectEventClear_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventCreate_Impl, (&token), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventSignal_Impl, (&token), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventClear_Impl, (&token), OS_ERR_NOT_IMPLEMENTED);
+} /* end OS_SelectEvent_Impl */
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -177,4 +234,6 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_SelectSingle_Impl);
     ADD_TEST(OS_SelectMultiple_Impl);
+    ADD_TEST(OS_PollSet_Impl);
+    ADD_TEST(OS_SelectEvent_Impl);
 }
@@ -288,6 +288,53 @@ void Test_OS_SocketRecvFrom_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFrom_Impl, (&token, buffer, sizeof(buffer), &addr, 0), OS_SUCCESS);
 }
 
+void Test_OS_SocketRecvFromMulti_Impl(void)
+{
+    OS_object_token_t token = {0};
+    uint8             buffer[UT_BUFFER_SIZE];
+    OS_SockRecvBuf_t  bufs[3];
+    int32             selectflags;
+
+    /* Set up token and messages */
+    token.obj_idx  = UT_INDEX_0;
+    bufs[0].Buffer = buffer;
+    bufs[0].BufLen = sizeof(buffer);
+    bufs[1]        = bufs[0];
+    bufs[2]        = bufs[0];
+
+    /* Selectable, fail OS_SelectSingle_Impl */
+    OS_impl_filehandle_table[0].selectable = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectSingle_Impl), 1, UT_ERR_UNIQUE);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, bufs, 3, 0), UT_ERR_UNIQUE);
+
+    /* Timeout by clearing select flags with hook */
+    selectflags = 0;
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), UT_Hook_OS_SelectSingle_Impl, &selectflags);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, bufs, 3, 0), OS_ERROR_TIMEOUT);
+    UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
+
+    /* Not selectable, 0 timeout, EAGAIN error on first receive */
+    OS_impl_filehandle_table[0].selectable = false;
+    OCS_errno                              = OCS_EAGAIN;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, bufs, 3, 0), OS_QUEUE_EMPTY);
+
+    /* With timeout, other error on first receive */
+    OCS_errno = 0;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, bufs, 3, 1), OS_ERROR);
+
+    /* Queue drained after the first datagram, returns the count that was received */
+    OCS_errno = OCS_EWOULDBLOCK;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, 4);
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, bufs, 3, 0), 1);
+    UtAssert_UINT32_EQ(bufs[0].RecvLen, 4);
+
+    /* Success, all buffers filled */
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, bufs, 3, 0), 3);
+}
+
 void Test_OS_SocketSendTo_Impl(void)
 {
     OS_object_token_t    token = {0};
@@ -314,6 +361,41 @@ void Test_OS_SocketSendTo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo_Impl, (&token, buffer, sizeof(buffer), &addr), OS_SUCCESS);
 }
 
+void Test_OS_SocketSendToMulti_Impl(void)
+{
+    OS_object_token_t    token = {0};
+    uint8                buffer[UT_BUFFER_SIZE];
+    OS_SockBuf_t         bufs[3];
+    OS_SockAddr_t        addr = {0};
+    struct OCS_sockaddr *sa   = (struct OCS_sockaddr *)&addr.AddrData;
+
+    /* Set up token and messages */
+    token.obj_idx  = UT_INDEX_0;
+    bufs[0].Buffer = buffer;
+    bufs[0].BufLen = sizeof(buffer);
+    bufs[1]        = bufs[0];
+    bufs[2]        = bufs[0];
+
+    /* Bad address length */
+    sa->sa_family     = -1;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, bufs, 3, &addr), OS_ERR_BAD_ADDRESS);
+
+    /* AF_INET, first send fails */
+    sa->sa_family = OCS_AF_INET;
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, bufs, 3, &addr), OS_ERROR);
+
+    /* AF_INET, later send fails, returns the count that was sent */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 3, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, bufs, 3, &addr), 2);
+
+    /* AF_INET6, success */
+    sa->sa_family     = OCS_AF_INET6;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in6);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, bufs, 3, &addr), 3);
+}
+
 void Test_OS_SocketGetInfo_Impl(void)
 {
     OSAPI_TEST_FUNCTION_RC(OS_SocketGetInfo_Impl, (NULL, NULL), OS_SUCCESS);
@@ -456,7 +538,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketConnect_Impl);
     ADD_TEST(OS_SocketAccept_Impl);
     ADD_TEST(OS_SocketRecvFrom_Impl);
+    ADD_TEST(OS_SocketRecvFromMulti_Impl);
     ADD_TEST(OS_SocketSendTo_Impl);
+    ADD_TEST(OS_SocketSendToMulti_Impl);
     ADD_TEST(OS_SocketGetInfo_Impl);
     ADD_TEST(OS_SocketAddrInit_Impl);
     ADD_TEST(OS_SocketAddrToString_Impl);
@@ -145,6 +145,23 @@ void Test_OS_GenericWrite_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_GenericWrite_Impl, (&token, DestData, sizeof(DestData), 0), OS_ERROR);
 }
 
+void Test_OS_GenericCopyRange_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericCopyRange_Impl(const OS_object_token_t *dest_token, const OS_object_token_t *src_token,
+     *                                size_t nbytes, size_t *bytes_copied)
+     */
+    OS_object_token_t token;
+    size_t            copied = 0;
+
+    memset(&token, 0, sizeof(token));
+
+    /* Without a kernel copy facility the shared layer falls back to read/write */
+    OSAPI_TEST_FUNCTION_RC(OS_GenericCopyRange_Impl, (&token, &token, 100, &copied), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(copied, 0);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -180,4 +197,5 @@ void UtTest_Setup(void)
     ADD_TEST(OS_GenericSeek_Impl);
     ADD_TEST(OS_GenericRead_Impl);
     ADD_TEST(OS_GenericWrite_Impl);
+    ADD_TEST(OS_GenericCopyRange_Impl);
 }
@@ -259,6 +259,9 @@ void Test_OS_cp(void)
 
     UtAssert_True(actual == expected, "OS_cp() (%ld) == OS_INVALID_POINTER", (long)actual);
 
+    /* The kernel copy path is covered by Test_OS_FileCopyRange, use the buffered copy here */
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericCopyRange_Impl), OS_ERR_NOT_IMPLEMENTED);
+
     /* setup to make internal copy loop execute at least once */
     expected = OS_SUCCESS;
     UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
@@ -284,6 +287,69 @@ void Test_OS_cp(void)
     actual   = OS_cp("/cf/file1", "/cf/file2");
     UtAssert_True(actual == expected, "OS_cp() (%ld) == OS_INVALID_POINTER", (long)actual);
     UT_ClearDefaultReturnValue(UT_KEY(OS_TranslatePath));
+    UT_ClearDefaultReturnValue(UT_KEY(OS_GenericCopyRange_Impl));
+}
+
+void Test_OS_FileCopyRange(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileCopyRange(osal_id_t dest_fd, osal_id_t src_fd, size_t max_bytes, size_t *bytes_copied)
+     */
+    size_t copied;
+    size_t chunks[3];
+    char   ReadBuf[] = "cpcpcpcp";
+    char   WriteBuf[sizeof(ReadBuf)];
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 1000, NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 0, &copied), OS_ERR_INVALID_SIZE);
+
+    /* The kernel copy is repeated until it reports end of file */
+    chunks[0] = 100;
+    chunks[1] = 50;
+    UT_SetDataBuffer(UT_KEY(OS_GenericCopyRange_Impl), chunks, 2 * sizeof(chunks[0]), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 1000, &copied), OS_SUCCESS);
+    UtAssert_UINT32_EQ(copied, 150);
+    UtAssert_STUB_COUNT(OS_GenericCopyRange_Impl, 3);
+    UtAssert_STUB_COUNT(OS_GenericRead_Impl, 0);
+
+    /* ...or until the requested amount is reached */
+    chunks[0] = 100;
+    chunks[1] = 400;
+    UT_SetDataBuffer(UT_KEY(OS_GenericCopyRange_Impl), chunks, 2 * sizeof(chunks[0]), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 500, &copied), OS_SUCCESS);
+    UtAssert_UINT32_EQ(copied, 500);
+    UtAssert_STUB_COUNT(OS_GenericCopyRange_Impl, 5);
+
+    /* Errors are passed back along with the partial count */
+    chunks[0] = 100;
+    UT_SetDataBuffer(UT_KEY(OS_GenericCopyRange_Impl), chunks, sizeof(chunks[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericCopyRange_Impl), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 1000, &copied), OS_ERROR);
+    UtAssert_UINT32_EQ(copied, 100);
+
+    /* If the kernel cannot do it the rest is copied through a buffer, bounded by the request */
+    chunks[0] = 2;
+    UT_SetDataBuffer(UT_KEY(OS_GenericCopyRange_Impl), chunks, sizeof(chunks[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericCopyRange_Impl), 2, OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
+    UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), WriteBuf, sizeof(WriteBuf), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 6, &copied), OS_SUCCESS);
+    UtAssert_UINT32_EQ(copied, 6);
+    UtAssert_MemCmp(WriteBuf, ReadBuf, 4, "Buffered copy data");
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericCopyRange_Impl), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericRead_Impl), -444);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 6, &copied), -444);
+    UtAssert_UINT32_EQ(copied, 0);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_GenericRead_Impl));
+    UT_ClearDefaultReturnValue(UT_KEY(OS_GenericCopyRange_Impl));
+
+    /* Invalid file handles */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 1000, &copied), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileCopyRange(UT_OBJID_1, UT_OBJID_2, 1000, &copied), OS_ERR_INVALID_ID);
 }
 
 void Test_OS_mv(void)
@@ -433,6 +499,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
+    ADD_TEST(OS_FileCopyRange);
     ADD_TEST(OS_mv);
     ADD_TEST(OS_FDGetInfo);
     ADD_TEST(OS_FileOpenCheck);
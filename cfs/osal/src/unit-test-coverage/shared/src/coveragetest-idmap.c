@@ -511,6 +511,28 @@ void Test_OS_ObjectIdGetById(void)
     OS_ObjectIdRelease(&token1);
     UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
 
+    /* a live ID is looked up in REFCOUNT and NONE mode without the global lock */
+    UT_ResetState(UT_KEY(OS_Lock_Global_Impl));
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TASK, refobjid, &token2),
+                           OS_SUCCESS);
+    UtAssert_UINT32_EQ(token2.obj_idx, local_idx);
+    OS_ObjectIdRelease(&token1);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
+    UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
+
+    /* a stale ID backs out its reference and gets the normal error from the locked path */
+    rptr->active_id = UT_OBJID_OTHER;
+    expected        = OS_ERR_INVALID_ID;
+    actual          = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1);
+    UtAssert_True(actual == expected, "OS_ObjectIdGetById() (%ld) == OS_ERR_INVALID_ID", (long)actual);
+    UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 1);
+    actual = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1);
+    UtAssert_True(actual == expected, "OS_ObjectIdGetById() (%ld) == OS_ERR_INVALID_ID", (long)actual);
+    rptr->active_id = refobjid;
+
     /* noop if done a second time */
     OS_ObjectIdRelease(&token1);
     UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
@@ -830,15 +852,26 @@ void Test_OS_ObjectIdTransaction(void)
     OSAPI_TEST_OBJID(record->active_id, ==, token.obj_id);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
-    /* refcount finish (no change to ID) */
+    /* refcount finish (no change to ID), done without the global lock */
     token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
     record->refcount  = 1;
     record->active_id = UT_OBJID_1;
     OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
+    /* refcount finish while an exclusive lock is pending wakes the waiter via the global lock */
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 1;
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    OS_ObjectIdTransactionFinish(&token, NULL);
     UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 4);
-    OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+    record->active_id = UT_OBJID_1;
 
     /* other finish with refcount already 0 */
     token.lock_mode = OS_LOCK_MODE_GLOBAL;
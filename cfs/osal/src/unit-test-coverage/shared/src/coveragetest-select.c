@@ -120,6 +120,97 @@ void Test_OS_SelectFdAddClearOps(void)
     UtAssert_True(!OS_SelectFdIsSet(&UtSet, UT_OBJID_2), "OS_SelectFdIsSet(2) == false");
 }
 
+void Test_OS_PollSetOps(void)
+{
+    /*
+     * Test Cases For:
+     * int32 OS_PollSetCreate(OS_PollSet *Set);
+     * int32 OS_PollSetAdd(OS_PollSet *Set, osal_id_t objid, uint32 StateFlags);
+     * int32 OS_PollSetWait(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs);
+     * int32 OS_PollSetRemove(OS_PollSet *Set, osal_id_t objid);
+     * int32 OS_PollSetDelete(OS_PollSet *Set);
+     */
+    OS_PollSet PollSet;
+    OS_FdSet   ReadSet;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&PollSet), OS_SUCCESS);
+    UtAssert_INT32_EQ(PollSet.impl_handle, -1);
+
+    /* Membership follows the requested states */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(NULL, UT_OBJID_1, OS_STREAM_STATE_READABLE), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(&PollSet, UT_OBJID_1, 0), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(&PollSet, UT_OBJID_1, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(&PollSet, UT_OBJID_2, OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+    UtAssert_True(OS_SelectFdIsSet(&PollSet.read_set, UT_OBJID_1), "OS_SelectFdIsSet(read, 1) == true");
+    UtAssert_True(!OS_SelectFdIsSet(&PollSet.write_set, UT_OBJID_1), "OS_SelectFdIsSet(write, 1) == false");
+    UtAssert_True(OS_SelectFdIsSet(&PollSet.write_set, UT_OBJID_2), "OS_SelectFdIsSet(write, 2) == true");
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(&PollSet, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_True(OS_SelectFdIsSet(&PollSet.read_set, UT_OBJID_2), "OS_SelectFdIsSet(read, 2) == true");
+    UtAssert_True(!OS_SelectFdIsSet(&PollSet.write_set, UT_OBJID_2), "OS_SelectFdIsSet(write, 2) == false");
+
+    /* Implementation and lookup failures leave the membership unchanged */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetAdd_Impl), 1, OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(&PollSet, UT_OBJID_1, OS_STREAM_STATE_WRITABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UtAssert_True(!OS_SelectFdIsSet(&PollSet.write_set, UT_OBJID_1), "OS_SelectFdIsSet(write, 1) == false");
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(&PollSet, UT_OBJID_1, OS_STREAM_STATE_WRITABLE), OS_ERR_INVALID_ID);
+
+    /* Either output set is optional */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(NULL, &ReadSet, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(&PollSet, &ReadSet, NULL, 0), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(&PollSet, NULL, NULL, -1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_PollSetWait_Impl, 2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(NULL, UT_OBJID_1), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(&PollSet, UT_OBJID_1), OS_SUCCESS);
+    UtAssert_True(!OS_SelectFdIsSet(&PollSet.read_set, UT_OBJID_1), "OS_SelectFdIsSet(read, 1) == false");
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetRemove_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(&PollSet, UT_OBJID_2), OS_ERROR);
+    UtAssert_True(!OS_SelectFdIsSet(&PollSet.read_set, UT_OBJID_2), "OS_SelectFdIsSet(read, 2) == false");
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(&PollSet, UT_OBJID_2), OS_ERR_INVALID_ID);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(NULL), OS_INVALID_POINTER);
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetDelete_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(&PollSet), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(&PollSet), OS_SUCCESS);
+    UtAssert_INT32_EQ(PollSet.impl_handle, -1);
+}
+
+void Test_OS_SelectEventOps(void)
+{
+    /*
+     * Test Cases For:
+     * int32 OS_SelectEventCreate(osal_id_t *event_id);
+     * int32 OS_SelectEventSignal(osal_id_t event_id);
+     * int32 OS_SelectEventClear(osal_id_t event_id);
+     */
+    osal_id_t objid;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventCreate(NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventCreate(&objid), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UtAssert_STUB_COUNT(OS_SelectEventCreate_Impl, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectEventCreate_Impl), 1, OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventCreate(&objid), OS_ERR_NOT_IMPLEMENTED);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdAllocateNew), 1, OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventCreate(&objid), OS_ERR_NO_FREE_IDS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventSignal(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SelectEventSignal_Impl, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventSignal(UT_OBJID_1), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_SelectEventSignal_Impl, 1);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventClear(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SelectEventClear_Impl, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SelectEventClear(UT_OBJID_1), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_SelectEventClear_Impl, 1);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -146,4 +237,6 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SelectFdAddClearOps);
     ADD_TEST(OS_SelectSingle);
     ADD_TEST(OS_SelectMultiple);
+    ADD_TEST(OS_PollSetOps);
+    ADD_TEST(OS_SelectEventOps);
 }
@@ -308,6 +308,49 @@ void Test_OS_SocketRecvFrom(void)
                   (long)actual);
 }
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketRecvFromMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketRecvFromMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockRecvBuf_t *BufArray, uint32 BufCount, int32 timeout)
+     */
+    char             Buf = 'A';
+    OS_SockRecvBuf_t BufArray[2];
+    osal_index_t     idbuf;
+
+    BufArray[0].Buffer = &Buf;
+    BufArray[0].BufLen = sizeof(Buf);
+    BufArray[1]        = BufArray[0];
+    idbuf              = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketRecvFromMulti_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, BufArray, 2, 0), 2);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_SocketRecvFromMulti_Impl));
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, NULL, 2, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, BufArray, 0, 0), OS_ERR_INVALID_SIZE);
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, BufArray, 2, 0), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    /*
+     * Should fail if not bound
+     */
+    OS_stream_table[1].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[1].stream_state = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, BufArray, 2, 0), OS_ERR_INCORRECT_OBJ_STATE);
+}
+
 /*****************************************************************************
  *
  * Test case for OS_SocketSendTo()
@@ -356,6 +399,46 @@ void Test_OS_SocketSendTo(void)
                   (long)actual);
 }
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketSendToMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketSendToMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketSendToMulti(osal_id_t sock_id, const OS_SockBuf_t *BufArray, uint32 BufCount,
+     *                            const OS_SockAddr_t *RemoteAddr)
+     */
+    char          Buf = 'A';
+    OS_SockBuf_t  BufArray[2];
+    OS_SockAddr_t Addr;
+    osal_index_t  idbuf;
+
+    memset(&Addr, 0, sizeof(Addr));
+    BufArray[0].Buffer = &Buf;
+    BufArray[0].BufLen = sizeof(Buf);
+    BufArray[1]        = BufArray[0];
+    idbuf              = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketSendToMulti_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, BufArray, 2, &Addr), 2);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_SocketSendToMulti_Impl));
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, NULL, 2, &Addr), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, BufArray, 2, NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, BufArray, 0, &Addr), OS_ERR_INVALID_SIZE);
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, BufArray, 2, &Addr), OS_ERR_INCORRECT_OBJ_TYPE);
+}
+
 /*****************************************************************************
  *
  * Test case for OS_SocketGetIdByName()
@@ -496,6 +579,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketConnect);
     ADD_TEST(OS_SocketRecvFrom);
     ADD_TEST(OS_SocketSendTo);
+    ADD_TEST(OS_SocketSendToMulti);
+    ADD_TEST(OS_SocketRecvFromMulti);
     ADD_TEST(OS_SocketGetIdByName);
     ADD_TEST(OS_SocketGetInfo);
     ADD_TEST(OS_CreateSocketName);
@@ -178,6 +178,10 @@ void Test_OS_TimerSet(void)
     actual   = OS_TimerSet(UT_OBJID_1, 0, 1);
     UtAssert_True(actual == expected, "OS_TimerSet() (%ld) == OS_SUCCESS", (long)actual);
 
+    /* The callback is re-slotted on the timing wheel */
+    UtAssert_STUB_COUNT(OS_TimeBase_WheelRemove, 1);
+    UtAssert_STUB_COUNT(OS_TimeBase_WheelInsert, 1);
+
     OS_timecb_table[2].timebase_token.obj_type = OS_OBJECT_TYPE_OS_TIMEBASE;
     OS_timecb_table[2].timebase_token.obj_id   = UT_OBJID_2;
     OS_timecb_table[2].timebase_token.obj_idx  = UT_INDEX_0;
@@ -203,51 +207,31 @@ void Test_OS_TimerDelete(void)
      * Test Case For:
      * int32 OS_TimerDelete(uint32 timer_id)
      */
-    int32                          expected;
-    int32                          actual;
-    osal_id_t                      timebase_id;
-    osal_id_t                      timer_objid_1, timer_objid_2;
-    OS_timebase_internal_record_t *timebase;
-    OS_object_token_t              timebase_token;
-    uint32                         accuracy;
+    int32     expected;
+    int32     actual;
+    osal_id_t timebase_id;
+    osal_id_t timer_objid_1, timer_objid_2;
+    uint32    accuracy;
 
     expected = OS_SUCCESS;
 
-    /* The ObjIds in the ring need to match what will be in the token */
     /* Get a "timebase" from the stub so the objid will validate */
     OS_TimeBaseCreate(&timebase_id, "ut", NULL);
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, timebase_id, &timebase_token);
-    timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timebase_token);
     OS_TimerAdd(&timer_objid_1, "UT1", timebase_id, UT_TimerArgCallback, NULL);
     OS_TimerAdd(&timer_objid_2, "UT2", timebase_id, UT_TimerArgCallback, NULL);
 
-    /* Sanity check: After adding the two timers the "first_cb" should be pointing at timer 2 */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_2), "First CB at timer 2");
+    /* Adding timers does not schedule them on the timing wheel */
+    UtAssert_STUB_COUNT(OS_TimeBase_WheelInsert, 0);
 
     actual = OS_TimerDelete(timer_objid_2);
     UtAssert_True(actual == expected, "OS_TimerDelete() (%ld) == OS_SUCCESS", (long)actual);
 
-    /* After deleting timer 2 the "first_cb" should be pointing at timer 1 */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_1), "First CB at timer 1");
-
-    /* Re-add timer 2 again */
-    OS_TimerAdd(&timer_objid_2, "UT2", timebase_id, UT_TimerArgCallback, NULL);
+    /* Deleting a timer takes it off the timing wheel of its time base */
+    UtAssert_STUB_COUNT(OS_TimeBase_WheelRemove, 1);
 
-    /* Sanity check: the "first_cb" should be pointing at timer 2 again */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_2), "First CB at timer 2");
-
-    /* delete timer 1 */
     actual = OS_TimerDelete(timer_objid_1);
     UtAssert_True(actual == expected, "OS_TimerDelete() (%ld) == OS_SUCCESS", (long)actual);
-
-    /* The "first_cb" should be still pointing at timer 2 */
-    UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_2), "First CB at timer 2");
-
-    actual = OS_TimerDelete(timer_objid_2);
-    UtAssert_True(actual == expected, "OS_TimerDelete() (%ld) == OS_SUCCESS", (long)actual);
-
-    /* The "first_cb" should be undefined */
-    UtAssert_True(!OS_ObjectIdDefined(timebase->first_cb), "First CB at OS_OBJECT_ID_UNDEFINED");
+    UtAssert_STUB_COUNT(OS_TimeBase_WheelRemove, 2);
 
     /* verify deletion of the dedicated timebase objects
      * these are implicitly created as part of timer creation for API compatibility */
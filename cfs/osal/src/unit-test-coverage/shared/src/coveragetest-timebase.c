@@ -24,6 +24,16 @@
  * \author   joseph.p.hickey@nasa.gov
  *
  */
+
+/*
+ * The timing wheel stress tests need many more timer records than the default
+ * configuration provides, so this test raises the limit and supplies its own
+ * timer table in place of the stub one.
+ */
+#include "osconfig.h"
+#undef OS_MAX_TIMERS
+#define OS_MAX_TIMERS 512
+
 #include "os-shared-coveragetest.h"
 
 #include "os-shared-timebase.h"
@@ -34,6 +44,8 @@
 #include "OCS_string.h"
 #include <limits.h>
 
+OS_timecb_internal_record_t OS_timecb_table[OS_MAX_TIMERS];
+
 static uint32 TimerSyncCount  = 0;
 static uint32 TimerSyncRetVal = 0;
 static uint32 TimeCB          = 0;
@@ -255,11 +267,9 @@ void Test_OS_TimeBase_CallbackThread(void)
 
     OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_1, &timecb_token);
     OS_timebase_table[2].external_sync = UT_TimerSync;
-    OS_timebase_table[2].first_cb      = timecb_token.obj_id;
-    OS_timecb_table[1].prev_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].next_cb         = timecb_token.obj_id;
     OS_timecb_table[1].wait_time       = 2000;
     OS_timecb_table[1].callback_ptr    = UT_TimeCB;
+    OS_TimeBase_WheelInsert(&OS_timebase_table[2], timecb_token.obj_id);
     TimerSyncCount                     = 0;
     TimerSyncRetVal                    = 0;
     TimeCB                             = 0;
@@ -284,6 +294,319 @@ void Test_OS_TimeBase_CallbackThread(void)
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 }
 
+/*
+ * Reference model of a timer callback, processed the way the time base
+ * serviced every timer on every tick before the timing wheel was introduced
+ */
+typedef struct
+{
+    int32  wait_time;
+    int32  interval_time;
+    uint32 callbacks;
+} UT_TimerModel_t;
+
+static uint32 UT_WheelCallbacks[OS_MAX_TIMERS];
+
+static void UT_WheelCB(osal_id_t object_id, void *arg)
+{
+    ++(*((uint32 *)arg));
+}
+
+static void UT_TimerModelTick(UT_TimerModel_t *model, uint32 tick_time)
+{
+    int32 saved_wait_time;
+
+    saved_wait_time = model->wait_time;
+    model->wait_time -= tick_time;
+    while (model->wait_time <= 0)
+    {
+        model->wait_time += model->interval_time;
+        if (model->wait_time < -model->interval_time)
+        {
+            model->wait_time = -model->interval_time;
+        }
+        if (saved_wait_time > 0)
+        {
+            ++model->callbacks;
+        }
+        if (model->interval_time <= 0)
+        {
+            break;
+        }
+    }
+}
+
+static uint32 UT_WheelRandom(uint32 *state)
+{
+    *state = (*state * 1103515245) + 12345;
+    return (*state >> 8);
+}
+
+static osal_id_t UT_WheelSetupTimer(OS_timebase_internal_record_t *timebase, uint32 idx)
+{
+    OS_object_token_t timecb_token;
+
+    /* the stub yields a timer callback ID that maps back to the same index */
+    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, OS_ObjectIdFromInteger(idx), &timecb_token);
+    OS_timecb_table[idx].callback_ptr = UT_WheelCB;
+    OS_timecb_table[idx].callback_arg = &UT_WheelCallbacks[idx];
+
+    return timecb_token.obj_id;
+}
+
+static void UT_WheelSetTimer(OS_timebase_internal_record_t *timebase, uint32 idx, int32 start_time,
+                             int32 interval_time)
+{
+    osal_id_t timecb_id = UT_WheelSetupTimer(timebase, idx);
+
+    /* mirrors OS_TimerSet() */
+    OS_TimeBase_WheelRemove(timebase, timecb_id);
+    OS_timecb_table[idx].wait_time     = start_time;
+    OS_timecb_table[idx].interval_time = interval_time;
+    OS_TimeBase_WheelInsert(timebase, timecb_id);
+}
+
+void Test_OS_TimeBase_ProcessTick(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TimeBase_ProcessTick(OS_timebase_internal_record_t *timebase, uint32 tick_time)
+     */
+    OS_timebase_internal_record_t *timebase = &OS_timebase_table[0];
+    osal_id_t                      timecb_id;
+
+    memset(timebase, 0, sizeof(*timebase));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    memset(UT_WheelCallbacks, 0, sizeof(UT_WheelCallbacks));
+
+    /* A timer that was added but never set is not on the wheel and never fires */
+    UT_WheelSetupTimer(timebase, 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[0], 0);
+    UtAssert_UINT32_EQ(timebase->freerun_time, 10000);
+
+    /* One-shot: fires once, on the tick where the start time elapses, then leaves the wheel */
+    UT_WheelSetTimer(timebase, 1, 25000, 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[1], 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[1], 1);
+    UtAssert_UINT32_EQ(OS_timecb_table[1].wheel_pos, 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[1], 1);
+    UtAssert_UINT32_EQ(timebase->wheel_count, 0);
+
+    /* A zero start time skips the first expiry, then runs periodically */
+    UT_WheelSetTimer(timebase, 2, 0, 20000);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[2], 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[2], 1);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[2], 2);
+    UtAssert_UINT32_EQ(OS_timecb_table[2].interval_time, 20000);
+
+    /* An interval shorter than the tick is limited to a backlog of one interval */
+    UT_WheelSetTimer(timebase, 3, 1000, 1000);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[3], 3);
+    UtAssert_UINT32_EQ(OS_timecb_table[3].backlog_resets, 1);
+
+    /* Re-setting a timer moves it, and removing it stops it */
+    UT_WheelSetTimer(timebase, 4, 5000000, 0);
+    UT_WheelSetTimer(timebase, 4, 5000, 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[4], 1);
+    timecb_id = UT_WheelSetupTimer(timebase, 4);
+    UT_WheelSetTimer(timebase, 4, 5000, 0);
+    OS_TimeBase_WheelRemove(timebase, timecb_id);
+    OS_TimeBase_WheelRemove(timebase, timecb_id);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[4], 1);
+
+    /* Long timers are cascaded down from the upper levels and still fire on time */
+    UT_WheelSetTimer(timebase, 5, 300000000, 0);
+    UtAssert_UINT32_EQ((OS_timecb_table[5].wheel_pos - 1) / OS_TIMEBASE_WHEEL_SLOTS, OS_TIMEBASE_WHEEL_LEVELS - 1);
+    OS_TimeBase_WheelRemove(timebase, UT_WheelSetupTimer(timebase, 2));
+    OS_TimeBase_WheelRemove(timebase, UT_WheelSetupTimer(timebase, 3));
+    OS_TimeBase_ProcessTick(timebase, 299990000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[5], 0);
+    UtAssert_UINT32_EQ((OS_timecb_table[5].wheel_pos - 1) / OS_TIMEBASE_WHEEL_SLOTS, 0);
+    OS_TimeBase_ProcessTick(timebase, 10000);
+    UtAssert_UINT32_EQ(UT_WheelCallbacks[5], 1);
+
+    /* With nothing scheduled the clock jumps straight to the current time */
+    OS_TimeBase_ProcessTick(timebase, 100000000);
+    UtAssert_True(timebase->wheel_clock == (timebase->wheel_time >> OS_TIMEBASE_WHEEL_RES_BITS),
+                  "wheel_clock tracks wheel_time");
+
+    /* IDs that do not map to a timer are ignored */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERR_INVALID_ID);
+    OS_TimeBase_WheelInsert(timebase, timecb_id);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex));
+    UtAssert_UINT32_EQ(timebase->wheel_count, 0);
+}
+
+void Test_OS_TimeBase_WheelStress(void)
+{
+    /*
+     * Stress test of the timing wheel against the reference model:
+     * 1000 timers with random start and interval times are armed, in turn, on the
+     * available timer records, while the time base runs with irregular tick times.
+     */
+    OS_timebase_internal_record_t *timebase = &OS_timebase_table[0];
+    UT_TimerModel_t                model[OS_MAX_TIMERS];
+    uint32                         seed;
+    uint32                         timer;
+    uint32                         idx;
+    uint32                         tick;
+    uint32                         tick_time;
+    uint32                         mismatches;
+    uint32                         callbacks;
+    int32                          start_time;
+    int32                          interval_time;
+
+    memset(timebase, 0, sizeof(*timebase));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    memset(UT_WheelCallbacks, 0, sizeof(UT_WheelCallbacks));
+    memset(model, 0, sizeof(model));
+
+    seed       = 1;
+    mismatches = 0;
+    callbacks  = 0;
+    for (timer = 0; timer < 1000; ++timer)
+    {
+        idx = UT_WheelRandom(&seed) % OS_MAX_TIMERS;
+
+        switch (UT_WheelRandom(&seed) % 4)
+        {
+            case 0: /* one-shot */
+                start_time    = 1 + (UT_WheelRandom(&seed) % 200000);
+                interval_time = 0;
+                break;
+            case 1: /* faster than the tick */
+                start_time    = UT_WheelRandom(&seed) % 20000;
+                interval_time = 1 + (UT_WheelRandom(&seed) % 5000);
+                break;
+            case 2: /* a few ticks */
+                start_time    = UT_WheelRandom(&seed) % 100000;
+                interval_time = 1000 + (UT_WheelRandom(&seed) % 100000);
+                break;
+            default: /* long enough to live on the upper levels */
+                start_time    = 1 + (UT_WheelRandom(&seed) % 400000000);
+                interval_time = UT_WheelRandom(&seed) % 10000000;
+                break;
+        }
+
+        UT_WheelSetTimer(timebase, idx, start_time, interval_time);
+        model[idx].wait_time     = start_time;
+        model[idx].interval_time = interval_time;
+
+        for (tick = UT_WheelRandom(&seed) % 8; tick > 0; --tick)
+        {
+            if ((UT_WheelRandom(&seed) % 64) == 0)
+            {
+                tick_time = UT_WheelRandom(&seed) % 200000000;
+            }
+            else
+            {
+                tick_time = UT_WheelRandom(&seed) % 20000;
+            }
+
+            OS_TimeBase_ProcessTick(timebase, tick_time);
+
+            for (idx = 0; idx < OS_MAX_TIMERS; ++idx)
+            {
+                UT_TimerModelTick(&model[idx], tick_time);
+                if (model[idx].callbacks != UT_WheelCallbacks[idx])
+                {
+                    ++mismatches;
+                    model[idx].callbacks = UT_WheelCallbacks[idx];
+                }
+            }
+        }
+    }
+
+    for (idx = 0; idx < OS_MAX_TIMERS; ++idx)
+    {
+        callbacks += UT_WheelCallbacks[idx];
+    }
+
+    UtAssert_True(callbacks > 0, "Callbacks given (%lu) > 0", (unsigned long)callbacks);
+    UtAssert_UINT32_EQ(mismatches, 0);
+}
+
+void Test_OS_TimeBase_WheelCascade(void)
+{
+    /*
+     * Stress test of the timing wheel against the reference model:
+     * every timer record is armed with a start time and interval long enough to
+     * live on the upper levels, clustered so that each occupied slot holds many
+     * timers, and the time base runs until they have cascaded down through all
+     * levels and been re-armed several times.
+     */
+    OS_timebase_internal_record_t *timebase = &OS_timebase_table[0];
+    UT_TimerModel_t                model[OS_MAX_TIMERS];
+    uint32                         seed;
+    uint32                         idx;
+    uint32                         tick_time;
+    uint32                         elapsed;
+    uint32                         mismatches;
+    uint32                         callbacks;
+    int32                          start_time;
+    int32                          interval_time;
+
+    memset(timebase, 0, sizeof(*timebase));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    memset(UT_WheelCallbacks, 0, sizeof(UT_WheelCallbacks));
+    memset(model, 0, sizeof(model));
+
+    seed       = 2;
+    mismatches = 0;
+    callbacks  = 0;
+    for (idx = 0; idx < OS_MAX_TIMERS; ++idx)
+    {
+        /* a few distinct top level slots, each shared by around a hundred timers */
+        start_time    = (1 + (UT_WheelRandom(&seed) % 4)) * 100000000 + (UT_WheelRandom(&seed) % 2048);
+        interval_time = (1 + (UT_WheelRandom(&seed) % 3)) * 50000000 + (UT_WheelRandom(&seed) % 2048);
+
+        UT_WheelSetTimer(timebase, idx, start_time, interval_time);
+        model[idx].wait_time     = start_time;
+        model[idx].interval_time = interval_time;
+    }
+
+    UtAssert_UINT32_EQ(timebase->wheel_count, OS_MAX_TIMERS);
+
+    for (elapsed = 0; elapsed < 1000000000; elapsed += tick_time)
+    {
+        tick_time = 1 + (UT_WheelRandom(&seed) % 1000000);
+
+        OS_TimeBase_ProcessTick(timebase, tick_time);
+
+        for (idx = 0; idx < OS_MAX_TIMERS; ++idx)
+        {
+            UT_TimerModelTick(&model[idx], tick_time);
+            if (model[idx].callbacks != UT_WheelCallbacks[idx])
+            {
+                ++mismatches;
+                model[idx].callbacks = UT_WheelCallbacks[idx];
+            }
+        }
+    }
+
+    for (idx = 0; idx < OS_MAX_TIMERS; ++idx)
+    {
+        callbacks += UT_WheelCallbacks[idx];
+    }
+
+    UtAssert_True(callbacks >= 4 * OS_MAX_TIMERS, "Callbacks given (%lu) >= %lu", (unsigned long)callbacks,
+                  (unsigned long)(4 * OS_MAX_TIMERS));
+    UtAssert_UINT32_EQ(timebase->wheel_count, OS_MAX_TIMERS);
+    UtAssert_UINT32_EQ(mismatches, 0);
+}
+
 void Test_OS_Milli2Ticks(void)
 {
     /*
@@ -347,5 +670,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimeBaseGetInfo);
     ADD_TEST(OS_TimeBaseGetFreeRun);
     ADD_TEST(OS_TimeBase_CallbackThread);
+    ADD_TEST(OS_TimeBase_ProcessTick);
+    ADD_TEST(OS_TimeBase_WheelStress);
+    ADD_TEST(OS_TimeBase_WheelCascade);
     ADD_TEST(OS_Milli2Ticks);
 }
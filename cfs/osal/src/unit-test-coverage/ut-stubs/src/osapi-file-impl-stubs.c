@@ -83,5 +83,20 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
     return Status;
 }
 
+int32 OS_GenericCopyRange_Impl(const OS_object_token_t *dest_token, const OS_object_token_t *src_token, size_t nbytes,
+                               size_t *bytes_copied)
+{
+    int32 Status = UT_DEFAULT_IMPL(OS_GenericCopyRange_Impl);
+
+    if (Status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_GenericCopyRange_Impl), bytes_copied, sizeof(*bytes_copied)) <
+            sizeof(*bytes_copied))
+    {
+        *bytes_copied = 0;
+    }
+
+    return Status;
+}
+
 UT_DEFAULT_STUB(OS_GenericSeek_Impl, (const OS_object_token_t *token, int32 offset, uint32 whence))
 UT_DEFAULT_STUB(OS_GenericClose_Impl, (const OS_object_token_t *token))
@@ -45,8 +45,12 @@ UT_DEFAULT_STUB(OS_SocketAccept_Impl, (const OS_object_token_t *sock_token, cons
 UT_DEFAULT_STUB(OS_SocketConnect_Impl, (const OS_object_token_t *token, const OS_SockAddr_t *Addr, int32 timeout))
 UT_DEFAULT_STUB(OS_SocketRecvFrom_Impl,
                 (const OS_object_token_t *token, void *buffer, size_t buflen, OS_SockAddr_t *RemoteAddr, int32 timeout))
+UT_DEFAULT_STUB(OS_SocketRecvFromMulti_Impl,
+                (const OS_object_token_t *token, OS_SockRecvBuf_t *BufArray, uint32 BufCount, int32 timeout))
 UT_DEFAULT_STUB(OS_SocketSendTo_Impl,
                 (const OS_object_token_t *token, const void *buffer, size_t buflen, const OS_SockAddr_t *RemoteAddr))
+UT_DEFAULT_STUB(OS_SocketSendToMulti_Impl, (const OS_object_token_t *token, const OS_SockBuf_t *BufArray,
+                                            uint32 BufCount, const OS_SockAddr_t *RemoteAddr))
 UT_DEFAULT_STUB(OS_SocketGetInfo_Impl, (const OS_object_token_t *token, OS_socket_prop_t *sock_prop))
 
 UT_DEFAULT_STUB(OS_SocketAddrInit_Impl, (OS_SockAddr_t * Addr, OS_SocketDomain_t Domain))
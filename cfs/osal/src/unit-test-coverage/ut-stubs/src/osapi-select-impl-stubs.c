@@ -50,3 +50,65 @@ int32 OS_SelectMultiple_Impl(OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
 
     return UT_DEFAULT_IMPL(OS_SelectMultiple_Impl);
 }
+
+int32 OS_PollSetCreate_Impl(OS_PollSet *Set)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetCreate_Impl), Set);
+
+    return UT_DEFAULT_IMPL(OS_PollSetCreate_Impl);
+}
+
+int32 OS_PollSetDelete_Impl(OS_PollSet *Set)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetDelete_Impl), Set);
+
+    return UT_DEFAULT_IMPL(OS_PollSetDelete_Impl);
+}
+
+int32 OS_PollSetAdd_Impl(OS_PollSet *Set, const OS_object_token_t *token, uint32 StateFlags)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetAdd_Impl), Set);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetAdd_Impl), token);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetAdd_Impl), StateFlags);
+
+    return UT_DEFAULT_IMPL(OS_PollSetAdd_Impl);
+}
+
+int32 OS_PollSetRemove_Impl(OS_PollSet *Set, const OS_object_token_t *token)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetRemove_Impl), Set);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetRemove_Impl), token);
+
+    return UT_DEFAULT_IMPL(OS_PollSetRemove_Impl);
+}
+
+int32 OS_PollSetWait_Impl(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetWait_Impl), Set);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetWait_Impl), ReadSet);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetWait_Impl), WriteSet);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetWait_Impl), msecs);
+
+    return UT_DEFAULT_IMPL(OS_PollSetWait_Impl);
+}
+
+int32 OS_SelectEventCreate_Impl(const OS_object_token_t *token)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SelectEventCreate_Impl), token);
+
+    return UT_DEFAULT_IMPL(OS_SelectEventCreate_Impl);
+}
+
+int32 OS_SelectEventSignal_Impl(const OS_object_token_t *token)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SelectEventSignal_Impl), token);
+
+    return UT_DEFAULT_IMPL(OS_SelectEventSignal_Impl);
+}
+
+int32 OS_SelectEventClear_Impl(const OS_object_token_t *token)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SelectEventClear_Impl), token);
+
+    return UT_DEFAULT_IMPL(OS_SelectEventClear_Impl);
+}
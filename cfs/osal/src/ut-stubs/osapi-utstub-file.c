@@ -339,6 +339,31 @@ int32 OS_cp(const char *src, const char *dest)
     return Status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_FileCopyRange()
+ *
+ *****************************************************************************/
+int32 OS_FileCopyRange(osal_id_t dest_fd, osal_id_t src_fd, size_t max_bytes, size_t *bytes_copied)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileCopyRange), dest_fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileCopyRange), src_fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_FileCopyRange), max_bytes);
+    UT_Stub_RegisterContext(UT_KEY(OS_FileCopyRange), bytes_copied);
+
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(OS_FileCopyRange);
+
+    if (Status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_FileCopyRange), bytes_copied, sizeof(*bytes_copied)) < sizeof(*bytes_copied))
+    {
+        *bytes_copied = 0;
+    }
+
+    return Status;
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_mv()
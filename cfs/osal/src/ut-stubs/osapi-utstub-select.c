@@ -135,3 +135,142 @@ bool OS_SelectFdIsSet(OS_FdSet *Set, osal_id_t objid)
 
     return (return_code == 0);
 }
+
+/*****************************************************************************
+ *
+ * Stub function for OS_PollSetCreate()
+ *
+ *****************************************************************************/
+int32 OS_PollSetCreate(OS_PollSet *Set)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetCreate), Set);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_PollSetCreate);
+
+    return return_code;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_PollSetDelete()
+ *
+ *****************************************************************************/
+int32 OS_PollSetDelete(OS_PollSet *Set)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetDelete), Set);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_PollSetDelete);
+
+    return return_code;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_PollSetAdd()
+ *
+ *****************************************************************************/
+int32 OS_PollSetAdd(OS_PollSet *Set, osal_id_t objid, uint32 StateFlags)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetAdd), Set);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetAdd), objid);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetAdd), StateFlags);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_PollSetAdd);
+
+    return return_code;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_PollSetRemove()
+ *
+ *****************************************************************************/
+int32 OS_PollSetRemove(OS_PollSet *Set, osal_id_t objid)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetRemove), Set);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetRemove), objid);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_PollSetRemove);
+
+    return return_code;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_PollSetWait()
+ *
+ *****************************************************************************/
+int32 OS_PollSetWait(OS_PollSet *Set, OS_FdSet *ReadSet, OS_FdSet *WriteSet, int32 msecs)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetWait), Set);
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetWait), ReadSet);
+    UT_Stub_RegisterContext(UT_KEY(OS_PollSetWait), WriteSet);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_PollSetWait), msecs);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_PollSetWait);
+
+    return return_code;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_SelectEventCreate()
+ *
+ *****************************************************************************/
+int32 OS_SelectEventCreate(osal_id_t *event_id)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_SelectEventCreate), event_id);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_SelectEventCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *event_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_STREAM);
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_SelectEventSignal()
+ *
+ *****************************************************************************/
+int32 OS_SelectEventSignal(osal_id_t event_id)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SelectEventSignal), event_id);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_SelectEventSignal);
+
+    return return_code;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_SelectEventClear()
+ *
+ *****************************************************************************/
+int32 OS_SelectEventClear(osal_id_t event_id)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SelectEventClear), event_id);
+
+    int32 return_code;
+
+    return_code = UT_DEFAULT_IMPL(OS_SelectEventClear);
+
+    return return_code;
+}
@@ -155,6 +155,26 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
     return status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_SocketRecvFromMulti()
+ *
+ *****************************************************************************/
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockRecvBuf_t *BufArray, uint32 BufCount, int32 timeout)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketRecvFromMulti), sock_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_SocketRecvFromMulti), BufArray);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketRecvFromMulti), BufCount);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketRecvFromMulti), timeout);
+
+    int32 status;
+
+    /* By default pretend nothing is queued */
+    status = UT_DEFAULT_IMPL_RC(OS_SocketRecvFromMulti, OS_QUEUE_EMPTY);
+
+    return status;
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_SocketSendTo()
@@ -192,6 +212,27 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_SocketSendToMulti()
+ *
+ *****************************************************************************/
+int32 OS_SocketSendToMulti(osal_id_t sock_id, const OS_SockBuf_t *BufArray, uint32 BufCount,
+                           const OS_SockAddr_t *RemoteAddr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketSendToMulti), sock_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_SocketSendToMulti), BufArray);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_SocketSendToMulti), BufCount);
+    UT_Stub_RegisterContext(UT_KEY(OS_SocketSendToMulti), RemoteAddr);
+
+    int32 status;
+
+    /* By default pretend every datagram was sent */
+    status = UT_DEFAULT_IMPL_RC(OS_SocketSendToMulti, BufCount);
+
+    return status;
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_SocketGetIdByName()
@@ -34,6 +34,7 @@
 
 #include "osapi-timebase.h" /* OSAL public API for this subsystem */
 #include "utstub-helpers.h"
+#include "os-shared-timebase.h"
 
 UT_DEFAULT_STUB(OS_TimeBaseAPI_Init, (void))
 
@@ -193,11 +194,50 @@ int32 OS_TimeBaseGetFreeRun(osal_id_t timebase_id, uint32 *freerun_val)
  * Stub for OS_TimeBase_CallbackThread() function
  *
  *****************************************************************************/
-void OS_TimeBase_CallbackThread(uint32 timebase_id)
+void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
 {
     UT_DEFAULT_IMPL(OS_TimeBase_CallbackThread);
 }
 
+/*****************************************************************************
+ *
+ * Stub for OS_TimeBase_ProcessTick() function
+ *
+ *****************************************************************************/
+void OS_TimeBase_ProcessTick(OS_timebase_internal_record_t *timebase, uint32 tick_time)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_TimeBase_ProcessTick), timebase);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TimeBase_ProcessTick), tick_time);
+
+    UT_DEFAULT_IMPL(OS_TimeBase_ProcessTick);
+}
+
+/*****************************************************************************
+ *
+ * Stub for OS_TimeBase_WheelInsert() function
+ *
+ *****************************************************************************/
+void OS_TimeBase_WheelInsert(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_TimeBase_WheelInsert), timebase);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TimeBase_WheelInsert), timecb_id);
+
+    UT_DEFAULT_IMPL(OS_TimeBase_WheelInsert);
+}
+
+/*****************************************************************************
+ *
+ * Stub for OS_TimeBase_WheelRemove() function
+ *
+ *****************************************************************************/
+void OS_TimeBase_WheelRemove(OS_timebase_internal_record_t *timebase, osal_id_t timecb_id)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_TimeBase_WheelRemove), timebase);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TimeBase_WheelRemove), timecb_id);
+
+    UT_DEFAULT_IMPL(OS_TimeBase_WheelRemove);
+}
+
 /*****************************************************************************
  *
  * Stub for OS_Milli2Ticks() function
@@ -208,3 +208,8 @@ set(OSAL_CONFIG_MAX_CMD_LEN             1000)
 # On some implementations this may affect the overall OSAL memory footprint
 # so it may be beneficial to set this limit accordingly.
 set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50)
+
+# The largest message size for which a queue is implemented in-process.
+# Software bus pipes carry pointer-sized buffer descriptors, so 8 bytes keeps
+# every SB pipe out of the kernel message queue path on 32 and 64 bit targets.
+set(OSAL_CONFIG_QUEUE_RING_MAX_MSG_SIZE 8)
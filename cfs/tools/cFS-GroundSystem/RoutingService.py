@@ -93,10 +93,11 @@ class RoutingService(QThread):
                         self.signalUpdateIpList.emit(hostIpAddress,
                                                      my_hostName_as_bytes)
 
-                    # Forward the message using zeroMQ
+                    # Forward each packet in the datagram using zeroMQ
                     name = self.spacecraftNames[self.ipAddressesList.index(
                         hostIpAddress)]
-                    self.forwardMessage(datagram, name)
+                    for packet in self.unpackDatagram(datagram):
+                        self.forwardMessage(packet, name)
 
                 # Handle errors
                 except socket.error:
@@ -114,6 +115,25 @@ class RoutingService(QThread):
         self.publisher.send_multipart([my_header_as_bytes, datagram])
         # print(header)
 
+    # Split a datagram into its CCSDS packets. The flight side may pack
+    # several packets back to back into one datagram, so walk the packet
+    # length field (primary header bytes 4-5, total length - 7).
+    # A datagram holding a single packet is returned as is.
+    @staticmethod
+    def unpackDatagram(datagram):
+        packets = []
+        offset = 0
+        while len(datagram) - offset >= 6:
+            pktLen = unpack(">H", datagram[offset + 4:offset + 6])[0] + 7
+            if offset + pktLen > len(datagram):
+                break
+            packets.append(datagram[offset:offset + pktLen])
+            offset += pktLen
+        if not packets:
+            # Length field doesn't describe the datagram, forward it unchanged
+            packets.append(datagram)
+        return packets
+
     # Read the packet id from the telemetry packet
     @staticmethod
     def getPktId(datagram):